@@ -46,6 +46,8 @@ SOFTWARE.
 #include "iterator.h"
 #include "type_traits.h"
 
+#include "private/algorithm_simd.h"
+
 namespace etl
 {
   //***************************************************************************
@@ -94,6 +96,34 @@ namespace etl
       return etl::minmax_element(begin, end, std::less<value_t>());
   }
 
+#if defined(ETL_SIMD)
+  //***************************************************************************
+  /// minmax_element
+  /// Vectorised for contiguous ranges of integral types.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<__private_algorithm__::is_simd_type<typename etl::remove_cv<T>::type>::value, std::pair<T*, T*> >::type
+    minmax_element(T* begin,
+                   T* end)
+  {
+    typedef typename etl::remove_cv<T>::type value_t;
+
+    if (begin == end)
+    {
+      return std::pair<T*, T*>(begin, begin);
+    }
+
+    const value_t* minimum;
+    const value_t* maximum;
+
+    __private_algorithm__::minmax_element<value_t>(begin, end, minimum, maximum);
+
+    return std::pair<T*, T*>(begin + (minimum - begin), begin + (maximum - begin));
+  }
+#endif
+
   //***************************************************************************
   /// minmax
   ///\ingroup algorithm
@@ -147,6 +177,24 @@ namespace etl
     return end;
   }
 
+#if defined(ETL_SIMD)
+  //***************************************************************************
+  /// is_sorted_until
+  /// Vectorised for contiguous ranges of integral types.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<__private_algorithm__::is_simd_type<typename etl::remove_cv<T>::type>::value, T*>::type
+    is_sorted_until(T* begin,
+                    T* end)
+  {
+    typedef typename etl::remove_cv<T>::type value_t;
+
+    return begin + (__private_algorithm__::is_sorted_until<value_t>(begin, end) - begin);
+  }
+#endif
+
   //***************************************************************************
   /// is_sorted_until
   ///\ingroup algorithm
@@ -418,6 +466,72 @@ namespace etl
     return o_begin;
   }
 
+  //***************************************************************************
+  /// find
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
+  //***************************************************************************
+  template <typename TIterator,
+            typename T>
+  TIterator find(TIterator begin,
+                 TIterator end,
+                 const T&  value)
+  {
+    return std::find(begin, end, value);
+  }
+
+#if defined(ETL_SIMD)
+  //***************************************************************************
+  /// find
+  /// Vectorised for contiguous ranges of integral types.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<__private_algorithm__::is_simd_type<typename etl::remove_cv<T>::type>::value, T*>::type
+    find(T*                                      begin,
+         T*                                      end,
+         const typename etl::remove_cv<T>::type& value)
+  {
+    typedef typename etl::remove_cv<T>::type value_t;
+
+    return begin + (__private_algorithm__::find<value_t>(begin, end, value) - begin);
+  }
+#endif
+
+  //***************************************************************************
+  /// count
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/count"></a>
+  //***************************************************************************
+  template <typename TIterator,
+            typename T>
+  typename std::iterator_traits<TIterator>::difference_type count(TIterator begin,
+                                                                  TIterator end,
+                                                                  const T&  value)
+  {
+    return std::count(begin, end, value);
+  }
+
+#if defined(ETL_SIMD)
+  //***************************************************************************
+  /// count
+  /// Vectorised for contiguous ranges of integral types.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/count"></a>
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<__private_algorithm__::is_simd_type<typename etl::remove_cv<T>::type>::value, ptrdiff_t>::type
+    count(T*                                      begin,
+          T*                                      end,
+          const typename etl::remove_cv<T>::type& value)
+  {
+    typedef typename etl::remove_cv<T>::type value_t;
+
+    return __private_algorithm__::count<value_t>(begin, end, value);
+  }
+#endif
+
   //***************************************************************************
   /// find_if_not
   ///\ingroup algorithm
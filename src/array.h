@@ -35,6 +35,7 @@ SOFTWARE.
 #include <functional>
 #include <algorithm>
 #include <stddef.h>
+#include <string.h>
 
 #include "exception.h"
 #include "type_traits.h"
@@ -49,6 +50,41 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace __private_array__
+  {
+    //*************************************************************************
+    /// Copies a range of elements to a destination that may overlap it.
+    /// Trivially copy assignable types are copied with a single memmove.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_trivially_copy_assignable<T>::value, T*>::type
+      shift(T* first, T* last, T* destination)
+    {
+      memmove(static_cast<void*>(destination), static_cast<const void*>(first), (last - first) * sizeof(T));
+
+      return destination + (last - first);
+    }
+
+    //*************************************************************************
+    /// Copies a range of elements to a destination that may overlap it.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<!etl::is_trivially_copy_assignable<T>::value, T*>::type
+      shift(T* first, T* last, T* destination)
+    {
+      if (destination < first)
+      {
+        return std::copy(first, last, destination);
+      }
+      else
+      {
+        std::copy_backward(first, last, destination + (last - first));
+
+        return destination + (last - first);
+      }
+    }
+  }
+
   //***************************************************************************
   ///\ingroup array
   /// The base class for array exceptions.
@@ -403,7 +439,7 @@ namespace etl
     {
       iterator p = const_cast<iterator>(position);
 
-      std::copy_backward(p, end() - 1, end());
+      __private_array__::shift(p, end() - 1, p + 1);
       *p = value;
 
       return p;
@@ -440,7 +476,7 @@ namespace etl
       if (source_size < destination_space)
       {
         size_t length = SIZE - (std::distance(begin(), p) + source_size);
-        std::copy_backward(p, p + length, end());
+        __private_array__::shift(p, p + length, end() - length);
       }
 
       // Copy from the range.
@@ -467,7 +503,7 @@ namespace etl
     iterator erase(const_iterator position)
     {
       iterator p = const_cast<iterator>(position);
-      std::copy(p + 1, end(), p);
+      __private_array__::shift(p + 1, end(), p);
 
       return p;
     }
@@ -492,7 +528,7 @@ namespace etl
     iterator erase(const_iterator first, const_iterator last)
     {
       iterator p = const_cast<iterator>(first);
-      std::copy(last, cend(), p);
+      __private_array__::shift(const_cast<iterator>(last), end(), p);
       return p;
     }
 
@@ -515,7 +551,7 @@ namespace etl
     {
       iterator p = const_cast<iterator>(position);
 
-      std::copy(p + 1, end(), p);
+      __private_array__::shift(p + 1, end(), p);
       back() = value;
 
       return p;
@@ -541,7 +577,7 @@ namespace etl
     {
       iterator p = const_cast<iterator>(first);
 
-      p = std::copy(last, cend(), p);
+      p = __private_array__::shift(const_cast<iterator>(last), end(), p);
       std::fill(p, end(), value);
 
       return const_cast<iterator>(first);
@@ -44,10 +44,12 @@ SOFTWARE.
 #include "alignment.h"
 #include "array.h"
 #include "algorithm.h"
+#include "memory.h"
 #include "type_traits.h"
 #include "error_handler.h"
 #include "integral_limits.h"
 #include "exception.h"
+#include "private/string_search.h"
 
 #define ETL_FILE "27"
 
@@ -733,7 +735,7 @@ namespace etl
         {
           // Insert in the middle.
           ++current_size;
-          std::copy_backward(insert_position, end() - 1, end());
+          etl::relocate(insert_position, end() - 1, insert_position + 1);
           *insert_position = value;
         }
         else
@@ -749,7 +751,7 @@ namespace etl
         if (position != end())
         {
           // Insert in the middle.
-          std::copy_backward(insert_position, end() - 1, end());
+          etl::relocate(insert_position, end() - 1, insert_position + 1);
           *insert_position = value;
         }
 
@@ -813,7 +815,7 @@ namespace etl
           current_size += shift_amount;
         }
 
-        std::copy_backward(insert_position, insert_position + characters_to_shift, begin() + to_position + characters_to_shift);
+        etl::relocate(insert_position, insert_position + characters_to_shift, begin() + to_position);
         std::fill(insert_position, insert_position + shift_amount, value);
       }
 
@@ -877,7 +879,7 @@ namespace etl
           current_size += shift_amount;
         }
 
-        std::copy_backward(position, position + characters_to_shift, begin() + to_position + characters_to_shift);
+        etl::relocate(position, position + characters_to_shift, begin() + to_position);
 
         while (first != last)
         {
@@ -986,7 +988,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
+      etl::relocate(i_element + 1, end(), i_element);
       p_buffer[--current_size] = 0;
 
       return i_element;
@@ -1002,7 +1004,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator first, iterator last)
     {
-      std::copy(last, end(), first);
+      etl::relocate(last, end(), first);
       size_t n_delete = std::distance(first, last);
 
       current_size -= n_delete;
@@ -1044,21 +1046,7 @@ namespace etl
     //*********************************************************************
     size_t find(const ibasic_string<T>& str, size_t pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = std::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return find(str.data(), pos, str.size());
     }
 
     //*********************************************************************
@@ -1068,23 +1056,7 @@ namespace etl
     //*********************************************************************
     size_t find(const_pointer s, size_t pos = 0) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return find(s, pos, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1095,22 +1067,25 @@ namespace etl
     //*********************************************************************
     size_t find(const_pointer s, size_t pos, size_t n) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s) - n) > size())
+      if ((pos > size()) || (n > (size() - pos)))
       {
         return npos;
       }
-#endif
 
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + n);
+      if (n == 0)
+      {
+        return pos;
+      }
+
+      const_pointer p_match = __private_basic_string__::search(p_buffer + pos, p_buffer + size(), s, n);
 
-      if (iposition == end())
+      if (p_match == (p_buffer + size()))
       {
         return npos;
       }
       else
       {
-        return std::distance(begin(), iposition);
+        return p_match - p_buffer;
       }
     }
 
@@ -1140,28 +1115,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const ibasic_string<T>& str, size_t position = npos) const
     {
-      if ((str.size()) > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator iposition = std::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - std::distance(rbegin(), iposition);
-      }
+      return rfind(str.data(), position, str.size());
     }
 
     //*********************************************************************
@@ -1171,33 +1125,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const_pointer s, size_t position = npos) const
     {
-      size_t length = etl::strlen(s);
-
-      if (length > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = std::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length - std::distance(rbegin(), iposition);
-      }
+      return rfind(s, position, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1212,25 +1140,23 @@ namespace etl
         return npos;
       }
 
-      if (position >= size())
+      position = std::min(position, size() - length);
+
+      if (length == 0)
       {
-        position = size();
+        return position;
       }
 
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = std::search(rbegin() + position, rend(), srbegin, srend);
+      const_pointer p_last  = p_buffer + position + length;
+      const_pointer p_match = __private_basic_string__::search_last(p_buffer, p_last, s, length);
 
-      if (iposition == rend())
+      if (p_match == p_last)
       {
         return npos;
       }
       else
       {
-        return size() - length - std::distance(rbegin(), iposition);
+        return p_match - p_buffer;
       }
     }
 
@@ -1562,14 +1488,13 @@ namespace etl
     {
       if (position < size())
       {
+        const __private_basic_string__::char_set<T> chars(s, n);
+
         for (size_t i = position; i < size(); ++i)
         {
-          for (size_t j = 0; j < n; ++j)
+          if (chars.contains(p_buffer[i]))
           {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
+            return i;
           }
         }
       }
@@ -1633,16 +1558,15 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
+      const __private_basic_string__::char_set<T> chars(s, n);
+
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        for (size_t j = 0; j < n; ++j)
+        if (chars.contains(p_buffer[position]))
         {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
+          return position;
         }
 
         ++it;
@@ -1712,19 +1636,11 @@ namespace etl
     {
       if (position < size())
       {
+        const __private_basic_string__::char_set<T> chars(s, n);
+
         for (size_t i = position; i < size(); ++i)
         {
-          bool found = false;
-
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
+          if (!chars.contains(p_buffer[i]))
           {
             return i;
           }
@@ -1790,21 +1706,13 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
+      const __private_basic_string__::char_set<T> chars(s, n);
+
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        bool found = false;
-
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
+        if (!chars.contains(p_buffer[position]))
         {
           return position;
         }
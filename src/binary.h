@@ -46,8 +46,68 @@ SOFTWARE.
 #include "smallest.h"
 #include "platform.h"
 
+#if defined(ETL_COMPILER_MICROSOFT)
+  #include <intrin.h>
+#endif
+
 namespace etl
 {
+  namespace __private_binary__
+  {
+    //*************************************************************************
+    /// Bit counting intrinsics, where the compiler supplies them.
+    /// The trailing zero functions must not be called with zero.
+    //*************************************************************************
+#if defined(ETL_COMPILER_GCC) && !defined(ETL_NO_BIT_INTRINSICS)
+  #define ETL_BINARY_POPCOUNT_INTRINSIC
+  #define ETL_BINARY_CTZ_INTRINSIC
+
+    inline size_t popcount_32(uint32_t value)
+    {
+      return size_t(__builtin_popcount(value));
+    }
+
+    inline size_t popcount_64(uint64_t value)
+    {
+      return size_t(__builtin_popcountll(value));
+    }
+
+    inline uint_least8_t ctz_32(uint32_t value)
+    {
+      return uint_least8_t(__builtin_ctz(value));
+    }
+
+    inline uint_least8_t ctz_64(uint64_t value)
+    {
+      return uint_least8_t(__builtin_ctzll(value));
+    }
+#elif defined(ETL_COMPILER_MICROSOFT) && !defined(ETL_NO_BIT_INTRINSICS)
+  #define ETL_BINARY_CTZ_INTRINSIC
+
+    inline uint_least8_t ctz_32(uint32_t value)
+    {
+      unsigned long index;
+      _BitScanForward(&index, value);
+      return uint_least8_t(index);
+    }
+
+    inline uint_least8_t ctz_64(uint64_t value)
+    {
+      unsigned long index;
+  #if defined(_M_X64) || defined(_M_ARM64)
+      _BitScanForward64(&index, value);
+  #else
+      if (_BitScanForward(&index, uint32_t(value)) == 0)
+      {
+        _BitScanForward(&index, uint32_t(value >> 32));
+        index += 32;
+      }
+  #endif
+      return uint_least8_t(index);
+    }
+#endif
+  }
+
   //***************************************************************************
   /// Maximum value that can be contained in N bits.
   //***************************************************************************
@@ -352,11 +412,15 @@ namespace etl
 #if ETL_8BIT_SUPPORT
   //***************************************************************************
   /// Count set bits. 8 bits.
+  /// Uses an intrinsic where available.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint8_t>::value, size_t>::type
   count_bits(T value)
   {
+#if defined(ETL_BINARY_POPCOUNT_INTRINSIC)
+    return __private_binary__::popcount_32(uint32_t(typename etl::make_unsigned<T>::type(value)));
+#else
     uint32_t count;
     static const int S[] = { 1, 2, 4 };
     static const uint8_t B[] = { 0x55, 0x33, 0x0F };
@@ -366,16 +430,21 @@ namespace etl
     count = ((count >> S[2]) + count) & B[2];
 
     return count;
+#endif
   }
 #endif
 
   //***************************************************************************
   /// Count set bits. 16 bits.
+  /// Uses an intrinsic where available.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint16_t>::value, size_t>::type
   count_bits(T value)
   {
+#if defined(ETL_BINARY_POPCOUNT_INTRINSIC)
+    return __private_binary__::popcount_32(uint32_t(typename etl::make_unsigned<T>::type(value)));
+#else
     uint32_t count;
     static const int S[] = { 1, 2, 4, 8 };
     static const uint16_t B[] = { 0x5555, 0x3333, 0x0F0F, 0x00FF };
@@ -386,15 +455,20 @@ namespace etl
     count = ((count >> S[3]) + count) & B[3];
 
     return count;
+#endif
   }
 
   //***************************************************************************
   /// Count set bits. 32 bits.
+  /// Uses an intrinsic where available.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint32_t>::value, size_t>::type
   count_bits(T value)
   {
+#if defined(ETL_BINARY_POPCOUNT_INTRINSIC)
+    return __private_binary__::popcount_32(uint32_t(typename etl::make_unsigned<T>::type(value)));
+#else
     uint32_t count;
 
     value = value - ((value >> 1) & 0x55555555);
@@ -402,15 +476,20 @@ namespace etl
     count = (((value + (value >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
 
     return count;
+#endif
   }
 
   //***************************************************************************
   /// Count set bits. 64 bits.
+  /// Uses an intrinsic where available.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint64_t>::value, size_t>::type
   count_bits(T value)
   {
+#if defined(ETL_BINARY_POPCOUNT_INTRINSIC)
+    return __private_binary__::popcount_64(uint64_t(typename etl::make_unsigned<T>::type(value)));
+#else
     uint64_t count;
     static const int S[] = { 1, 2, 4, 8, 16, 32 };
     static const uint64_t B[] = { 0x5555555555555555, 0x3333333333333333, 0x0F0F0F0F0F0F0F0F, 0x00FF00FF00FF00FF, 0x0000FFFF0000FFFF, 0x00000000FFFFFFFF };
@@ -423,6 +502,7 @@ namespace etl
     count = ((count >> S[5]) + count) & B[5];
 
     return size_t(count);
+#endif
   }
 
 #if ETL_8BIT_SUPPORT
@@ -562,13 +642,22 @@ namespace etl
 
 #if ETL_8BIT_SUPPORT
   //***************************************************************************
-  /// Count trailing zeros. bit.
-  /// Uses a binary search.
+  /// Count trailing zeros. 8bit.
+  /// Uses an intrinsic where available, otherwise a binary search.
+  /// Returns the number of bits in the type for zero.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint8_t>::value, uint_least8_t>::type
   count_trailing_zeros(T value)
   {
+    if (value == 0)
+    {
+      return 8;
+    }
+
+#if defined(ETL_BINARY_CTZ_INTRINSIC)
+    return __private_binary__::ctz_32(uint32_t(typename etl::make_unsigned<T>::type(value)));
+#else
       uint_least8_t count;
 
       if (value & 0x1)
@@ -595,17 +684,27 @@ namespace etl
       }
 
       return count;
+#endif
   }
 #endif
 
   //***************************************************************************
   /// Count trailing zeros. 16bit.
-  /// Uses a binary search.
+  /// Uses an intrinsic where available, otherwise a binary search.
+  /// Returns the number of bits in the type for zero.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint16_t>::value, uint_least8_t>::type
    count_trailing_zeros(T value)
   {
+    if (value == 0)
+    {
+      return 16;
+    }
+
+#if defined(ETL_BINARY_CTZ_INTRINSIC)
+    return __private_binary__::ctz_32(uint32_t(typename etl::make_unsigned<T>::type(value)));
+#else
       uint_least8_t count;
 
       if (value & 0x1)
@@ -638,16 +737,26 @@ namespace etl
       }
 
       return count;
+#endif
   }
 
   //***************************************************************************
   /// Count trailing zeros. 32bit.
-  /// Uses a binary search.
+  /// Uses an intrinsic where available, otherwise a binary search.
+  /// Returns the number of bits in the type for zero.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint32_t>::value, uint_least8_t>::type
    count_trailing_zeros(T value)
   {
+    if (value == 0)
+    {
+      return 32;
+    }
+
+#if defined(ETL_BINARY_CTZ_INTRINSIC)
+    return __private_binary__::ctz_32(uint32_t(typename etl::make_unsigned<T>::type(value)));
+#else
       uint_least8_t count;
 
       if (value & 0x1)
@@ -686,16 +795,26 @@ namespace etl
       }
 
       return count;
+#endif
   }
 
   //***************************************************************************
   /// Count trailing zeros. 64bit.
-  /// Uses a binary search.
+  /// Uses an intrinsic where available, otherwise a binary search.
+  /// Returns the number of bits in the type for zero.
   //***************************************************************************
   template <typename T>
   typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint64_t>::value, uint_least8_t>::type
    count_trailing_zeros(T value)
   {
+    if (value == 0)
+    {
+      return 64;
+    }
+
+#if defined(ETL_BINARY_CTZ_INTRINSIC)
+    return __private_binary__::ctz_64(uint64_t(typename etl::make_unsigned<T>::type(value)));
+#else
       uint_least8_t count;
 
       if (value & 0x1)
@@ -739,6 +858,194 @@ namespace etl
         count -= value & 0x1;
       }
 
+      return count;
+#endif
+  }
+
+#if ETL_8BIT_SUPPORT
+  //***************************************************************************
+  /// Count leading zeros. 8bit.
+  /// Uses a binary search.
+  /// Returns the number of bits in the type for zero.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint8_t>::value, uint_least8_t>::type
+    count_leading_zeros(T value)
+  {
+      if (value == 0)
+      {
+        return 8;
+      }
+
+      uint_least8_t count = 0;
+
+      if ((value & 0xF0) == 0)
+      {
+        value <<= 4;
+        count += 4;
+      }
+
+      if ((value & 0xC0) == 0)
+      {
+        value <<= 2;
+        count += 2;
+      }
+
+      if ((value & 0x80) == 0)
+      {
+        value <<= 1;
+        count += 1;
+      }
+
+      return count;
+  }
+
+#endif
+
+  //***************************************************************************
+  /// Count leading zeros. 16bit.
+  /// Uses a binary search.
+  /// Returns the number of bits in the type for zero.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint16_t>::value, uint_least8_t>::type
+    count_leading_zeros(T value)
+  {
+      if (value == 0)
+      {
+        return 16;
+      }
+
+      uint_least8_t count = 0;
+
+      if ((value & 0xFF00) == 0)
+      {
+        value <<= 8;
+        count += 8;
+      }
+
+      if ((value & 0xF000) == 0)
+      {
+        value <<= 4;
+        count += 4;
+      }
+
+      if ((value & 0xC000) == 0)
+      {
+        value <<= 2;
+        count += 2;
+      }
+
+      if ((value & 0x8000) == 0)
+      {
+        value <<= 1;
+        count += 1;
+      }
+
+      return count;
+  }
+
+  //***************************************************************************
+  /// Count leading zeros. 32bit.
+  /// Uses a binary search.
+  /// Returns the number of bits in the type for zero.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint32_t>::value, uint_least8_t>::type
+    count_leading_zeros(T value)
+  {
+      if (value == 0)
+      {
+        return 32;
+      }
+
+      uint_least8_t count = 0;
+
+      if ((value & 0xFFFF0000) == 0)
+      {
+        value <<= 16;
+        count += 16;
+      }
+
+      if ((value & 0xFF000000) == 0)
+      {
+        value <<= 8;
+        count += 8;
+      }
+
+      if ((value & 0xF0000000) == 0)
+      {
+        value <<= 4;
+        count += 4;
+      }
+
+      if ((value & 0xC0000000) == 0)
+      {
+        value <<= 2;
+        count += 2;
+      }
+
+      if ((value & 0x80000000) == 0)
+      {
+        value <<= 1;
+        count += 1;
+      }
+
+      return count;
+  }
+
+  //***************************************************************************
+  /// Count leading zeros. 64bit.
+  /// Uses a binary search.
+  /// Returns the number of bits in the type for zero.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_same<typename etl::make_unsigned<T>::type, uint64_t>::value, uint_least8_t>::type
+    count_leading_zeros(T value)
+  {
+      if (value == 0)
+      {
+        return 64;
+      }
+
+      uint_least8_t count = 0;
+
+      if ((value & 0xFFFFFFFF00000000ULL) == 0)
+      {
+        value <<= 32;
+        count += 32;
+      }
+
+      if ((value & 0xFFFF000000000000ULL) == 0)
+      {
+        value <<= 16;
+        count += 16;
+      }
+
+      if ((value & 0xFF00000000000000ULL) == 0)
+      {
+        value <<= 8;
+        count += 8;
+      }
+
+      if ((value & 0xF000000000000000ULL) == 0)
+      {
+        value <<= 4;
+        count += 4;
+      }
+
+      if ((value & 0xC000000000000000ULL) == 0)
+      {
+        value <<= 2;
+        count += 2;
+      }
+
+      if ((value & 0x8000000000000000ULL) == 0)
+      {
+        value <<= 1;
+        count += 1;
+      }
+
       return count;
   }
 
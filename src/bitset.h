@@ -45,6 +45,7 @@ SOFTWARE.
 #include "exception.h"
 #include "integral_limits.h"
 #include "binary.h"
+#include "smallest.h"
 
 #ifdef ETL_COMPILER_MICROSOFT
 #undef min
@@ -101,8 +102,10 @@ namespace etl
   protected:
 
     // The type used for each element in the array.
+    // Defaults to the native word size, so that whole words are tested,
+    // counted and shifted at a time.
 #if !defined(ETL_BITSET_ELEMENT_TYPE)
-    typedef uint_least8_t element_t;
+    typedef etl::smallest_uint_for_bits<etl::integral_limits<size_t>::bits>::type element_t;
 #else
     typedef ETL_BITSET_ELEMENT_TYPE element_t;
 #endif
@@ -448,6 +451,11 @@ namespace etl
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
+      if (position >= NBITS)
+      {
+        return ibitset::npos;
+      }
+
       // Where to start.
       size_t index;
       size_t bit;
@@ -463,45 +471,27 @@ namespace etl
         bit = position & (BITS_PER_ELEMENT - 1);
       }
 
-      element_t mask = 1 << bit;
+      // Searching for a clear bit is searching the inverse for a set bit.
+      // The bits below the start position are masked off.
+      const element_t invert = state ? ALL_CLEAR : ALL_SET;
+
+      element_t value = element_t((pdata[index] ^ invert) & element_t(ALL_SET << bit));
 
       // For each element in the bitset...
-      while (index < SIZE)
+      while (value == 0)
       {
-        element_t value = pdata[index];
-
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-          (!state && (value != ALL_SET)))
+        if (++index == SIZE)
         {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
+          return ibitset::npos;
         }
-        else
-        {
-          position += BITS_PER_ELEMENT;
-        }
-
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
 
-        ++index;
+        value = element_t(pdata[index] ^ invert);
       }
 
-      return ibitset::npos;
+      position = (index * BITS_PER_ELEMENT) + etl::count_trailing_zeros(value);
+
+      // The unused bits of the last element are always clear.
+      return (position < NBITS) ? position : size_t(ibitset::npos);
     }
 
     //*************************************************************************
@@ -564,24 +554,37 @@ namespace etl
     //*************************************************************************
     ibitset& operator<<=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
       {
-        pdata[0] <<= shift;
+        reset();
+      }
+      else if (SIZE == 1)
+      {
+        pdata[0] = element_t(pdata[0] << shift) & TOP_MASK;
       }
       else
       {
-        size_t source = NBITS - shift - 1;
-        size_t destination = NBITS - 1;
+        const size_t element_shift = shift >> log2<BITS_PER_ELEMENT>::value;
+        const size_t bit_shift     = shift & (BITS_PER_ELEMENT - 1);
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+        // Work down from the top, so that no source element is overwritten before it is read.
+        for (size_t i = SIZE - 1; i > element_shift; --i)
         {
-          set(destination--, test(source--));
-        }
+          element_t value = element_t(pdata[i - element_shift] << bit_shift);
 
-        for (size_t i = 0; i < shift; ++i)
-        {
-          reset(destination--);
+          if (bit_shift != 0)
+          {
+            value |= element_t(pdata[i - element_shift - 1] >> (BITS_PER_ELEMENT - bit_shift));
+          }
+
+          pdata[i] = value;
         }
+
+        pdata[element_shift] = element_t(pdata[0] << bit_shift);
+
+        std::fill_n(pdata, element_shift, element_t(ALL_CLEAR));
+
+        pdata[SIZE - 1] &= TOP_MASK;
       }
 
       return *this;
@@ -592,24 +595,36 @@ namespace etl
     //*************************************************************************
     ibitset& operator>>=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
+      {
+        reset();
+      }
+      else if (SIZE == 1)
       {
         pdata[0] >>= shift;
       }
       else
       {
-        size_t source = shift;
-        size_t destination = 0;
+        const size_t element_shift = shift >> log2<BITS_PER_ELEMENT>::value;
+        const size_t bit_shift     = shift & (BITS_PER_ELEMENT - 1);
+        const size_t last          = SIZE - 1 - element_shift;
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+        // Work up from the bottom, so that no source element is overwritten before it is read.
+        for (size_t i = 0; i < last; ++i)
         {
-          set(destination++, test(source++));
-        }
+          element_t value = element_t(pdata[i + element_shift] >> bit_shift);
 
-        for (size_t i = 0; i < shift; ++i)
-        {
-          reset(destination++);
+          if (bit_shift != 0)
+          {
+            value |= element_t(pdata[i + element_shift + 1] << (BITS_PER_ELEMENT - bit_shift));
+          }
+
+          pdata[i] = value;
         }
+
+        pdata[last] = element_t(pdata[SIZE - 1] >> bit_shift);
+
+        std::fill_n(pdata + last + 1, element_shift, element_t(ALL_CLEAR));
       }
 
       return *this;
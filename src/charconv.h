@@ -0,0 +1,789 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_CHARCONV__
+#define __ETL_CHARCONV__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "enum_type.h"
+#include "radix.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "private/charconv_float.h"
+
+//*****************************************************************************
+///\defgroup charconv charconv
+/// Conversions between numbers and text, in the style of std::to_chars and
+/// std::from_chars, without allocation or the C library.
+/// to_chars appends to an etl::ibasic_string of any character width.
+/// If the string is too small the result is truncated, as for any append.
+/// from_chars reads from a range of characters, a string or a string_view.
+/// Integers may be binary, octal, decimal or hex. Floating point values are
+/// written in the shortest form that reads back as the same value, and read
+/// with correct rounding.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The result status of from_chars.
+  ///\ingroup charconv
+  //***************************************************************************
+  struct chars_status
+  {
+    enum enum_type
+    {
+      ok,
+      invalid_argument,
+      result_out_of_range
+    };
+
+    ETL_DECLARE_ENUM_TYPE(chars_status, uint_least8_t)
+    ETL_ENUM_TYPE(ok,                  "ok")
+    ETL_ENUM_TYPE(invalid_argument,    "invalid_argument")
+    ETL_ENUM_TYPE(result_out_of_range, "result_out_of_range")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The notation for to_chars with a precision.
+  ///\ingroup charconv
+  //***************************************************************************
+  struct chars_format
+  {
+    enum enum_type
+    {
+      scientific = 1, ///< d.ddde+dd, with 'precision' digits after the point.
+      fixed      = 2, ///< ddd.ddd, with 'precision' digits after the point.
+      general    = 3  ///< Fixed or scientific, with 'precision' significant digits, as for printf "%g".
+    };
+
+    ETL_DECLARE_ENUM_TYPE(chars_format, uint_least8_t)
+    ETL_ENUM_TYPE(scientific, "scientific")
+    ETL_ENUM_TYPE(fixed,      "fixed")
+    ETL_ENUM_TYPE(general,    "general")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of from_chars.
+  /// 'ptr' is the first character that is not part of the number, or the
+  /// start of the input if no number was found. The value is only written
+  /// when the status is 'ok'.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename TChar>
+  struct from_chars_result
+  {
+    from_chars_result(const TChar* ptr_, etl::chars_status status_)
+      : ptr(ptr_),
+        status(status_)
+    {
+    }
+
+    const TChar*      ptr;
+    etl::chars_status status;
+  };
+
+  namespace __private_charconv__
+  {
+    extern const char DIGIT_PAIRS[];
+
+    //*************************************************************************
+    /// Appends narrow characters to a string of any width.
+    //*************************************************************************
+    template <typename TChar>
+    void append_narrow(etl::ibasic_string<TChar>& str, const char* first, const char* last)
+    {
+      TChar buffer[32];
+
+      while ((first != last) && !str.truncated())
+      {
+        size_t n = size_t(last - first);
+
+        if (n > (sizeof(buffer) / sizeof(TChar)))
+        {
+          n = sizeof(buffer) / sizeof(TChar);
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          buffer[i] = TChar(first[i]);
+        }
+
+        str.append(buffer, n);
+        first += n;
+      }
+    }
+
+    inline void append_narrow(etl::ibasic_string<char>& str, const char* first, const char* last)
+    {
+      str.append(first, size_t(last - first));
+    }
+
+    //*************************************************************************
+    /// Appends narrow characters to a string of any width, one at a time.
+    /// They are collected in a small buffer, which is appended when it is
+    /// full and on destruction.
+    //*************************************************************************
+    template <typename TChar>
+    class string_sink
+    {
+    public:
+
+      explicit string_sink(etl::ibasic_string<TChar>& str_)
+        : str(str_)
+        , length(0)
+      {
+      }
+
+      ~string_sink()
+      {
+        flush();
+      }
+
+      void operator()(char c)
+      {
+        if (length == sizeof(buffer))
+        {
+          flush();
+        }
+
+        buffer[length++] = c;
+      }
+
+    private:
+
+      void flush()
+      {
+        if ((length != 0) && !str.truncated())
+        {
+          if (str.full())
+          {
+            // Appending to a full string does not set truncated().
+            str.push_back(TChar(0));
+          }
+          else
+          {
+            append_narrow(str, buffer, buffer + length);
+          }
+        }
+
+        length = 0;
+      }
+
+      string_sink(const string_sink&);
+      string_sink& operator =(const string_sink&);
+
+      etl::ibasic_string<TChar>& str;
+      char                       buffer[32];
+      size_t                     length;
+    };
+
+    //*************************************************************************
+    /// The numeric base of a radix. An undefined radix is decimal.
+    //*************************************************************************
+    inline uint_least8_t get_base(etl::radix base)
+    {
+      return (base == etl::radix::undefined) ? uint_least8_t(etl::radix::decimal) : base.get_value();
+    }
+
+    //*************************************************************************
+    /// Is the value negative? Avoids comparing unsigned values with zero.
+    //*************************************************************************
+    template <typename T>
+    bool is_negative(T value, etl::true_type /*is_signed*/)
+    {
+      return value < 0;
+    }
+
+    template <typename T>
+    bool is_negative(T /*value*/, etl::false_type /*is_signed*/)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// Writes the digits of an unsigned value backwards, ending before p_end.
+    /// Decimal is written two digits at a time.
+    ///\return The first digit.
+    //*************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* format_unsigned(TChar* p_end, TUnsigned value, uint_least8_t base)
+    {
+      TChar* p = p_end;
+
+      if (base == 10)
+      {
+        while (value >= 100)
+        {
+          const char* pair = &DIGIT_PAIRS[2 * (value % 100)];
+          value = TUnsigned(value / 100);
+
+          *--p = TChar(pair[1]);
+          *--p = TChar(pair[0]);
+        }
+
+        if (value >= 10)
+        {
+          const char* pair = &DIGIT_PAIRS[2 * value];
+
+          *--p = TChar(pair[1]);
+          *--p = TChar(pair[0]);
+        }
+        else
+        {
+          *--p = TChar('0' + value);
+        }
+      }
+      else
+      {
+        // Binary, octal and hex are shifts and masks.
+        const int      shift = (base == 2) ? 1 : ((base == 8) ? 3 : 4);
+        const unsigned mask  = base - 1U;
+
+        do
+        {
+          *--p = TChar("0123456789abcdef"[unsigned(value) & mask]);
+          value = TUnsigned(value >> shift);
+        } while (value != 0);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// The value of a digit in any base up to 16, or 16 if not a digit.
+    //*************************************************************************
+    template <typename TChar>
+    uint_least8_t digit_value(TChar c)
+    {
+      if ((c >= TChar('0')) && (c <= TChar('9')))
+      {
+        return uint_least8_t(c - TChar('0'));
+      }
+      else if ((c >= TChar('a')) && (c <= TChar('f')))
+      {
+        return uint_least8_t(c - TChar('a') + 10);
+      }
+      else if ((c >= TChar('A')) && (c <= TChar('F')))
+      {
+        return uint_least8_t(c - TChar('A') + 10);
+      }
+      else
+      {
+        return 16;
+      }
+    }
+
+    //*************************************************************************
+    /// Matches the lower case text, ignoring case.
+    ///\return The end of the match, or 0 if it does not match.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* match_text(const TChar* first, const TChar* last, const char* text)
+    {
+      while (*text != 0)
+      {
+        if (first == last)
+        {
+          return 0;
+        }
+
+        TChar c = *first;
+
+        if ((c >= TChar('A')) && (c <= TChar('Z')))
+        {
+          c = TChar(c - TChar('A') + TChar('a'));
+        }
+
+        if (c != TChar(*text))
+        {
+          return 0;
+        }
+
+        ++first;
+        ++text;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Reads "inf", "infinity", "nan" or "nan(chars)", ignoring case.
+    ///\return The end of the text, or 0 if none was found.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    const TChar* parse_special(const TChar* first, const TChar* last, T& value)
+    {
+      typedef float_traits<T>                   traits;
+      typedef typename float_traits<T>::bits_t bits_t;
+
+      const TChar* p;
+
+      if ((p = match_text(first, last, "inf")) != 0)
+      {
+        const TChar* p_infinity = match_text(p, last, "inity");
+
+        value = from_bits<T>(bits_t(traits::MAX_EXPONENT_FIELD) << (traits::SIGNIFICAND_BITS - 1));
+
+        return (p_infinity != 0) ? p_infinity : p;
+      }
+
+      if ((p = match_text(first, last, "nan")) != 0)
+      {
+        // An optional sequence of letters, digits and underscores in brackets.
+        if ((p != last) && (*p == TChar('(')))
+        {
+          const TChar* q = p + 1;
+
+          while ((q != last) &&
+                 (((*q >= TChar('0')) && (*q <= TChar('9'))) ||
+                  ((*q >= TChar('a')) && (*q <= TChar('z'))) ||
+                  ((*q >= TChar('A')) && (*q <= TChar('Z'))) ||
+                  (*q == TChar('_'))))
+          {
+            ++q;
+          }
+
+          if ((q != last) && (*q == TChar(')')))
+          {
+            p = q + 1;
+          }
+        }
+
+        value = from_bits<T>((bits_t(traits::MAX_EXPONENT_FIELD) << (traits::SIGNIFICAND_BITS - 1)) |
+                             (bits_t(1) << (traits::SIGNIFICAND_BITS - 2)));
+
+        return p;
+      }
+
+      return 0;
+    }
+
+    //*************************************************************************
+    /// Reads a floating point value.
+    /// [-](digits[.digits]|.digits)[(e|E)[+|-]digits], inf, infinity or nan.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::from_chars_result<TChar> parse_float(const TChar* first, const TChar* last, T& value)
+    {
+      typedef float_traits<T> traits;
+
+      const TChar* p = first;
+
+      bool negative = false;
+
+      if ((p != last) && (*p == TChar('-')))
+      {
+        negative = true;
+        ++p;
+      }
+
+      T special;
+      const TChar* p_special = parse_special(p, last, special);
+
+      if (p_special != 0)
+      {
+        value = negative ? -special : special;
+
+        return etl::from_chars_result<TChar>(p_special, etl::chars_status::ok);
+      }
+
+      const TChar* p_mantissa = p;
+
+      uint64_t significand = 0;
+      int      digits      = 0;
+      int      exponent    = 0;
+      bool     inexact     = false;
+      bool     found       = false;
+
+      // The integral part.
+      while ((p != last) && (*p >= TChar('0')) && (*p <= TChar('9')))
+      {
+        const unsigned digit = unsigned(*p - TChar('0'));
+        found = true;
+
+        if ((significand != 0) || (digit != 0))
+        {
+          if (digits < MAX_SIGNIFICAND_DIGITS)
+          {
+            significand = (significand * 10) + digit;
+            ++digits;
+          }
+          else
+          {
+            ++exponent;
+            inexact = inexact || (digit != 0);
+          }
+        }
+
+        ++p;
+      }
+
+      // The fractional part.
+      if ((p != last) && (*p == TChar('.')))
+      {
+        ++p;
+
+        while ((p != last) && (*p >= TChar('0')) && (*p <= TChar('9')))
+        {
+          const unsigned digit = unsigned(*p - TChar('0'));
+          found = true;
+
+          if ((significand != 0) || (digit != 0))
+          {
+            if (digits < MAX_SIGNIFICAND_DIGITS)
+            {
+              significand = (significand * 10) + digit;
+              ++digits;
+              --exponent;
+            }
+            else
+            {
+              inexact = inexact || (digit != 0);
+            }
+          }
+          else
+          {
+            // A leading zero.
+            --exponent;
+          }
+
+          ++p;
+        }
+      }
+
+      if (!found)
+      {
+        return etl::from_chars_result<TChar>(first, etl::chars_status::invalid_argument);
+      }
+
+      const TChar* p_mantissa_end = p;
+
+      // The exponent. Only consumed if it has digits.
+      if ((p != last) && ((*p == TChar('e')) || (*p == TChar('E'))))
+      {
+        const TChar* q = p + 1;
+        bool exponent_negative = false;
+
+        if ((q != last) && ((*q == TChar('+')) || (*q == TChar('-'))))
+        {
+          exponent_negative = (*q == TChar('-'));
+          ++q;
+        }
+
+        if ((q != last) && (*q >= TChar('0')) && (*q <= TChar('9')))
+        {
+          int explicit_exponent = 0;
+
+          while ((q != last) && (*q >= TChar('0')) && (*q <= TChar('9')))
+          {
+            // Saturate. Anything this large is out of range anyway.
+            if (explicit_exponent < 100000)
+            {
+              explicit_exponent = (explicit_exponent * 10) + int(*q - TChar('0'));
+            }
+
+            ++q;
+          }
+
+          exponent += exponent_negative ? -explicit_exponent : explicit_exponent;
+          p = q;
+        }
+      }
+
+      if (significand == 0)
+      {
+        value = negative ? -T(0) : T(0);
+
+        return etl::from_chars_result<TChar>(p, etl::chars_status::ok);
+      }
+
+      // The value is in [10^(magnitude - 1), 10^magnitude).
+      const int magnitude = exponent + digits;
+
+      T result;
+
+      if ((magnitude > traits::MAX_DECIMAL_MAGNITUDE) ||
+          (magnitude <= traits::MIN_DECIMAL_MAGNITUDE) ||
+          !decimal_to_binary(significand, exponent, inexact, p_mantissa, p_mantissa_end, result))
+      {
+        return etl::from_chars_result<TChar>(p, etl::chars_status::result_out_of_range);
+      }
+
+      value = negative ? -result : result;
+
+      return etl::from_chars_result<TChar>(p, etl::chars_status::ok);
+    }
+  }
+
+  //***************************************************************************
+  /// Appends an integral value to a string.
+  /// Negative values are preceded by '-'. Binary, octal and hex have no prefix
+  /// and use lower case digits.
+  ///\param str   The string to append to.
+  ///\param value The value.
+  ///\param base  The radix. Default decimal.
+  ///\return A reference to the string.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value, etl::ibasic_string<TChar>&>::type
+    to_chars(etl::ibasic_string<TChar>& str, T value, etl::radix base = etl::radix::decimal)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    // Enough for a sign and the binary digits.
+    TChar  buffer[etl::integral_limits<T>::bits + 1];
+    TChar* p_end = buffer + (sizeof(buffer) / sizeof(TChar));
+
+    unsigned_t magnitude = unsigned_t(value);
+
+    const bool negative = __private_charconv__::is_negative(value, etl::integral_constant<bool, etl::is_signed<T>::value>());
+
+    if (negative)
+    {
+      magnitude = unsigned_t(unsigned_t(0) - magnitude);
+    }
+
+    TChar* p = __private_charconv__::format_unsigned(p_end, magnitude, __private_charconv__::get_base(base));
+
+    if (negative)
+    {
+      *--p = TChar('-');
+    }
+
+    str.append(p, size_t(p_end - p));
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Appends a float or double to a string, in the shortest form that reads
+  /// back as the same value. Fixed notation is used unless scientific is
+  /// shorter, as for std::to_chars with no format.
+  /// Infinity and NaN are written as "inf" and "nan".
+  ///\param str   The string to append to.
+  ///\param value The value.
+  ///\return A reference to the string.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<__private_charconv__::is_float<T>::value, etl::ibasic_string<TChar>&>::type
+    to_chars(etl::ibasic_string<TChar>& str, T value)
+  {
+    // Enough for "-d.ddddddddddddddddde-ddd".
+    TChar  buffer[32];
+    TChar* p_end = __private_charconv__::format_float(buffer, value);
+
+    str.append(buffer, size_t(p_end - buffer));
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Appends a float or double to a string, with a precision.
+  /// The digits are exact, rounded half to even, for any precision.
+  /// A negative precision is 6, as for printf.
+  ///\param str       The string to append to.
+  ///\param value     The value.
+  ///\param format    Fixed, scientific or general.
+  ///\param precision Digits after the point, or significant digits for general.
+  ///\return A reference to the string.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<__private_charconv__::is_float<T>::value, etl::ibasic_string<TChar>&>::type
+    to_chars(etl::ibasic_string<TChar>& str, T value, etl::chars_format format, int precision)
+  {
+    if (precision <= __private_charconv__::precision::MAX_PRECISION)
+    {
+      char  buffer[__private_charconv__::precision::MAX_DIGITS + 8];
+      char* p_end = __private_charconv__::format_float_precision(buffer, value, format.get_value(), precision, false, false);
+
+      __private_charconv__::append_narrow(str, buffer, p_end);
+    }
+    else
+    {
+      __private_charconv__::string_sink<TChar> sink(str);
+
+      __private_charconv__::format_float_precision_to(sink, value, format.get_value(), precision, false, false);
+    }
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Reads an integral value.
+  /// An optional '-' is accepted for signed types. No '+', prefix or leading
+  /// whitespace is accepted. Digits above 9 may be upper or lower case.
+  ///\param first The first character.
+  ///\param last  One past the last character.
+  ///\param value The value read. Unchanged unless the status is 'ok'.
+  ///\param base  The radix. Default decimal.
+  ///\return The end of the number and the status.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value, etl::radix base = etl::radix::decimal)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    const uint_least8_t radix = __private_charconv__::get_base(base);
+
+    const TChar* p = first;
+
+    bool negative = false;
+
+    if (etl::is_signed<T>::value && (p != last) && (*p == TChar('-')))
+    {
+      negative = true;
+      ++p;
+    }
+
+    // The largest magnitude, -min for negative signed values.
+    const unsigned_t limit = negative ? unsigned_t(unsigned_t(etl::integral_limits<T>::max) + 1U)
+                                      : unsigned_t(etl::integral_limits<T>::max);
+
+    const TChar* p_digits = p;
+    unsigned_t   result   = 0;
+    bool         overflow = false;
+
+    while (p != last)
+    {
+      const uint_least8_t digit = __private_charconv__::digit_value(*p);
+
+      if (digit >= radix)
+      {
+        break;
+      }
+
+      if (!overflow)
+      {
+        if (result > unsigned_t((limit - digit) / radix))
+        {
+          overflow = true;
+        }
+        else
+        {
+          result = unsigned_t((result * radix) + digit);
+        }
+      }
+
+      ++p;
+    }
+
+    if (p == p_digits)
+    {
+      return etl::from_chars_result<TChar>(first, etl::chars_status::invalid_argument);
+    }
+
+    if (overflow)
+    {
+      return etl::from_chars_result<TChar>(p, etl::chars_status::result_out_of_range);
+    }
+
+    value = negative ? T(unsigned_t(unsigned_t(0) - result)) : T(result);
+
+    return etl::from_chars_result<TChar>(p, etl::chars_status::ok);
+  }
+
+  //***************************************************************************
+  /// Reads a float or double, correctly rounded.
+  /// [-](digits[.digits]|.digits)[(e|E)[+|-]digits], "inf", "infinity" or
+  /// "nan", ignoring case. Values that overflow or round to zero are out of range.
+  ///\param first The first character.
+  ///\param last  One past the last character.
+  ///\param value The value read. Unchanged unless the status is 'ok'.
+  ///\return The end of the number and the status.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<__private_charconv__::is_float<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value)
+  {
+    return __private_charconv__::parse_float(first, last, value);
+  }
+
+  //***************************************************************************
+  /// Reads an integral value from a string.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::ibasic_string<TChar>& text, T& value, etl::radix base = etl::radix::decimal)
+  {
+    return etl::from_chars(text.data(), text.data() + text.size(), value, base);
+  }
+
+  //***************************************************************************
+  /// Reads a float or double from a string.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<__private_charconv__::is_float<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::ibasic_string<TChar>& text, T& value)
+  {
+    return etl::from_chars(text.data(), text.data() + text.size(), value);
+  }
+
+  //***************************************************************************
+  /// Reads an integral value from a string_view.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::basic_string_view<TChar>& text, T& value, etl::radix base = etl::radix::decimal)
+  {
+    return etl::from_chars(text.data(), text.data() + text.size(), value, base);
+  }
+
+  //***************************************************************************
+  /// Reads a float or double from a string_view.
+  ///\ingroup charconv
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<__private_charconv__::is_float<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::basic_string_view<TChar>& text, T& value)
+  {
+    return etl::from_chars(text.data(), text.data() + text.size(), value);
+  }
+}
+
+#endif
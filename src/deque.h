@@ -35,6 +35,7 @@ SOFTWARE.
 #include <stdint.h>
 #include <iterator>
 #include <algorithm>
+#include <utility>
 
 #include "container.h"
 #include "alignment.h"
@@ -44,6 +45,7 @@ SOFTWARE.
 #include "debug_count.h"
 #include "algorithm.h"
 #include "type_traits.h"
+#include "memory.h"
 #include "parameter_type.h"
 
 #undef ETL_FILE
@@ -871,29 +873,7 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
-        {
-          // Construct the _begin.
-          create_element_front(*_begin);
-
-          // Move the values.
-          std::copy(_begin + 1, position, _begin);
-
-          // Write the new value.
-          *--position = value;
-        }
-        else
-        {
-          // Construct the _end.
-          create_element_back(*(_end - 1));
-
-          // Move the values.
-          std::copy_backward(position, _end - 2, _end - 1);
-
-          // Write the new value.
-          *position = value;
-        }
+        position = insert_middle(position, value);
       }
 
       return position;
@@ -932,75 +912,7 @@ namespace etl
       }
       else
       {
-        // Non-const insert iterator.
-        position = iterator(insert_position.index, *this, p_buffer);
-
-        // Are we closer to the front?
-        if (distance(_begin, insert_position) <= difference_type(current_size / 2))
-        {
-          size_t n_insert = n;
-          size_t n_move = std::distance(begin(), position);
-          size_t n_create_copy = std::min(n_insert, n_move);
-          size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
-          size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
-          size_t n_copy_old = n_move - n_create_copy;
-
-          // Remember the original start.
-          iterator from = _begin + n_create_copy - 1;
-          iterator to;
-
-          // Create new.
-          for (size_t i = 0; i < n_create_new; ++i)
-          {
-            create_element_front(value);
-          }
-
-          // Create copy.
-          for (size_t i = 0; i < n_create_copy; ++i)
-          {
-            create_element_front(*from--);
-          }
-
-          // Copy old.
-          from = position - n_copy_old;
-          to = _begin + n_create_copy;
-          etl::copy_n(from, n_copy_old, to);
-
-          // Copy new.
-          to = position - n_create_copy;
-          std::fill_n(to, n_copy_new, value);
-
-          position = _begin + n_move;
-        }
-        else
-        {
-          size_t n_insert = n;
-          size_t n_move = std::distance(position, end());
-          size_t n_create_copy = std::min(n_insert, n_move);
-          size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
-          size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
-          size_t n_copy_old = n_move - n_create_copy;
-
-          // Create new.
-          for (size_t i = 0; i < n_create_new; ++i)
-          {
-            create_element_back(value);
-          }
-
-          // Create copy.
-          const_iterator from = position + n_copy_old;
-
-          for (size_t i = 0; i < n_create_copy; ++i)
-          {
-            create_element_back(*from++);
-          }
-
-          // Copy old.
-          std::copy_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
-
-          // Copy new.
-          std::fill_n(position, n_copy_new, value);
-        }
+        position = insert_middle(iterator(insert_position.index, *this, p_buffer), n, value);
       }
 
       return position;
@@ -1040,72 +952,7 @@ namespace etl
       }
       else
       {
-        // Non-const insert iterator.
-        position = iterator(insert_position.index, *this, p_buffer);
-
-        // Are we closer to the front?
-        if (distance(_begin, insert_position) < difference_type(current_size / 2))
-        {
-          size_t n_insert = n;
-          size_t n_move = std::distance(begin(), position);
-          size_t n_create_copy = std::min(n_insert, n_move);
-          size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
-          size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
-          size_t n_copy_old = n_move - n_create_copy;
-
-          // Remember the original start.
-          iterator from;
-          iterator to;
-
-          // Create new.
-          create_element_front(n_create_new, range_begin);
-
-          // Create copy.
-          create_element_front(n_create_copy, _begin + n_create_new);
-
-          // Copy old.
-          from = position - n_copy_old;
-          to = _begin + n_create_copy;
-          etl::copy_n(from, n_copy_old, to);
-
-          // Copy new.
-          to = position - n_create_copy;
-          range_begin += n_create_new;
-          etl::copy_n(range_begin, n_copy_new, to);
-
-          position = _begin + n_move;
-        }
-        else
-        {
-          size_t n_insert = n;
-          size_t n_move = std::distance(position, end());
-          size_t n_create_copy = std::min(n_insert, n_move);
-          size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
-          size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
-          size_t n_copy_old = n_move - n_create_copy;
-
-          // Create new.
-          TIterator item = range_begin + (n - n_create_new);
-          for (size_t i = 0; i < n_create_new; ++i)
-          {
-            create_element_back(*item++);
-          }
-
-          // Create copy.
-          const_iterator from = position + n_copy_old;
-
-          for (size_t i = 0; i < n_create_copy; ++i)
-          {
-            create_element_back(*from++);
-          }
-
-          // Copy old.
-          std::copy_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
-
-          // Copy new.
-          item = range_begin;
-          etl::copy_n(item, n_copy_new, position);
-        }
+        position = insert_middle(iterator(insert_position.index, *this, p_buffer), range_begin, size_t(n));
       }
 
       return position;
@@ -1134,18 +981,7 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (distance(_begin, position) < difference_type(current_size / 2))
-        {
-          std::copy_backward(_begin, position, position + 1);
-          destroy_element_front();
-          ++position;
-        }
-        else
-        {
-          std::copy(position + 1, _end, position);
-          destroy_element_back();
-        }
+        position = erase_middle(position);
       }
 
       return position;
@@ -1188,31 +1024,7 @@ namespace etl
       }
       else
       {
-        // Copy the smallest number of items.
-        // Are we closer to the front?
-        if (distance(_begin, position) < difference_type(current_size / 2))
-        {
-          // Move the items.
-          std::copy_backward(_begin, position, position + length);
-
-          for (size_t i = 0; i < length; ++i)
-          {
-            destroy_element_front();
-          }
-
-          position += length;
-        }
-        else
-          // Must be closer to the back.
-        {
-          // Move the items.
-          std::copy(position + length, _end, position);
-
-          for (size_t i = 0; i < length; ++i)
-          {
-            destroy_element_back();
-          }
-        }
+        position = erase_middle(position, length);
       }
 
       return position;
@@ -1297,6 +1109,159 @@ namespace etl
       destroy_element_front();
     }
 
+    //*************************************************************************
+    /// Adds a range of items to the back of the deque.
+    /// The items are copied in at most two contiguous runs. Trivially copyable
+    /// items are copied with memmove.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if there is not enough space.
+    ///\param first The iterator to the first item.
+    ///\param last  The iterator to the last item + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<is_iterator<TIterator>::value, void>::type
+      push_back(TIterator first, TIterator last)
+    {
+      size_t n = std::distance(first, last);
+
+      ETL_ASSERT(n <= available(), ETL_ERROR(deque_full));
+
+      while (n > 0)
+      {
+        size_t length = std::min(n, BUFFER_SIZE - _end.index);
+
+        TIterator next = first;
+        std::advance(next, length);
+
+        etl::uninitialized_copy(first, next, p_buffer + _end.index);
+
+        first = next;
+        _end += length;
+        current_size += length;
+        construct_count += length;
+        n -= length;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes 'n' items from the front of the deque.
+    /// Trivially destructible items are removed without visiting them.
+    /// If asserts or exceptions are enabled, throws an etl::deque_empty if there are fewer than 'n' items.
+    ///\param n The number of items to remove.
+    //*************************************************************************
+    void pop_front(size_t n)
+    {
+      ETL_ASSERT(n <= size(), ETL_ERROR(deque_empty));
+
+      destroy_elements_front(n);
+    }
+
+    //*************************************************************************
+    /// Copies the first 'n' items out of the deque.
+    /// The items are copied in at most two contiguous runs. Trivially copyable
+    /// items are copied to a pointer with memmove.
+    /// If asserts or exceptions are enabled, throws an etl::deque_out_of_bounds if there are fewer than 'n' items.
+    ///\param destination The destination of the items.
+    ///\param n           The number of items to copy.
+    ///\return An iterator to the end of the copied items.
+    //*************************************************************************
+    template <typename TIterator>
+    TIterator copy_out(TIterator destination, size_t n) const
+    {
+      ETL_ASSERT(n <= size(), ETL_ERROR(deque_out_of_bounds));
+
+      std::pair<const_pointer, size_t> segment = first_segment();
+
+      size_t length = std::min(n, segment.second);
+      destination = std::copy(segment.first, segment.first + length, destination);
+
+      return std::copy(p_buffer, p_buffer + (n - length), destination);
+    }
+
+    //*************************************************************************
+    /// Copies all of the items out of the deque.
+    ///\param destination The destination of the items.
+    ///\return An iterator to the end of the copied items.
+    //*************************************************************************
+    template <typename TIterator>
+    TIterator copy_out(TIterator destination) const
+    {
+      return copy_out(destination, size());
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous run of items, starting at the front.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<pointer, size_t> first_segment()
+    {
+      return std::pair<pointer, size_t>(p_buffer + _begin.index, std::min(current_size, BUFFER_SIZE - _begin.index));
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous run of items, starting at the front.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<const_pointer, size_t> first_segment() const
+    {
+      return std::pair<const_pointer, size_t>(p_buffer + _begin.index, std::min(current_size, BUFFER_SIZE - _begin.index));
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of items, that follows the first when
+    /// the items wrap around the end of the buffer. The length is zero if not.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<pointer, size_t> second_segment()
+    {
+      return std::pair<pointer, size_t>(p_buffer, current_size - first_segment().second);
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of items, that follows the first when
+    /// the items wrap around the end of the buffer. The length is zero if not.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<const_pointer, size_t> second_segment() const
+    {
+      return std::pair<const_pointer, size_t>(p_buffer, current_size - first_segment().second);
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous run of free storage at the back of the deque, so
+    /// that items may be written directly into it, for example by 'read'.
+    /// The items become part of the deque when passed to 'commit_back'.
+    /// The storage is uninitialised; the caller constructs the items.
+    /// If the deque is empty the run starts at the beginning of the storage.
+    /// The items may be read back with 'first_segment' and removed with 'pop_front(n)'.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<pointer, size_t> reserve_back()
+    {
+      if (current_size == 0)
+      {
+        _begin.index = 0;
+        _end.index   = 0;
+      }
+
+      return std::pair<pointer, size_t>(p_buffer + _end.index, free_back_length());
+    }
+
+    //*************************************************************************
+    /// Adds 'n' items, constructed at the start of the run returned by
+    /// 'reserve_back', to the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if 'n'
+    /// is larger than the run.
+    ///\param n The number of items to add.
+    //*************************************************************************
+    void commit_back(size_t n)
+    {
+      ETL_ASSERT(n <= free_back_length(), ETL_ERROR(deque_full));
+
+      _end += n;
+      current_size    += n;
+      construct_count += n;
+    }
+
     //*************************************************************************
     /// Resizes the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full is 'new_size' is too large.
@@ -1520,6 +1485,481 @@ namespace etl
       --construct_count;
     }
 
+    //*********************************************************************
+    /// Destroy 'n' trivially destructible elements at the front.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_destructible<U>::value, void>::type
+      destroy_elements_front(size_t n)
+    {
+      _begin += n;
+      current_size -= n;
+      construct_count -= n;
+    }
+
+    //*********************************************************************
+    /// Destroy 'n' elements at the front.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_destructible<U>::value, void>::type
+      destroy_elements_front(size_t n)
+    {
+      while (n-- > 0)
+      {
+        destroy_element_front();
+      }
+    }
+
+    //*********************************************************************
+    /// The length of the contiguous run of free storage at the back.
+    //*********************************************************************
+    size_t free_back_length() const
+    {
+      return std::min(CAPACITY - current_size, BUFFER_SIZE - _end.index);
+    }
+
+    //*********************************************************************
+    /// Inserts a value between the first and last elements.
+    /// The elements on the shorter side are relocated by memmove.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, iterator>::type
+      insert_middle(iterator position, const value_type& value)
+    {
+      position = open_gap(position, 1);
+      ::new (&(*position)) T(value);
+      ++current_size;
+      ++construct_count;
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Inserts a value between the first and last elements.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, iterator>::type
+      insert_middle(iterator position, const value_type& value)
+    {
+      // Are we closer to the front?
+      if (std::distance(_begin, position) < std::distance(position, _end - 1))
+      {
+        // Construct the _begin.
+        create_element_front(*_begin);
+
+        // Move the values.
+        std::copy(_begin + 1, position, _begin);
+
+        // Write the new value.
+        *--position = value;
+      }
+      else
+      {
+        // Construct the _end.
+        create_element_back(*(_end - 1));
+
+        // Move the values.
+        std::copy_backward(position, _end - 2, _end - 1);
+
+        // Write the new value.
+        *position = value;
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Inserts 'n' copies of a value between the first and last elements.
+    /// The elements on the shorter side are relocated by memmove.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, iterator>::type
+      insert_middle(iterator position, size_t n, const value_type& value)
+    {
+      position = open_gap(position, n);
+
+      iterator item = position;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        ::new (&(*item++)) T(value);
+        ++current_size;
+        ++construct_count;
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Inserts 'n' copies of a value between the first and last elements.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, iterator>::type
+      insert_middle(iterator position, size_t n, const value_type& value)
+    {
+      // Are we closer to the front?
+      if (distance(_begin, position) <= difference_type(current_size / 2))
+      {
+        size_t n_insert = n;
+        size_t n_move = std::distance(begin(), position);
+        size_t n_create_copy = std::min(n_insert, n_move);
+        size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
+        size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
+        size_t n_copy_old = n_move - n_create_copy;
+
+        // Remember the original start.
+        iterator from = _begin + n_create_copy - 1;
+        iterator to;
+
+        // Create new.
+        for (size_t i = 0; i < n_create_new; ++i)
+        {
+          create_element_front(value);
+        }
+
+        // Create copy.
+        for (size_t i = 0; i < n_create_copy; ++i)
+        {
+          create_element_front(*from--);
+        }
+
+        // Copy old.
+        from = position - n_copy_old;
+        to = _begin + n_create_copy;
+        etl::copy_n(from, n_copy_old, to);
+
+        // Copy new.
+        to = position - n_create_copy;
+        std::fill_n(to, n_copy_new, value);
+
+        position = _begin + n_move;
+      }
+      else
+      {
+        size_t n_insert = n;
+        size_t n_move = std::distance(position, end());
+        size_t n_create_copy = std::min(n_insert, n_move);
+        size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
+        size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
+        size_t n_copy_old = n_move - n_create_copy;
+
+        // Create new.
+        for (size_t i = 0; i < n_create_new; ++i)
+        {
+          create_element_back(value);
+        }
+
+        // Create copy.
+        const_iterator from = position + n_copy_old;
+
+        for (size_t i = 0; i < n_create_copy; ++i)
+        {
+          create_element_back(*from++);
+        }
+
+        // Copy old.
+        std::copy_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
+
+        // Copy new.
+        std::fill_n(position, n_copy_new, value);
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Inserts a range between the first and last elements.
+    /// The elements on the shorter side are relocated by memmove.
+    //*********************************************************************
+    template <typename TIterator, typename U = T>
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, iterator>::type
+      insert_middle(iterator position, TIterator range_begin, size_t n)
+    {
+      position = open_gap(position, n);
+
+      iterator item = position;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        ::new (&(*item++)) T(*range_begin);
+        ++range_begin;
+        ++current_size;
+        ++construct_count;
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Inserts a range between the first and last elements.
+    //*********************************************************************
+    template <typename TIterator, typename U = T>
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, iterator>::type
+      insert_middle(iterator position, TIterator range_begin, size_t n)
+    {
+      // Are we closer to the front?
+      if (distance(_begin, position) < difference_type(current_size / 2))
+      {
+        size_t n_insert = n;
+        size_t n_move = std::distance(begin(), position);
+        size_t n_create_copy = std::min(n_insert, n_move);
+        size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
+        size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
+        size_t n_copy_old = n_move - n_create_copy;
+
+        // Remember the original start.
+        iterator from;
+        iterator to;
+
+        // Create new.
+        create_element_front(n_create_new, range_begin);
+
+        // Create copy.
+        create_element_front(n_create_copy, _begin + n_create_new);
+
+        // Copy old.
+        from = position - n_copy_old;
+        to = _begin + n_create_copy;
+        etl::copy_n(from, n_copy_old, to);
+
+        // Copy new.
+        to = position - n_create_copy;
+        range_begin += n_create_new;
+        etl::copy_n(range_begin, n_copy_new, to);
+
+        position = _begin + n_move;
+      }
+      else
+      {
+        size_t n_insert = n;
+        size_t n_move = std::distance(position, end());
+        size_t n_create_copy = std::min(n_insert, n_move);
+        size_t n_create_new = (n_insert > n_create_copy) ? n_insert - n_create_copy : 0;
+        size_t n_copy_new = (n_insert > n_create_new) ? n_insert - n_create_new : 0;
+        size_t n_copy_old = n_move - n_create_copy;
+
+        // Create new.
+        TIterator item = range_begin + (n - n_create_new);
+        for (size_t i = 0; i < n_create_new; ++i)
+        {
+          create_element_back(*item++);
+        }
+
+        // Create copy.
+        const_iterator from = position + n_copy_old;
+
+        for (size_t i = 0; i < n_create_copy; ++i)
+        {
+          create_element_back(*from++);
+        }
+
+        // Copy old.
+        std::copy_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
+
+        // Copy new.
+        item = range_begin;
+        etl::copy_n(item, n_copy_new, position);
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Erases an element between the first and last elements.
+    /// The elements on the shorter side are relocated by memmove.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, iterator>::type
+      erase_middle(iterator position)
+    {
+      (*position).~T();
+      --current_size;
+      --construct_count;
+
+      return close_gap(position, 1);
+    }
+
+    //*********************************************************************
+    /// Erases an element between the first and last elements.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, iterator>::type
+      erase_middle(iterator position)
+    {
+      // Are we closer to the front?
+      if (distance(_begin, position) < difference_type(current_size / 2))
+      {
+        std::copy_backward(_begin, position, position + 1);
+        destroy_element_front();
+        ++position;
+      }
+      else
+      {
+        std::copy(position + 1, _end, position);
+        destroy_element_back();
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Erases a range between the first and last elements.
+    /// The elements on the shorter side are relocated by memmove.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, iterator>::type
+      erase_middle(iterator position, size_t length)
+    {
+      iterator item = position;
+
+      for (size_t i = 0; i < length; ++i)
+      {
+        (*item++).~T();
+        --current_size;
+        --construct_count;
+      }
+
+      return close_gap(position, length);
+    }
+
+    //*********************************************************************
+    /// Erases a range between the first and last elements.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, iterator>::type
+      erase_middle(iterator position, size_t length)
+    {
+      // Copy the smallest number of items.
+      // Are we closer to the front?
+      if (distance(_begin, position) < difference_type(current_size / 2))
+      {
+        // Move the items.
+        std::copy_backward(_begin, position, position + length);
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          destroy_element_front();
+        }
+
+        position += length;
+      }
+      else
+        // Must be closer to the back.
+      {
+        // Move the items.
+        std::copy(position + length, _end, position);
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          destroy_element_back();
+        }
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Opens a gap of 'n' uninitialised elements before position, by
+    /// relocating the elements on the shorter side of it.
+    /// Does not change the size.
+    ///\return An iterator to the start of the gap.
+    //*********************************************************************
+    iterator open_gap(iterator position, size_t n)
+    {
+      size_t n_before = distance(_begin, position);
+      size_t n_after  = distance(position, _end);
+
+      if (n_before <= n_after)
+      {
+        iterator to = _begin - n;
+        relocate_forward(_begin.index, to.index, n_before);
+        _begin = to;
+
+        return _begin + n_before;
+      }
+      else
+      {
+        iterator to = _end + n;
+        relocate_backward(_end.index, to.index, n_after);
+        _end = to;
+
+        return position;
+      }
+    }
+
+    //*********************************************************************
+    /// Closes a gap of 'n' already destroyed elements at position, by
+    /// relocating the elements on the shorter side of it.
+    /// Does not change the size.
+    ///\return An iterator to the element that followed the gap.
+    //*********************************************************************
+    iterator close_gap(iterator position, size_t n)
+    {
+      iterator after = position + n;
+
+      size_t n_before = distance(_begin, position);
+      size_t n_after  = distance(after, _end);
+
+      if (n_before < n_after)
+      {
+        relocate_backward(position.index, after.index, n_before);
+        _begin += n;
+
+        return after;
+      }
+      else
+      {
+        relocate_forward(after.index, position.index, n_after);
+        _end -= n;
+
+        return position;
+      }
+    }
+
+    //*********************************************************************
+    /// Relocates 'n' elements to a lower position in the circular buffer,
+    /// one contiguous run at a time.
+    ///\param from The index of the first element to relocate.
+    ///\param to   The index of the first destination.
+    //*********************************************************************
+    void relocate_forward(size_t from, size_t to, size_t n)
+    {
+      while (n > 0)
+      {
+        size_t length = std::min(n, std::min(BUFFER_SIZE - from, BUFFER_SIZE - to));
+
+        etl::relocate(p_buffer + from, p_buffer + from + length, p_buffer + to);
+
+        from = (from + length == BUFFER_SIZE) ? 0 : from + length;
+        to   = (to + length == BUFFER_SIZE)   ? 0 : to + length;
+        n   -= length;
+      }
+    }
+
+    //*********************************************************************
+    /// Relocates 'n' elements to a higher position in the circular buffer,
+    /// one contiguous run at a time, starting from the last.
+    ///\param from_end The index one past the last element to relocate.
+    ///\param to_end   The index one past the last destination.
+    //*********************************************************************
+    void relocate_backward(size_t from_end, size_t to_end, size_t n)
+    {
+      while (n > 0)
+      {
+        from_end = (from_end == 0) ? BUFFER_SIZE : from_end;
+        to_end   = (to_end == 0)   ? BUFFER_SIZE : to_end;
+
+        size_t length = std::min(n, std::min(from_end, to_end));
+
+        from_end -= length;
+        to_end   -= length;
+
+        etl::relocate(p_buffer + from_end, p_buffer + from_end + length, p_buffer + to_end);
+
+        n -= length;
+      }
+    }
+
     //*************************************************************************
     /// Measures the distance between two iterators.
     //*************************************************************************
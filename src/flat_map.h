@@ -43,6 +43,7 @@ SOFTWARE.
 /// A flat_map with the capacity defined at compile time.
 /// Has insertion of O(N) and flat_map of O(logN)
 /// Duplicate entries are not allowed.
+/// The search may be changed by supplying a search policy from search_policy.h.
 ///\ingroup containers
 //*****************************************************************************
 
@@ -53,12 +54,12 @@ namespace etl
   /// Can be used as a reference type for all flat_maps containing a specific type.
   ///\ingroup flat_map
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey> >
-  class iflat_map : private etl::ireference_flat_map<TKey, TMapped, TKeyCompare>
+  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey>, typename TSearch = etl::binary_search_policy>
+  class iflat_map : private etl::ireference_flat_map<TKey, TMapped, TKeyCompare, TSearch>
   {
   private:
 
-    typedef etl::ireference_flat_map<TKey, TMapped, TKeyCompare> refmap_t;
+    typedef etl::ireference_flat_map<TKey, TMapped, TKeyCompare, TSearch> refmap_t;
     typedef typename refmap_t::lookup_t lookup_t;
     typedef etl::ipool storage_t;
 
@@ -69,6 +70,7 @@ namespace etl
     typedef TKey              key_type;
     typedef TMapped           mapped_type;
     typedef TKeyCompare       key_compare;
+    typedef TSearch           search_policy;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
     typedef value_type*       pointer;
@@ -278,10 +280,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -291,49 +290,48 @@ namespace etl
     //*********************************************************************
     std::pair<iterator, bool> insert(const_reference value)
     {
-      iterator i_element = lower_bound(value.first);
-
-      std::pair<iterator, bool> result(i_element, false);
-
-      // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != value.first)))
-      {
-        ETL_ASSERT(!refmap_t::full(), ETL_ERROR(flat_map_full));
-
-        value_type* pvalue = storage.allocate<value_type>();
-        ::new (pvalue) value_type(value);
-        ++construct_count;
-        result = refmap_t::insert_at(i_element, *pvalue);
-      }
-
-      return result;
+      return insert_at(lower_bound(value.first), value);
     }
 
     //*********************************************************************
     /// Inserts a value to the flat_map.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map is already full.
-    ///\param position The position to insert at.
+    ///\param position The position to insert at. Used as a hint by the search policy.
     ///\param value    The value to insert.
     //*********************************************************************
     iterator insert(iterator position, const_reference value)
     {
-      return insert(value).first;
+      return insert_at(refmap_t::lower_bound(position, value.first), value).first;
     }
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The values are sorted and merged with the existing elements in a single pass.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key, to the flat_map.
+    /// The values are merged with the existing elements in a single pass.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_map_not_sorted if the values are not sorted,
+    /// which reads the range an extra time.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(etl::is_sorted(first, last, etl::__private_flat__::key_first_compare<key_compare>()), ETL_ERROR(flat_map_not_sorted));
+
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -571,6 +569,68 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a value at the lower bound of its key, if it does not already exist.
+    //*********************************************************************
+    std::pair<iterator, bool> insert_at(iterator i_element, const_reference value)
+    {
+      std::pair<iterator, bool> result(i_element, false);
+
+      // Doesn't already exist?
+      if ((i_element == end() || (i_element->first != value.first)))
+      {
+        ETL_ASSERT(!refmap_t::full(), ETL_ERROR(flat_map_full));
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(value);
+        ++construct_count;
+        result = refmap_t::insert_at(i_element, *pvalue);
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, staging as many as will fit at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      while (first != last)
+      {
+        size_t n;
+        value_type** p_stage = refmap_t::get_stage(n);
+
+        if (n == 0)
+        {
+          // No free space, so insert directly.
+          insert(*first++);
+        }
+        else
+        {
+          size_t count = 0;
+
+          while ((first != last) && (count < n))
+          {
+            value_type* pvalue = storage.allocate<value_type>();
+            ::new (pvalue) value_type(*first++);
+            ++construct_count;
+            p_stage[count++] = pvalue;
+          }
+
+          size_t merged = refmap_t::merge_stage(p_stage, count, is_sorted);
+
+          // Release the values with keys that already existed.
+          for (size_t i = merged; i < count; ++i)
+          {
+            p_stage[i]->~value_type();
+            storage.release(p_stage[i]);
+            --construct_count;
+          }
+        }
+      }
+    }
+
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
@@ -587,8 +647,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup flat_map
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iflat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iflat_map<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename TKeyCompare, typename TSearch>
+  bool operator ==(const etl::iflat_map<TKey, TMapped, TKeyCompare, TSearch>& lhs, const etl::iflat_map<TKey, TMapped, TKeyCompare, TSearch>& rhs)
   {
     return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
   }
@@ -600,8 +660,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup flat_map
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iflat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iflat_map<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename TKeyCompare, typename TSearch>
+  bool operator !=(const etl::iflat_map<TKey, TMapped, TKeyCompare, TSearch>& lhs, const etl::iflat_map<TKey, TMapped, TKeyCompare, TSearch>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -611,11 +671,12 @@ namespace etl
   ///\tparam TKey     The key type.
   ///\tparam TValue   The value type.
   ///\tparam TCompare The type to compare keys. Default = std::less<TKey>
+  ///\tparam TSearch  The search policy. Default = etl::binary_search_policy
   ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
   ///\ingroup flat_map
   //***************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
-  class flat_map : public etl::iflat_map<TKey, TValue, TCompare>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey>, typename TSearch = etl::binary_search_policy>
+  class flat_map : public etl::iflat_map<TKey, TValue, TCompare, TSearch>
   {
   public:
 
@@ -625,7 +686,7 @@ namespace etl
     /// Constructor.
     //*************************************************************************
     flat_map()
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare, TSearch>(lookup, storage)
     {
     }
 
@@ -633,9 +694,9 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     flat_map(const flat_map& other)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare, TSearch>(lookup, storage)
     {
-      etl::iflat_map<TKey, TValue, TCompare>::assign(other.cbegin(), other.cend());
+      etl::iflat_map<TKey, TValue, TCompare, TSearch>::assign(other.cbegin(), other.cend());
     }
 
     //*************************************************************************
@@ -646,9 +707,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     flat_map(TIterator first, TIterator last)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare, TSearch>(lookup, storage)
     {
-      etl::iflat_map<TKey, TValue, TCompare>::assign(first, last);
+      etl::iflat_map<TKey, TValue, TCompare, TSearch>::assign(first, last);
     }
 
     //*************************************************************************
@@ -656,7 +717,7 @@ namespace etl
     //*************************************************************************
     ~flat_map()
     {
-      etl::iflat_map<TKey, TValue, TCompare>::clear();
+      etl::iflat_map<TKey, TValue, TCompare, TSearch>::clear();
     }
 
     //*************************************************************************
@@ -666,7 +727,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::iflat_map<TKey, TValue, TCompare>::assign(rhs.cbegin(), rhs.cend());
+        etl::iflat_map<TKey, TValue, TCompare, TSearch>::assign(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -674,7 +735,7 @@ namespace etl
 
   private:
 
-    typedef typename etl::iflat_map<TKey, TValue, TCompare>::value_type node_t;
+    typedef typename etl::iflat_map<TKey, TValue, TCompare, TSearch>::value_type node_t;
 
     /// The pool of nodes.
     etl::pool<node_t, MAX_SIZE> storage;
@@ -211,10 +211,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -253,18 +250,32 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_multiset.
+    /// The values are sorted and merged with the existing elements in a single pass.
     /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by value, to the flat_multiset.
+    /// The values are merged with the existing elements in a single pass.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_multiset_not_sorted if the values are not sorted,
+    /// which reads the range an extra time.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(etl::is_sorted(first, last, key_compare()), ETL_ERROR(flat_multiset_not_sorted));
+
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -500,6 +511,39 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, staging as many as will fit at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      while (first != last)
+      {
+        size_t n;
+        value_type** p_stage = refset_t::get_stage(n);
+
+        if (n == 0)
+        {
+          // No free space, so insert directly.
+          insert(*first++);
+        }
+        else
+        {
+          size_t count = 0;
+
+          while ((first != last) && (count < n))
+          {
+            value_type* pvalue = storage.allocate<value_type>();
+            ::new (pvalue) value_type(*first++);
+            ++construct_count;
+            p_stage[count++] = pvalue;
+          }
+
+          refset_t::merge_stage(p_stage, count, is_sorted);
+        }
+      }
+    }
+
     // Disable copy construction.
     iflat_multiset(const iflat_multiset&);
 
@@ -211,10 +211,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -255,18 +252,32 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
+    /// The values are sorted and merged with the existing elements in a single pass.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by value, to the flat_set.
+    /// The values are merged with the existing elements in a single pass.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_set_not_sorted if the values are not sorted,
+    /// which reads the range an extra time.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(etl::is_sorted(first, last, key_compare()), ETL_ERROR(flat_set_not_sorted));
+
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -504,6 +515,47 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, staging as many as will fit at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      while (first != last)
+      {
+        size_t n;
+        value_type** p_stage = refset_t::get_stage(n);
+
+        if (n == 0)
+        {
+          // No free space, so insert directly.
+          insert(*first++);
+        }
+        else
+        {
+          size_t count = 0;
+
+          while ((first != last) && (count < n))
+          {
+            value_type* pvalue = storage.allocate<value_type>();
+            ::new (pvalue) value_type(*first++);
+            ++construct_count;
+            p_stage[count++] = pvalue;
+          }
+
+          size_t merged = refset_t::merge_stage(p_stage, count, is_sorted);
+
+          // Release the values that already existed.
+          for (size_t i = merged; i < count; ++i)
+          {
+            p_stage[i]->~value_type();
+            storage.release(p_stage[i]);
+            --construct_count;
+          }
+        }
+      }
+    }
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
@@ -0,0 +1,1083 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_FORMAT__
+#define __ETL_FORMAT__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "charconv.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#define ETL_FILE "39"
+
+//*****************************************************************************
+///\defgroup format format
+/// Type safe formatting into an etl::ibasic_string, in the style of std::format.
+/// The output is appended directly to the string, without allocation or an
+/// intermediate buffer. If the string is too small the output is truncated,
+/// and truncated() is set, as for any append.
+///\code
+/// etl::string<64> text;
+/// etl::format_to(text, "{} = {:>8.3f} ({:#x})", name, value, flags);
+///\endcode
+/// A replacement field is {[index][:[[fill]align][sign][#][0][width][.precision][type]]}.
+/// Fields are numbered automatically if no index is given. "{{" and "}}" are
+/// written as '{' and '}'.
+/// <b>align</b>     '<' left, '>' right, '^' centre. Numbers default to right, others to left.
+/// <b>sign</b>      '+' always, '-' for negative only (default), ' ' space for positive.
+/// <b>#</b>         Prefix "0b", "0" or "0x" for integers. Always write the point for floats.
+/// <b>0</b>         Pad numbers with zeros after the sign and prefix.
+/// <b>precision</b> Digits for floats, as for printf. Maximum characters for strings.
+/// <b>type</b>      Integers: d, b, B, o, x, X, c. Floats: e, E, f, F, g, G.
+///                  Strings: s. Characters: c, or an integer type. bool: s, or an integer type.
+///                  Pointers: p.
+/// Floats with no type or precision are written in the shortest form that reads back as the same value.
+/// Arguments may be bool, characters, integers, float, double, strings, string_views and pointers.
+/// Any other type is a compile error.
+/// An invalid format string emits etl::format_invalid.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup format
+  /// Exception base for format
+  //***************************************************************************
+  class format_exception : public etl::exception
+  {
+  public:
+
+    format_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup format
+  /// The format string is invalid, or does not match the arguments.
+  //***************************************************************************
+  class format_invalid : public etl::format_exception
+  {
+  public:
+
+    format_invalid(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:invalid", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup format
+  /// A parsed format specification.
+  //***************************************************************************
+  template <typename TChar>
+  struct format_spec
+  {
+    format_spec()
+      : fill(TChar(' ')),
+        align(0),
+        sign('-'),
+        alternate(false),
+        zero(false),
+        width(0),
+        precision(-1),
+        type(0)
+    {
+    }
+
+    TChar  fill;
+    char   align;     ///< '<', '>', '^' or 0 for the default.
+    char   sign;      ///< '+', '-' or ' '.
+    bool   alternate; ///< '#'
+    bool   zero;      ///< '0'
+    size_t width;
+    int    precision; ///< -1 if not given.
+    char   type;      ///< 0 if not given.
+  };
+
+  namespace __private_format__
+  {
+    //*************************************************************************
+    /// Checks that the string is not full.
+    /// Appending to a full string has no effect and does not set truncated(),
+    /// so a push_back is used to set it.
+    //*************************************************************************
+    template <typename TChar>
+    bool has_space(etl::ibasic_string<TChar>& str)
+    {
+      if (str.full())
+      {
+        str.push_back(TChar(0));
+        return false;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends fill characters.
+    ///\return <b>false</b> if the string was truncated.
+    //*************************************************************************
+    template <typename TChar>
+    bool append_fill(etl::ibasic_string<TChar>& str, size_t n, TChar fill)
+    {
+      if (n == 0)
+      {
+        return true;
+      }
+
+      if (has_space(str))
+      {
+        str.append(n, fill);
+      }
+
+      return !str.truncated();
+    }
+
+    //*************************************************************************
+    /// Appends characters.
+    ///\return <b>false</b> if the string was truncated.
+    //*************************************************************************
+    template <typename TChar>
+    bool append_text(etl::ibasic_string<TChar>& str, const TChar* text, size_t n)
+    {
+      if (n == 0)
+      {
+        return true;
+      }
+
+      if (has_space(str))
+      {
+        str.append(text, n);
+      }
+
+      return !str.truncated();
+    }
+
+    template <typename TChar>
+    bool append_text(etl::ibasic_string<TChar>& str, const char* text, size_t n)
+    {
+      if (n == 0)
+      {
+        return true;
+      }
+
+      if (has_space(str))
+      {
+        etl::__private_charconv__::append_narrow(str, text, text + n);
+      }
+
+      return !str.truncated();
+    }
+
+    inline bool append_text(etl::ibasic_string<char>& str, const char* text, size_t n)
+    {
+      if (n == 0)
+      {
+        return true;
+      }
+
+      if (has_space(str))
+      {
+        str.append(text, n);
+      }
+
+      return !str.truncated();
+    }
+
+    //*************************************************************************
+    /// The magnitude of a floating point value with a precision too large for
+    /// a buffer. Its digits are streamed when appended.
+    //*************************************************************************
+    template <typename T>
+    struct float_body
+    {
+      T    value;
+      int  format;
+      int  precision;
+      bool alternate;
+      bool upper;
+    };
+
+    //*************************************************************************
+    /// Counts the characters written to it.
+    //*************************************************************************
+    struct count_sink
+    {
+      count_sink()
+        : count(0)
+      {
+      }
+
+      void operator()(char)
+      {
+        ++count;
+      }
+
+      size_t count;
+    };
+
+    template <typename TChar, typename T>
+    bool append_text(etl::ibasic_string<TChar>& str, const float_body<T>* body, size_t n)
+    {
+      if (n == 0)
+      {
+        return true;
+      }
+
+      if (has_space(str))
+      {
+        etl::__private_charconv__::string_sink<TChar> sink(str);
+
+        etl::__private_charconv__::format_float_precision_to(sink, body->value, body->format, body->precision, body->alternate, body->upper);
+      }
+
+      return !str.truncated();
+    }
+
+    //*************************************************************************
+    /// Appends a field, padded to the width.
+    /// The prefix is the sign and any base prefix of a number, which zero
+    /// padding follows.
+    //*************************************************************************
+    template <typename TChar, typename TBody>
+    bool append_field(etl::ibasic_string<TChar>&   str,
+                      const format_spec<TChar>&    spec,
+                      const char*                  prefix,
+                      size_t                       prefix_length,
+                      const TBody*                 body,
+                      size_t                       body_length,
+                      bool                         is_numeric)
+    {
+      const size_t length  = prefix_length + body_length;
+      const size_t padding = (spec.width > length) ? spec.width - length : 0;
+
+      if (is_numeric && spec.zero && (spec.align == 0))
+      {
+        return append_text(str, prefix, prefix_length) &&
+               append_fill(str, padding, TChar('0')) &&
+               append_text(str, body, body_length);
+      }
+
+      const char align = (spec.align != 0) ? spec.align : (is_numeric ? '>' : '<');
+
+      size_t before;
+
+      switch (align)
+      {
+        case '<': before = 0;           break;
+        case '>': before = padding;     break;
+        default:  before = padding / 2; break;
+      }
+
+      return append_fill(str, before, spec.fill) &&
+             append_text(str, prefix, prefix_length) &&
+             append_text(str, body, body_length) &&
+             append_fill(str, padding - before, spec.fill);
+    }
+
+    //*************************************************************************
+    /// Appends an integer.
+    //*************************************************************************
+    template <typename TChar>
+    bool format_integer(etl::ibasic_string<TChar>& str, const format_spec<TChar>& spec, unsigned long long magnitude, bool negative)
+    {
+      if (spec.precision >= 0)
+      {
+        return false;
+      }
+
+      if (spec.type == 'c')
+      {
+        if (negative || spec.zero || spec.alternate || (spec.sign != '-'))
+        {
+          return false;
+        }
+
+        const TChar c = TChar(magnitude);
+
+        append_field(str, spec, "", 0, &c, 1, false);
+
+        return true;
+      }
+
+      uint_least8_t base;
+      const char*   base_prefix = "";
+
+      switch (spec.type)
+      {
+        case 0:
+        case 'd': base = 10;                                       break;
+        case 'b': base = 2;  base_prefix = "0b";                   break;
+        case 'B': base = 2;  base_prefix = "0B";                   break;
+        case 'o': base = 8;  base_prefix = (magnitude != 0) ? "0" : ""; break;
+        case 'x': base = 16; base_prefix = "0x";                   break;
+        case 'X': base = 16; base_prefix = "0X";                   break;
+        default:  return false;
+      }
+
+      // The sign and base prefix.
+      char   prefix[3];
+      size_t prefix_length = 0;
+
+      if (negative)
+      {
+        prefix[prefix_length++] = '-';
+      }
+      else if (spec.sign != '-')
+      {
+        prefix[prefix_length++] = spec.sign;
+      }
+
+      if (spec.alternate)
+      {
+        while (*base_prefix != 0)
+        {
+          prefix[prefix_length++] = *base_prefix++;
+        }
+      }
+
+      char  buffer[64];
+      char* p_end   = buffer + sizeof(buffer);
+      char* p_begin = etl::__private_charconv__::format_unsigned(p_end, magnitude, base);
+
+      if (spec.type == 'X')
+      {
+        for (char* p = p_begin; p != p_end; ++p)
+        {
+          if (*p >= 'a')
+          {
+            *p = char(*p - 'a' + 'A');
+          }
+        }
+      }
+
+      append_field(str, spec, prefix, prefix_length, p_begin, size_t(p_end - p_begin), true);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends a floating point value with a precision too large for a buffer.
+    /// The digits are generated twice, to measure them and to append them.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    bool format_floating_point_exact(etl::ibasic_string<TChar>& str, const format_spec<TChar>& spec, T value)
+    {
+      typedef etl::__private_charconv__::float_traits<double> traits;
+
+      float_body<T> body;
+
+      switch (spec.type)
+      {
+        case 0:
+        case 'g':
+        case 'G': body.format = etl::chars_format::general;    break;
+        case 'e':
+        case 'E': body.format = etl::chars_format::scientific; break;
+        case 'f':
+        case 'F': body.format = etl::chars_format::fixed;      break;
+        default:  return false;
+      }
+
+      const uint64_t bits     = etl::__private_charconv__::get_bits(double(value));
+      const bool     negative = (bits >> 63) != 0;
+      const bool     finite   = int((bits >> (traits::SIGNIFICAND_BITS - 1)) & traits::MAX_EXPONENT_FIELD) != traits::MAX_EXPONENT_FIELD;
+
+      body.value     = negative ? -value : value;
+      body.precision = spec.precision;
+      body.alternate = spec.alternate;
+      body.upper     = (spec.type >= 'A') && (spec.type <= 'Z');
+
+      count_sink counter;
+      etl::__private_charconv__::format_float_precision_to(counter, body.value, body.format, body.precision, body.alternate, body.upper);
+
+      char   prefix[1];
+      size_t prefix_length = 0;
+
+      if (negative)
+      {
+        prefix[prefix_length++] = '-';
+      }
+      else if (spec.sign != '-')
+      {
+        prefix[prefix_length++] = spec.sign;
+      }
+
+      if (finite)
+      {
+        append_field(str, spec, prefix, prefix_length, &body, counter.count, true);
+      }
+      else
+      {
+        format_spec<TChar> special_spec(spec);
+        special_spec.zero = false;
+
+        append_field(str, special_spec, prefix, prefix_length, &body, counter.count, true);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends a float or double.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    bool format_floating_point(etl::ibasic_string<TChar>& str, const format_spec<TChar>& spec, T value)
+    {
+      if (spec.precision > etl::__private_charconv__::precision::MAX_PRECISION)
+      {
+        return format_floating_point_exact(str, spec, value);
+      }
+
+      char  buffer[etl::__private_charconv__::precision::MAX_DIGITS + 8];
+      char* p_end;
+
+      const bool upper = (spec.type >= 'A') && (spec.type <= 'Z');
+
+      switch (spec.type)
+      {
+        case 0:
+        {
+          if (spec.precision < 0)
+          {
+            p_end = etl::__private_charconv__::format_float(buffer, value);
+          }
+          else
+          {
+            p_end = etl::__private_charconv__::format_float_precision(buffer, value, etl::chars_format::general, spec.precision, spec.alternate, false);
+          }
+          break;
+        }
+
+        case 'e':
+        case 'E':
+        {
+          p_end = etl::__private_charconv__::format_float_precision(buffer, value, etl::chars_format::scientific, spec.precision, spec.alternate, upper);
+          break;
+        }
+
+        case 'f':
+        case 'F':
+        {
+          p_end = etl::__private_charconv__::format_float_precision(buffer, value, etl::chars_format::fixed, spec.precision, spec.alternate, upper);
+          break;
+        }
+
+        case 'g':
+        case 'G':
+        {
+          p_end = etl::__private_charconv__::format_float_precision(buffer, value, etl::chars_format::general, spec.precision, spec.alternate, upper);
+          break;
+        }
+
+        default:
+        {
+          return false;
+        }
+      }
+
+      // The sign is written as a prefix, so that zero padding follows it.
+      char   prefix[1];
+      size_t prefix_length = 0;
+      char*  p_begin       = buffer;
+
+      if (*p_begin == '-')
+      {
+        prefix[prefix_length++] = '-';
+        ++p_begin;
+      }
+      else if (spec.sign != '-')
+      {
+        prefix[prefix_length++] = spec.sign;
+      }
+
+      // Infinity and NaN are not zero padded.
+      if ((*p_begin >= '0') && (*p_begin <= '9'))
+      {
+        append_field(str, spec, prefix, prefix_length, p_begin, size_t(p_end - p_begin), true);
+      }
+      else
+      {
+        format_spec<TChar> special_spec(spec);
+        special_spec.zero = false;
+
+        append_field(str, special_spec, prefix, prefix_length, p_begin, size_t(p_end - p_begin), true);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends a string, truncated to the precision.
+    //*************************************************************************
+    template <typename TChar>
+    bool format_string(etl::ibasic_string<TChar>& str, const format_spec<TChar>& spec, const TChar* text, size_t length)
+    {
+      if (((spec.type != 0) && (spec.type != 's')) || spec.zero || (spec.sign != '-') || spec.alternate)
+      {
+        return false;
+      }
+
+      if ((spec.precision >= 0) && (length > size_t(spec.precision)))
+      {
+        length = size_t(spec.precision);
+      }
+
+      append_field(str, spec, "", 0, text, length, false);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The length of a null terminated string.
+    //*************************************************************************
+    template <typename TChar>
+    size_t length(const TChar* text)
+    {
+      const TChar* p = text;
+
+      while (*p != 0)
+      {
+        ++p;
+      }
+
+      return size_t(p - text);
+    }
+
+    //*************************************************************************
+    /// Reads a decimal number.
+    //*************************************************************************
+    template <typename TChar>
+    bool parse_number(const TChar*& p, size_t& value)
+    {
+      if ((*p < TChar('0')) || (*p > TChar('9')))
+      {
+        return false;
+      }
+
+      value = 0;
+
+      while ((*p >= TChar('0')) && (*p <= TChar('9')))
+      {
+        value = (value * 10) + size_t(*p - TChar('0'));
+        ++p;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Is the character an alignment?
+    //*************************************************************************
+    template <typename TChar>
+    bool is_align(TChar c)
+    {
+      return (c == TChar('<')) || (c == TChar('>')) || (c == TChar('^'));
+    }
+
+    //*************************************************************************
+    /// Reads a format specification, after the ':', up to and including the '}'.
+    //*************************************************************************
+    template <typename TChar>
+    bool parse_spec(const TChar*& p, format_spec<TChar>& spec)
+    {
+      // [[fill]align]
+      if ((*p != 0) && (*p != TChar('{')) && (*p != TChar('}')) && is_align(p[1]))
+      {
+        spec.fill  = p[0];
+        spec.align = char(p[1]);
+        p += 2;
+      }
+      else if (is_align(*p))
+      {
+        spec.align = char(*p);
+        ++p;
+      }
+
+      // [sign]
+      if ((*p == TChar('+')) || (*p == TChar('-')) || (*p == TChar(' ')))
+      {
+        spec.sign = char(*p);
+        ++p;
+      }
+
+      // [#]
+      if (*p == TChar('#'))
+      {
+        spec.alternate = true;
+        ++p;
+      }
+
+      // [0]
+      if (*p == TChar('0'))
+      {
+        spec.zero = true;
+        ++p;
+      }
+
+      // [width]
+      parse_number(p, spec.width);
+
+      // [.precision]
+      if (*p == TChar('.'))
+      {
+        ++p;
+
+        size_t precision;
+
+        if (!parse_number(p, precision))
+        {
+          return false;
+        }
+
+        spec.precision = (precision > 1000) ? 1000 : int(precision);
+      }
+
+      // [type]
+      if ((*p >= TChar('a')) && (*p <= TChar('z')))
+      {
+        spec.type = char(*p);
+        ++p;
+      }
+      else if ((*p >= TChar('A')) && (*p <= TChar('Z')))
+      {
+        spec.type = char(*p);
+        ++p;
+      }
+
+      if (*p != TChar('}'))
+      {
+        return false;
+      }
+
+      ++p;
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// A type erased format argument, referring to the value passed to format_to.
+  //***************************************************************************
+  template <typename TChar>
+  class format_arg
+  {
+  public:
+
+    explicit format_arg(bool value)                 : kind(BOOLEAN)          { data.boolean = value; }
+    explicit format_arg(char value)                 : kind(CHARACTER)        { data.character = TChar(value); }
+    explicit format_arg(wchar_t value)              : kind(CHARACTER)        { data.character = TChar(value); }
+#if !defined(ETL_NO_LARGE_CHAR_SUPPORT)
+    explicit format_arg(char16_t value)             : kind(CHARACTER)        { data.character = TChar(value); }
+    explicit format_arg(char32_t value)             : kind(CHARACTER)        { data.character = TChar(value); }
+#endif
+    explicit format_arg(signed char value)          : kind(SIGNED_INTEGER)   { data.signed_integer = value; }
+    explicit format_arg(unsigned char value)        : kind(UNSIGNED_INTEGER) { data.unsigned_integer = value; }
+    explicit format_arg(short value)                : kind(SIGNED_INTEGER)   { data.signed_integer = value; }
+    explicit format_arg(unsigned short value)       : kind(UNSIGNED_INTEGER) { data.unsigned_integer = value; }
+    explicit format_arg(int value)                  : kind(SIGNED_INTEGER)   { data.signed_integer = value; }
+    explicit format_arg(unsigned int value)         : kind(UNSIGNED_INTEGER) { data.unsigned_integer = value; }
+    explicit format_arg(long value)                 : kind(SIGNED_INTEGER)   { data.signed_integer = value; }
+    explicit format_arg(unsigned long value)        : kind(UNSIGNED_INTEGER) { data.unsigned_integer = value; }
+    explicit format_arg(long long value)            : kind(SIGNED_INTEGER)   { data.signed_integer = value; }
+    explicit format_arg(unsigned long long value)   : kind(UNSIGNED_INTEGER) { data.unsigned_integer = value; }
+    explicit format_arg(float value)                : kind(FLOAT)            { data.single = value; }
+    explicit format_arg(double value)               : kind(DOUBLE)           { data.real = value; }
+    explicit format_arg(const void* value)          : kind(POINTER)          { data.pointer = value; }
+
+    explicit format_arg(const TChar* value)
+      : kind(STRING)
+    {
+      data.string.text   = value;
+      data.string.length = __private_format__::length(value);
+    }
+
+    explicit format_arg(const etl::ibasic_string<TChar>& value)
+      : kind(STRING)
+    {
+      data.string.text   = value.data();
+      data.string.length = value.size();
+    }
+
+    explicit format_arg(const etl::basic_string_view<TChar>& value)
+      : kind(STRING)
+    {
+      data.string.text   = value.data();
+      data.string.length = value.size();
+    }
+
+    //*************************************************************************
+    /// Appends the value to the string.
+    ///\return <b>false</b> if the specification does not suit the value.
+    //*************************************************************************
+    bool format(etl::ibasic_string<TChar>& str, const format_spec<TChar>& spec) const
+    {
+      switch (kind)
+      {
+        case BOOLEAN:
+        {
+          if ((spec.type == 0) || (spec.type == 's'))
+          {
+            static const TChar TRUE_TEXT[]  = { TChar('t'), TChar('r'), TChar('u'), TChar('e') };
+            static const TChar FALSE_TEXT[] = { TChar('f'), TChar('a'), TChar('l'), TChar('s'), TChar('e') };
+
+            return data.boolean ? __private_format__::format_string(str, spec, TRUE_TEXT, 4)
+                                : __private_format__::format_string(str, spec, FALSE_TEXT, 5);
+          }
+
+          return (spec.type != 'c') && __private_format__::format_integer(str, spec, data.boolean ? 1ULL : 0ULL, false);
+        }
+
+        case CHARACTER:
+        {
+          if ((spec.type == 0) || (spec.type == 'c'))
+          {
+            format_spec<TChar> character_spec(spec);
+            character_spec.type = 0;
+
+            return __private_format__::format_string(str, character_spec, &data.character, 1);
+          }
+
+          typedef typename etl::make_unsigned<TChar>::type unsigned_t;
+
+          return __private_format__::format_integer(str, spec, (unsigned long long)(unsigned_t(data.character)), false);
+        }
+
+        case SIGNED_INTEGER:
+        {
+          const bool negative = (data.signed_integer < 0);
+          const unsigned long long magnitude = negative ? (0ULL - (unsigned long long)(data.signed_integer))
+                                                        : (unsigned long long)(data.signed_integer);
+
+          return __private_format__::format_integer(str, spec, magnitude, negative);
+        }
+
+        case UNSIGNED_INTEGER:
+        {
+          return __private_format__::format_integer(str, spec, data.unsigned_integer, false);
+        }
+
+        case FLOAT:
+        {
+          return __private_format__::format_floating_point(str, spec, data.single);
+        }
+
+        case DOUBLE:
+        {
+          return __private_format__::format_floating_point(str, spec, data.real);
+        }
+
+        case STRING:
+        {
+          return __private_format__::format_string(str, spec, data.string.text, data.string.length);
+        }
+
+        case POINTER:
+        default:
+        {
+          if (((spec.type != 0) && (spec.type != 'p')) || (spec.precision >= 0))
+          {
+            return false;
+          }
+
+          format_spec<TChar> pointer_spec(spec);
+          pointer_spec.type      = 'x';
+          pointer_spec.alternate = true;
+
+          return __private_format__::format_integer(str, pointer_spec, (unsigned long long)(uintptr_t(data.pointer)), false);
+        }
+      }
+    }
+
+  private:
+
+    enum kind_t
+    {
+      BOOLEAN,
+      CHARACTER,
+      SIGNED_INTEGER,
+      UNSIGNED_INTEGER,
+      FLOAT,
+      DOUBLE,
+      STRING,
+      POINTER
+    };
+
+    kind_t kind;
+
+    union
+    {
+      bool               boolean;
+      TChar              character;
+      long long          signed_integer;
+      unsigned long long unsigned_integer;
+      float              single;
+      double             real;
+      const void*        pointer;
+
+      struct
+      {
+        const TChar* text;
+        size_t       length;
+      } string;
+    } data;
+  };
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends formatted arguments to a string.
+  /// The format string is read in a single pass, and writing stops as soon as
+  /// the string is truncated.
+  ///\param str    The string to append to.
+  ///\param format The null terminated format string.
+  ///\param args   The arguments.
+  ///\param count  The number of arguments.
+  ///\return A reference to the string.
+  //***************************************************************************
+  template <typename TChar>
+  etl::ibasic_string<TChar>& vformat_to(etl::ibasic_string<TChar>& str, const TChar* format, const etl::format_arg<TChar>* args, size_t count)
+  {
+    const TChar* p = format;
+
+    size_t next_index    = 0;
+    bool   is_automatic  = false;
+    bool   is_manual     = false;
+
+    while (*p != 0)
+    {
+      // The literal text up to the next brace.
+      const TChar* p_text = p;
+
+      while ((*p != 0) && (*p != TChar('{')) && (*p != TChar('}')))
+      {
+        ++p;
+      }
+
+      if (!__private_format__::append_text(str, p_text, size_t(p - p_text)) || (*p == 0))
+      {
+        return str;
+      }
+
+      // Escaped braces.
+      if (p[1] == *p)
+      {
+        if (!__private_format__::append_text(str, p, 1))
+        {
+          return str;
+        }
+
+        p += 2;
+        continue;
+      }
+
+      bool valid = (*p == TChar('{'));
+      ++p;
+
+      // The argument index.
+      size_t index = 0;
+
+      if (valid)
+      {
+        if (__private_format__::parse_number(p, index))
+        {
+          is_manual = true;
+        }
+        else
+        {
+          is_automatic = true;
+          index = next_index++;
+        }
+
+        valid = !(is_manual && is_automatic) && (index < count);
+      }
+
+      // The specification.
+      format_spec<TChar> spec;
+
+      if (valid)
+      {
+        if (*p == TChar(':'))
+        {
+          ++p;
+          valid = __private_format__::parse_spec(p, spec);
+        }
+        else
+        {
+          valid = (*p == TChar('}'));
+          ++p;
+        }
+      }
+
+      if (valid)
+      {
+        valid = args[index].format(str, spec);
+      }
+
+      if (!valid)
+      {
+        ETL_ASSERT(false, ETL_ERROR(format_invalid));
+        return str;
+      }
+
+      if (str.truncated())
+      {
+        return str;
+      }
+    }
+
+    return str;
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends a format string with no arguments, replacing "{{" and "}}".
+  //***************************************************************************
+  template <typename TChar>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format)
+  {
+    return etl::vformat_to(str, format, static_cast<const etl::format_arg<TChar>*>(0), 0);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends formatted arguments to a string.
+  ///\param str    The string to append to.
+  ///\param format The null terminated format string.
+  ///\param arg1   The argument.
+  ///\return A reference to the string.
+  //***************************************************************************
+  template <typename TChar, typename T1>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1) };
+
+    return etl::vformat_to(str, format, args, 1);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 2 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2) };
+
+    return etl::vformat_to(str, format, args, 2);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 3 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2, typename T3>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2, const T3& arg3)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2), etl::format_arg<TChar>(arg3) };
+
+    return etl::vformat_to(str, format, args, 3);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 4 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2, typename T3, typename T4>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2, const T3& arg3, const T4& arg4)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2), etl::format_arg<TChar>(arg3), etl::format_arg<TChar>(arg4) };
+
+    return etl::vformat_to(str, format, args, 4);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 5 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2, typename T3, typename T4, typename T5>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2, const T3& arg3, const T4& arg4, const T5& arg5)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2), etl::format_arg<TChar>(arg3), etl::format_arg<TChar>(arg4), etl::format_arg<TChar>(arg5) };
+
+    return etl::vformat_to(str, format, args, 5);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 6 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2, const T3& arg3, const T4& arg4, const T5& arg5, const T6& arg6)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2), etl::format_arg<TChar>(arg3), etl::format_arg<TChar>(arg4), etl::format_arg<TChar>(arg5), etl::format_arg<TChar>(arg6) };
+
+    return etl::vformat_to(str, format, args, 6);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 7 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2, const T3& arg3, const T4& arg4, const T5& arg5, const T6& arg6, const T7& arg7)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2), etl::format_arg<TChar>(arg3), etl::format_arg<TChar>(arg4), etl::format_arg<TChar>(arg5), etl::format_arg<TChar>(arg6), etl::format_arg<TChar>(arg7) };
+
+    return etl::vformat_to(str, format, args, 7);
+  }
+
+  //***************************************************************************
+  ///\ingroup format
+  /// Appends 8 formatted arguments to a string.
+  //***************************************************************************
+  template <typename TChar, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar* format, const T1& arg1, const T2& arg2, const T3& arg3, const T4& arg4, const T5& arg5, const T6& arg6, const T7& arg7, const T8& arg8)
+  {
+    const etl::format_arg<TChar> args[] = { etl::format_arg<TChar>(arg1), etl::format_arg<TChar>(arg2), etl::format_arg<TChar>(arg3), etl::format_arg<TChar>(arg4), etl::format_arg<TChar>(arg5), etl::format_arg<TChar>(arg6), etl::format_arg<TChar>(arg7), etl::format_arg<TChar>(arg8) };
+
+    return etl::vformat_to(str, format, args, 8);
+  }
+}
+
+#undef ETL_FILE
+
+#endif
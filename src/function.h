@@ -81,6 +81,19 @@ namespace etl
     virtual void operator ()() = 0;
   };
 
+  //***************************************************************************
+  /// The pure virtual destructors still need a body, as they are called by
+  /// the destructors of the derived classes.
+  //***************************************************************************
+  template <typename TParameter>
+  ifunction<TParameter>::~ifunction()
+  {
+  }
+
+  inline ifunction<void>::~ifunction()
+  {
+  }
+
   //***************************************************************************
   ///\ingroup function
   /// A derived function template that takes an object type and parameter type.
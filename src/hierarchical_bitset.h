@@ -0,0 +1,554 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_HIERARCHICAL_BITSET__
+#define __ETL_HIERARCHICAL_BITSET__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <iterator>
+
+#include "platform.h"
+#include "binary.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup hierarchical_bitset hierarchical_bitset
+/// A bitset for large, sparse bitmaps.
+/// Each 64 bit word of a level has a summary bit in the level above, which is
+/// set when the word is non-zero. Levels are added until one word remains.
+/// Finding and iterating set bits skips runs of zero words, so costs time
+/// proportional to the number of set bits rather than the size.
+/// Up to five levels, or 2^30 bits, are supported.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for etl::hierarchical_bitset
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  class ihierarchical_bitset
+  {
+  public:
+
+    typedef uint64_t word_t;
+
+    static const size_t BITS_PER_WORD = 64;
+    static const size_t MAX_LEVELS    = 5;
+
+    enum
+    {
+      npos = etl::integral_limits<size_t>::max
+    };
+
+    //*************************************************************************
+    /// Iterates the positions of the set bits, in increasing order.
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::forward_iterator_tag, const size_t>
+    {
+    public:
+
+      friend class ihierarchical_bitset;
+
+      const_iterator()
+        : p_bitset(nullptr),
+          position(npos)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        position = p_bitset->find_next(position + 1);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        position = p_bitset->find_next(position + 1);
+        return temp;
+      }
+
+      size_t operator *() const
+      {
+        return position;
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const ihierarchical_bitset* p_bitset_, size_t position_)
+        : p_bitset(p_bitset_),
+          position(position_)
+      {
+      }
+
+      const ihierarchical_bitset* p_bitset;
+      size_t                      position;
+    };
+
+    //*************************************************************************
+    /// The number of bits.
+    //*************************************************************************
+    size_t size() const
+    {
+      return NBITS;
+    }
+
+    //*************************************************************************
+    /// The number of bits set.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n_set;
+    }
+
+    //*************************************************************************
+    /// Are any of the bits set?
+    //*************************************************************************
+    bool any() const
+    {
+      return n_set != 0;
+    }
+
+    //*************************************************************************
+    /// Are none of the bits set?
+    //*************************************************************************
+    bool none() const
+    {
+      return n_set == 0;
+    }
+
+    //*************************************************************************
+    /// Are all of the bits set?
+    //*************************************************************************
+    bool all() const
+    {
+      return n_set == NBITS;
+    }
+
+    //*************************************************************************
+    /// Tests the bit at the position.
+    //*************************************************************************
+    bool test(size_t position) const
+    {
+      return (pdata[position / BITS_PER_WORD] & bit_mask(position)) != 0;
+    }
+
+    //*************************************************************************
+    /// Read [] operator.
+    //*************************************************************************
+    bool operator [](size_t position) const
+    {
+      return test(position);
+    }
+
+    //*************************************************************************
+    /// Sets all of the bits.
+    //*************************************************************************
+    ihierarchical_bitset& set()
+    {
+      size_t nbits = NBITS;
+
+      // Each level has one bit per word of the level below.
+      for (size_t level = 0; level < levels; ++level)
+      {
+        word_t* p_level = pdata + offsets[level];
+        size_t  nwords  = words_for(nbits);
+
+        std::fill_n(p_level, nwords, ~word_t(0));
+
+        if ((nbits % BITS_PER_WORD) != 0)
+        {
+          p_level[nwords - 1] = (word_t(1) << (nbits % BITS_PER_WORD)) - 1;
+        }
+
+        nbits = nwords;
+      }
+
+      n_set = NBITS;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Sets the bit at the position.
+    //*************************************************************************
+    ihierarchical_bitset& set(size_t position)
+    {
+      word_t& word = pdata[position / BITS_PER_WORD];
+      word_t  mask = bit_mask(position);
+
+      if ((word & mask) == 0)
+      {
+        ++n_set;
+
+        bool was_empty = (word == 0);
+        word |= mask;
+
+        // Mark the word as non-zero in the levels above, until a level is
+        // reached where the summary word was already non-zero.
+        for (size_t level = 1; was_empty && (level < levels); ++level)
+        {
+          position /= BITS_PER_WORD;
+
+          word_t& summary = pdata[offsets[level] + (position / BITS_PER_WORD)];
+
+          was_empty = (summary == 0);
+          summary |= bit_mask(position);
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Sets the bit at the position to the value.
+    //*************************************************************************
+    ihierarchical_bitset& set(size_t position, bool value)
+    {
+      return value ? set(position) : reset(position);
+    }
+
+    //*************************************************************************
+    /// Resets all of the bits.
+    //*************************************************************************
+    ihierarchical_bitset& reset()
+    {
+      std::fill_n(pdata, offsets[levels - 1] + 1, word_t(0));
+      n_set = 0;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Resets the bit at the position.
+    //*************************************************************************
+    ihierarchical_bitset& reset(size_t position)
+    {
+      word_t& word = pdata[position / BITS_PER_WORD];
+      word_t  mask = bit_mask(position);
+
+      if ((word & mask) != 0)
+      {
+        --n_set;
+
+        word &= ~mask;
+        bool is_empty = (word == 0);
+
+        // Mark the word as zero in the levels above, until a level is
+        // reached where the summary word is still non-zero.
+        for (size_t level = 1; is_empty && (level < levels); ++level)
+        {
+          position /= BITS_PER_WORD;
+
+          word_t& summary = pdata[offsets[level] + (position / BITS_PER_WORD)];
+
+          summary &= ~bit_mask(position);
+          is_empty = (summary == 0);
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flips the bit at the position.
+    //*************************************************************************
+    ihierarchical_bitset& flip(size_t position)
+    {
+      return test(position) ? reset(position) : set(position);
+    }
+
+    //*************************************************************************
+    /// Finds the first set bit.
+    ///\returns The position of the bit or npos if none are set.
+    //*************************************************************************
+    size_t find_first() const
+    {
+      return find_next(0);
+    }
+
+    //*************************************************************************
+    /// Finds the next set bit, at or after the position.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none are set.
+    //*************************************************************************
+    size_t find_next(size_t position) const
+    {
+      if (position >= NBITS)
+      {
+        return npos;
+      }
+
+      // Try the leaf word first.
+      word_t value = pdata[position / BITS_PER_WORD] & (~word_t(0) << (position % BITS_PER_WORD));
+
+      if (value != 0)
+      {
+        return (position & ~(BITS_PER_WORD - 1)) + etl::count_trailing_zeros(value);
+      }
+
+      size_t nbits = words_for(NBITS);
+      size_t level = 1;
+
+      // Start from the next leaf word, and climb until a word holds a set bit
+      // at or after the position.
+      position = (position / BITS_PER_WORD) + 1;
+
+      while (true)
+      {
+        if ((level == levels) || (position >= nbits))
+        {
+          return npos;
+        }
+
+        value = pdata[offsets[level] + (position / BITS_PER_WORD)] & (~word_t(0) << (position % BITS_PER_WORD));
+
+        if (value != 0)
+        {
+          break;
+        }
+
+        // Start from the next word of the level below.
+        position = (position / BITS_PER_WORD) + 1;
+        nbits    = words_for(nbits);
+        ++level;
+      }
+
+      position = (position & ~(BITS_PER_WORD - 1)) + etl::count_trailing_zeros(value);
+
+      // Descend, following the first set bit of each non-zero word.
+      while (level != 0)
+      {
+        --level;
+
+        value    = pdata[offsets[level] + position];
+        position = (position * BITS_PER_WORD) + etl::count_trailing_zeros(value);
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Iterator to the first set bit.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, find_first());
+    }
+
+    //*************************************************************************
+    /// Iterator to the end of the set bits.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, npos);
+    }
+
+    //*************************************************************************
+    /// Iterator to the first set bit.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Iterator to the end of the set bits.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// operator =
+    //*************************************************************************
+    ihierarchical_bitset& operator =(const ihierarchical_bitset& other)
+    {
+      if (this != &other)
+      {
+        std::copy(other.pdata, other.pdata + offsets[levels - 1] + 1, pdata);
+        n_set = other.n_set;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Compares the bits of two bitsets.
+    //*************************************************************************
+    friend bool operator ==(const ihierarchical_bitset& lhs, const ihierarchical_bitset& rhs)
+    {
+      return (lhs.n_set == rhs.n_set) && std::equal(lhs.pdata, lhs.pdata + lhs.words_for(lhs.NBITS), rhs.pdata);
+    }
+
+    friend bool operator !=(const ihierarchical_bitset& lhs, const ihierarchical_bitset& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    //*************************************************************************
+    /// The number of words needed to hold a number of bits.
+    //*************************************************************************
+    static size_t words_for(size_t nbits)
+    {
+      return (nbits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// Lays out the levels in the storage, the leaf words first.
+    //*************************************************************************
+    ihierarchical_bitset(size_t nbits, word_t* pdata_)
+      : NBITS(nbits),
+        pdata(pdata_),
+        levels(0),
+        n_set(0)
+    {
+      size_t offset = 0;
+      size_t nwords = words_for(nbits);
+
+      while (true)
+      {
+        offsets[levels++] = offset;
+        offset += nwords;
+
+        if (nwords == 1)
+        {
+          break;
+        }
+
+        nwords = words_for(nwords);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The mask for a bit within its word.
+    //*************************************************************************
+    static word_t bit_mask(size_t position)
+    {
+      return word_t(1) << (position % BITS_PER_WORD);
+    }
+
+    // Disable copy construction.
+    ihierarchical_bitset(const ihierarchical_bitset&);
+
+    const size_t NBITS;
+    word_t*      pdata;
+    size_t       offsets[MAX_LEVELS];
+    size_t       levels;
+    size_t       n_set;
+  };
+
+  //***************************************************************************
+  /// A hierarchical bitset with a fixed number of bits.
+  ///\tparam MAXN The number of bits.
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  template <const size_t MAXN>
+  class hierarchical_bitset : public etl::ihierarchical_bitset
+  {
+  private:
+
+    static const size_t WORDS_0 = (MAXN + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    static const size_t WORDS_1 = (WORDS_0 + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    static const size_t WORDS_2 = (WORDS_1 + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    static const size_t WORDS_3 = (WORDS_2 + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    static const size_t WORDS_4 = (WORDS_3 + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    STATIC_ASSERT(MAXN > 0, "Zero sized hierarchical_bitset not allowed");
+    STATIC_ASSERT(WORDS_4 == 1, "Too many bits for hierarchical_bitset");
+
+  public:
+
+    /// The number of words used by all of the levels.
+    static const size_t ALLOCATED_WORDS = WORDS_0 +
+                                          ((WORDS_0 > 1) ? WORDS_1 : 0) +
+                                          ((WORDS_1 > 1) ? WORDS_2 : 0) +
+                                          ((WORDS_2 > 1) ? WORDS_3 : 0) +
+                                          ((WORDS_3 > 1) ? WORDS_4 : 0);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    hierarchical_bitset()
+      : etl::ihierarchical_bitset(MAXN, data)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    hierarchical_bitset(const hierarchical_bitset& other)
+      : etl::ihierarchical_bitset(MAXN, data)
+    {
+      etl::ihierarchical_bitset::operator =(other);
+    }
+
+    //*************************************************************************
+    /// operator =
+    //*************************************************************************
+    hierarchical_bitset& operator =(const hierarchical_bitset& other)
+    {
+      etl::ihierarchical_bitset::operator =(other);
+      return *this;
+    }
+
+  private:
+
+    word_t data[ALLOCATED_WORDS];
+  };
+
+  template <const size_t MAXN>
+  const size_t hierarchical_bitset<MAXN>::ALLOCATED_WORDS;
+}
+
+#endif
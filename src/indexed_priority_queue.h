@@ -0,0 +1,501 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INDEXED_PRIORITY_QUEUE__
+#define __ETL_INDEXED_PRIORITY_QUEUE__
+
+#include <stddef.h>
+#include <functional>
+#include <new>
+
+#include "platform.h"
+#include "container.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "static_assert.h"
+
+#undef ETL_FILE
+#define ETL_FILE "35"
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A priority queue with the capacity defined at compile time, where each
+/// value is identified by a stable handle returned from 'push'.
+/// A value may be changed or erased through its handle in O(logN).
+/// The heap is d-ary, with the arity defined at compile time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for indexed_priority_queue exceptions.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_exception : public exception
+  {
+  public:
+
+    indexed_priority_queue_exception(string_type what, string_type file_name, numeric_type line_number)
+      : exception(what, file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is full.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_full : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_full(string_type file_name, numeric_type line_number)
+      : indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:full", ETL_FILE"A"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a queued value.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_handle : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_handle(string_type file_name, numeric_type line_number)
+      : indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:handle", ETL_FILE"B"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all indexed priority queues.
+  /// The heap is an array of handles. The handles of the queued values are
+  /// at [0, size) in heap order and the free handles are at [size, capacity).
+  /// 'position' maps each handle back to its place in the heap array.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_base
+  {
+  public:
+
+    typedef size_t size_type;   ///< The type used for determining the size of the queue.
+    typedef size_t handle_type; ///< The type of the handle to a value.
+
+    //*************************************************************************
+    /// Returns the current number of items in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    /// \return <b>true</b> if the queue is empty, otherwise <b>false</b>
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    /// \return <b>true</b> if the queue is full, otherwise <b>false</b>
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the handle refers to a queued value.
+    /// \return <b>true</b> if the value is queued, otherwise <b>false</b>
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < CAPACITY) && (p_position[handle] < current_size);
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return p_heap[0];
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    indexed_priority_queue_base(handle_type* p_heap_, size_type* p_position_, size_type max_size_)
+      : p_heap(p_heap_),
+        p_position(p_position_),
+        current_size(0),
+        CAPACITY(max_size_)
+    {
+      for (size_type i = 0; i < CAPACITY; ++i)
+      {
+        p_heap[i]     = i;
+        p_position[i] = i;
+      }
+    }
+
+    //*************************************************************************
+    /// Places the handle at the heap index.
+    //*************************************************************************
+    void place(handle_type handle, size_type index)
+    {
+      p_heap[index]      = handle;
+      p_position[handle] = index;
+    }
+
+    handle_type*      p_heap;           ///< The handles in heap order, followed by the free handles.
+    size_type*        p_position;       ///< The heap index of each handle.
+    size_type         current_size;     ///< The number of items in the queue.
+    const size_type   CAPACITY;         ///< The maximum number of items in the queue.
+    etl::debug_count  construct_count;  ///< For internal debugging purposes.
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  ///\brief This is the base for all indexed priority queues that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue.
+  ///\code
+  /// etl::indexed_priority_queue<int, 10> myQueue;
+  /// etl::iindexed_priority_queue<int>& iQueue = myQueue;
+  ///\endcode
+  /// \tparam T        The type of value that the queue holds.
+  /// \tparam TCompare The comparison. The greatest value is at the top.
+  /// \tparam ARITY    The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, typename TCompare = std::less<T>, const size_t ARITY = 4>
+  class iindexed_priority_queue : public etl::indexed_priority_queue_base
+  {
+  public:
+
+    STATIC_ASSERT(ARITY >= 2, "ARITY must be at least 2");
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef TCompare compare_type;    ///< The comparison type.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+    typedef T*       pointer;         ///< A pointer to the type used in the queue.
+    typedef const T* const_pointer;   ///< A const pointer to the type used in the queue.
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// Gets a reference to the highest priority value in the queue.
+    //*************************************************************************
+    reference top()
+    {
+      return p_buffer[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value in the queue.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_buffer[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value with the handle.
+    /// The value must only be changed through 'update'.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      return p_buffer[handle];
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\param value The value to push to the queue.
+    ///\return The handle of the value. Valid until the value is popped or erased.
+    //*************************************************************************
+    handle_type push(parameter_t value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(indexed_priority_queue_full));
+
+      // The next free handle is just beyond the heap.
+      const handle_type handle = p_heap[current_size];
+
+      ::new (&p_buffer[handle]) T(value);
+      ++construct_count;
+
+      sift_up(current_size++, handle);
+
+      return handle;
+    }
+
+    //*************************************************************************
+    /// Removes the highest priority value from the queue.
+    //*************************************************************************
+    void pop()
+    {
+      erase(p_heap[0]);
+    }
+
+    //*************************************************************************
+    /// Changes the value with the handle and restores the heap order.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle does not refer to a queued value.
+    ///\param handle The handle of the value.
+    ///\param value  The new value.
+    //*************************************************************************
+    void update(handle_type handle, parameter_t value)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_handle));
+
+      p_buffer[handle] = value;
+      restore(p_position[handle], handle);
+    }
+
+    //*************************************************************************
+    /// Removes the value with the handle from the queue.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle does not refer to a queued value.
+    ///\param handle The handle of the value.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_handle));
+
+      const size_type   index = p_position[handle];
+      const handle_type last  = p_heap[--current_size];
+
+      p_buffer[handle].~T();
+      --construct_count;
+
+      // The freed handle goes just beyond the heap, ready for the next push.
+      place(handle, current_size);
+
+      if (last != handle)
+      {
+        restore(index, last);
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    /// Handles are not invalidated in any particular order.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_type i = 0; i < current_size; ++i)
+      {
+        p_buffer[p_heap[i]].~T();
+        --construct_count;
+      }
+
+      current_size = 0;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iindexed_priority_queue(T* p_buffer_, handle_type* p_heap_, size_type* p_position_, size_type max_size_)
+      : indexed_priority_queue_base(p_heap_, p_position_, max_size_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Places the handle at or above the heap index.
+    //*************************************************************************
+    void sift_up(size_type index, handle_type handle)
+    {
+      while (index > 0)
+      {
+        const size_type parent = (index - 1) / ARITY;
+
+        if (!compare(p_buffer[p_heap[parent]], p_buffer[handle]))
+        {
+          break;
+        }
+
+        place(p_heap[parent], index);
+        index = parent;
+      }
+
+      place(handle, index);
+    }
+
+    //*************************************************************************
+    /// Places the handle at or below the heap index.
+    //*************************************************************************
+    void sift_down(size_type index, handle_type handle)
+    {
+      while (true)
+      {
+        const size_type first = (ARITY * index) + 1;
+
+        if (first >= current_size)
+        {
+          break;
+        }
+
+        const size_type last = (current_size - first > ARITY) ? first + ARITY : current_size;
+
+        // Find the highest priority child.
+        size_type best = first;
+
+        for (size_type child = first + 1; child < last; ++child)
+        {
+          if (compare(p_buffer[p_heap[best]], p_buffer[p_heap[child]]))
+          {
+            best = child;
+          }
+        }
+
+        if (!compare(p_buffer[handle], p_buffer[p_heap[best]]))
+        {
+          break;
+        }
+
+        place(p_heap[best], index);
+        index = best;
+      }
+
+      place(handle, index);
+    }
+
+    //*************************************************************************
+    /// Places the handle, whose value has changed, relative to the heap index.
+    //*************************************************************************
+    void restore(size_type index, handle_type handle)
+    {
+      if ((index > 0) && compare(p_buffer[p_heap[(index - 1) / ARITY]], p_buffer[handle]))
+      {
+        sift_up(index, handle);
+      }
+      else
+      {
+        sift_down(index, handle);
+      }
+    }
+
+    // Disable copy construction.
+    iindexed_priority_queue(const iindexed_priority_queue&);
+
+    T*       p_buffer; ///< The values, indexed by handle.
+    TCompare compare;  ///< The comparison.
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// A fixed capacity indexed priority queue.
+  /// This queue does not support concurrent access by different threads.
+  /// \tparam T        The type this queue should support.
+  /// \tparam SIZE     The maximum capacity of the queue.
+  /// \tparam TCompare The comparison. The greatest value is at the top.
+  /// \tparam ARITY    The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, typename TCompare = std::less<T>, const size_t ARITY = 4>
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, TCompare, ARITY>
+  {
+  public:
+
+    typedef typename etl::iindexed_priority_queue<T, TCompare, ARITY>::handle_type handle_type;
+    typedef typename etl::iindexed_priority_queue<T, TCompare, ARITY>::size_type   size_type;
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : etl::iindexed_priority_queue<T, TCompare, ARITY>(reinterpret_cast<T*>(&buffer[0]), heap, position, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      etl::iindexed_priority_queue<T, TCompare, ARITY>::clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    indexed_priority_queue(const indexed_priority_queue&);
+    indexed_priority_queue& operator =(const indexed_priority_queue&);
+
+    /// The uninitialised buffer of T used in the queue.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[SIZE];
+
+    handle_type heap[SIZE];     ///< The handles in heap order.
+    size_type   position[SIZE]; ///< The heap index of each handle.
+  };
+}
+
+#undef ETL_FILE
+
+#endif
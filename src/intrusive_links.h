@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include <assert.h>
 #include <utility>
+#include <stdint.h>
 
 #include "nullptr.h"
 #include "type_traits.h"
@@ -506,9 +507,10 @@ namespace etl
 
       void clear()
       {
-        etl_parent = nullptr;
-        etl_left   = nullptr;
-        etl_right  = nullptr;
+        etl_parent  = nullptr;
+        etl_left    = nullptr;
+        etl_right   = nullptr;
+        etl_balance = 0;
       }
 
       bool is_linked() const
@@ -519,6 +521,7 @@ namespace etl
       tree_link* etl_parent;
       tree_link* etl_left;
       tree_link* etl_right;
+      int_least8_t etl_balance; ///< The balance factor, for use by balanced trees.
   };
 
   // Reference, Reference
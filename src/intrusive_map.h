@@ -0,0 +1,119 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INTRUSIVE_MAP__
+#define __ETL_INTRUSIVE_MAP__
+
+#include <stddef.h>
+#include <functional>
+
+#include "platform.h"
+#include "intrusive_links.h"
+#include "private/intrusive_tree.h"
+
+//*****************************************************************************
+///\defgroup intrusive_map intrusive_map
+/// An intrusive ordered map, implemented as an AVL tree threaded through an
+/// etl::tree_link in each value. The values are ordered by a key that they
+/// contain. The map never allocates and has no maximum size. Insert, erase
+/// and find are O(logN).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //*************************************************************************
+  /// An intrusive map.
+  ///\code
+  /// struct Item : public etl::tree_link<0>
+  /// {
+  ///   uint32_t id;
+  /// };
+  ///
+  /// struct ItemId
+  /// {
+  ///   const uint32_t& operator ()(const Item& item) const { return item.id; }
+  /// };
+  ///
+  /// etl::intrusive_map<uint32_t, Item, ItemId> items;
+  ///\endcode
+  ///\tparam TKey     The type of key.
+  ///\tparam TValue   The type of value. Must derive from TLink.
+  ///\tparam TGetKey  A functor returning a const reference to the key of a value.
+  ///\tparam TLink    The link used to thread the values into the tree.
+  ///\tparam TCompare The ordering of the keys.
+  ///\ingroup intrusive_map
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TGetKey, typename TLink = etl::tree_link<0>, typename TCompare = std::less<TKey> >
+  class intrusive_map : public __private_intrusive_tree__::intrusive_tree<TKey, TValue, TGetKey, TLink, TCompare>
+  {
+  private:
+
+    typedef __private_intrusive_tree__::intrusive_tree<TKey, TValue, TGetKey, TLink, TCompare> base;
+
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    intrusive_map()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a range of values to link.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first value.
+    ///\param last  The iterator to the last value + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_map(TIterator first, TIterator last)
+    {
+      base::insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_map()
+    {
+      base::clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_map(const intrusive_map&);
+    intrusive_map& operator =(const intrusive_map&);
+  };
+}
+
+#endif
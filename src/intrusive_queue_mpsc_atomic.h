@@ -0,0 +1,242 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC__
+#define __ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC__
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "intrusive_links.h"
+
+#if defined(ETL_ATOMIC_SUPPORTED)
+
+#include <atomic>
+
+//*****************************************************************************
+///\defgroup intrusive_queue_mpsc_atomic intrusive_queue_mpsc_atomic
+/// A lock-free, multiple producer, single consumer, intrusive First-in /
+/// first-out queue. Values are threaded through an etl::forward_link, so the
+/// queue never allocates and has no maximum size.
+///
+/// Producers push onto the front of a shared list with a compare-and-swap.
+/// The consumer takes the whole shared list with a single exchange, reverses
+/// it into first-in order, and pops from that private list until it is empty.
+/// As 'etl_next' is only written by a producer before the value is published,
+/// and only read by the consumer after it is taken, the links need not be atomic.
+/// Requires C++11 atomics.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup intrusive_queue_mpsc_atomic
+  /// An intrusive multiple producer, single consumer queue.
+  /// push may be called from any thread. All other functions must only be
+  /// called from the consumer thread.
+  /// \tparam TValue The type of value that the queue holds.
+  /// \tparam TLink  The link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink = etl::forward_link<0> >
+  class intrusive_queue_mpsc_atomic
+  {
+  public:
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_queue_mpsc_atomic()
+      : p_shared(nullptr),
+        p_private(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a value to the back of the queue.
+    /// May be called from any thread. Lock-free.
+    /// The value must not be in another container through the same link.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(reference value)
+    {
+      link_type* p_link = &value;
+      link_type* p_head = p_shared.load(std::memory_order_relaxed);
+
+      do
+      {
+        p_link->etl_next = p_head;
+      } while (!p_shared.compare_exchange_weak(p_head, p_link, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Removes the value at the front of the queue.
+    /// Consumer only.
+    ///\return A pointer to the value, or nullptr if the queue is empty.
+    //*************************************************************************
+    pointer pop()
+    {
+      if (p_private == nullptr)
+      {
+        p_private = take_shared();
+
+        if (p_private == nullptr)
+        {
+          return nullptr;
+        }
+      }
+
+      link_type* p_link = p_private;
+      p_private = static_cast<link_type*>(p_link->etl_next);
+      p_link->clear();
+
+      return static_cast<pointer>(p_link);
+    }
+
+    //*************************************************************************
+    /// Removes all of the values pushed so far, calling the function for
+    /// each in first-in order. Values pushed while draining are left for
+    /// the next call. The function may push the value back to the queue.
+    /// Consumer only.
+    ///\param function The function to call, as function(value_type&).
+    ///\return The number of values removed.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t pop_all(TFunction function)
+    {
+      link_type* p_list = p_private;
+      p_private = nullptr;
+
+      size_t count = call_for_each(p_list, function);
+
+      count += call_for_each(take_shared(), function);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    /// Consumer only.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (p_private == nullptr) && (p_shared.load(std::memory_order_acquire) == nullptr);
+    }
+
+    //*************************************************************************
+    /// Removes all of the values pushed so far.
+    /// Consumer only.
+    //*************************************************************************
+    void clear()
+    {
+      p_private = nullptr;
+      p_shared.exchange(nullptr, std::memory_order_acquire);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes the shared list and returns it in first-in order.
+    //*************************************************************************
+    link_type* take_shared()
+    {
+      // Avoid claiming the cache line when there is nothing to take.
+      if (p_shared.load(std::memory_order_relaxed) == nullptr)
+      {
+        return nullptr;
+      }
+
+      link_type* p_link     = p_shared.exchange(nullptr, std::memory_order_acquire);
+      link_type* p_reversed = nullptr;
+
+      while (p_link != nullptr)
+      {
+        link_type* p_next = static_cast<link_type*>(p_link->etl_next);
+        p_link->etl_next = p_reversed;
+        p_reversed = p_link;
+        p_link = p_next;
+      }
+
+      return p_reversed;
+    }
+
+    //*************************************************************************
+    /// Unlinks each value in the list and calls the function for it.
+    //*************************************************************************
+    template <typename TFunction>
+    static size_t call_for_each(link_type* p_link, TFunction& function)
+    {
+      size_t count = 0;
+
+      while (p_link != nullptr)
+      {
+        // Read the next link first, as the function may push the value again.
+        link_type* p_next = static_cast<link_type*>(p_link->etl_next);
+        p_link->clear();
+
+        function(*static_cast<pointer>(p_link));
+
+        p_link = p_next;
+        ++count;
+      }
+
+      return count;
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_queue_mpsc_atomic(const intrusive_queue_mpsc_atomic&);
+    intrusive_queue_mpsc_atomic& operator =(const intrusive_queue_mpsc_atomic&);
+
+    // Written by the producers.
+    std::atomic<link_type*> p_shared;  ///< The most recently pushed value.
+    char                    producer_padding[ETL_CACHE_LINE_SIZE];
+
+    // Only accessed by the consumer.
+    link_type*              p_private; ///< The oldest value taken from the shared list.
+    char                    consumer_padding[ETL_CACHE_LINE_SIZE];
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,153 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INTRUSIVE_UNORDERED_MAP__
+#define __ETL_INTRUSIVE_UNORDERED_MAP__
+
+#include <stddef.h>
+#include <functional>
+
+#include "platform.h"
+#include "hash.h"
+#include "intrusive_links.h"
+#include "private/intrusive_hash_table.h"
+
+//*****************************************************************************
+///\defgroup intrusive_unordered_map intrusive_unordered_map
+/// An intrusive unordered map with the number of buckets defined at compile time.
+/// The values are found by a key that they contain. The buckets are lists
+/// threaded through a forward link in each value, so the map never allocates
+/// and has no maximum size.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized intrusive_unordered_map.
+  /// Can be used as a reference type for all intrusive_unordered_map containing a specific type.
+  ///\ingroup intrusive_unordered_map
+  ///\note TLink must be a base of TValue.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TGetKey, typename TLink = etl::forward_link<0>, typename THash = etl::hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class iintrusive_unordered_map : public __private_intrusive_hash_table__::intrusive_hash_table<TKey, TValue, TGetKey, TLink, THash, TKeyEqual>
+  {
+  private:
+
+    typedef __private_intrusive_hash_table__::intrusive_hash_table<TKey, TValue, TGetKey, TLink, THash, TKeyEqual> base;
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iintrusive_unordered_map(typename base::bucket_t* pbuckets, size_t number_of_buckets)
+      : base(pbuckets, number_of_buckets)
+    {
+    }
+  };
+
+  //*************************************************************************
+  /// An intrusive_unordered_map with a fixed number of buckets.
+  ///\code
+  /// struct Item : public etl::forward_link<0>
+  /// {
+  ///   uint32_t id;
+  /// };
+  ///
+  /// struct ItemId
+  /// {
+  ///   const uint32_t& operator ()(const Item& item) const { return item.id; }
+  /// };
+  ///
+  /// etl::intrusive_unordered_map<uint32_t, Item, ItemId, 64> items;
+  ///\endcode
+  ///\tparam TKey        The type of key.
+  ///\tparam TValue      The type of value. Must derive from TLink.
+  ///\tparam TGetKey     A functor returning a const reference to the key of a value.
+  ///\tparam MAX_BUCKETS The number of buckets.
+  ///\tparam TLink       The link used to thread the values into a bucket.
+  ///\tparam THash       The hash function for the keys.
+  ///\tparam TKeyEqual   The equality function for the keys.
+  ///\ingroup intrusive_unordered_map
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TGetKey, const size_t MAX_BUCKETS_, typename TLink = etl::forward_link<0>, typename THash = etl::hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class intrusive_unordered_map : public etl::iintrusive_unordered_map<TKey, TValue, TGetKey, TLink, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iintrusive_unordered_map<TKey, TValue, TGetKey, TLink, THash, TKeyEqual> base;
+
+  public:
+
+    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    intrusive_unordered_map()
+      : base(buckets, MAX_BUCKETS_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a range of values to link.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first value.
+    ///\param last  The iterator to the last value + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_unordered_map(TIterator first, TIterator last)
+      : base(buckets, MAX_BUCKETS_)
+    {
+      base::insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_unordered_map()
+    {
+      base::clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_unordered_map(const intrusive_unordered_map&);
+    intrusive_unordered_map& operator =(const intrusive_unordered_map&);
+
+    /// The buckets of value lists.
+    typename base::bucket_t buckets[MAX_BUCKETS_];
+  };
+}
+
+#endif
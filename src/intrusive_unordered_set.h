@@ -0,0 +1,137 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INTRUSIVE_UNORDERED_SET__
+#define __ETL_INTRUSIVE_UNORDERED_SET__
+
+#include <stddef.h>
+#include <functional>
+
+#include "platform.h"
+#include "hash.h"
+#include "intrusive_links.h"
+#include "private/intrusive_hash_table.h"
+
+//*****************************************************************************
+///\defgroup intrusive_unordered_set intrusive_unordered_set
+/// An intrusive unordered set with the number of buckets defined at compile time.
+/// The buckets are lists threaded through a forward link in each value, so
+/// the set never allocates and has no maximum size.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized intrusive_unordered_set.
+  /// Can be used as a reference type for all intrusive_unordered_set containing a specific type.
+  ///\ingroup intrusive_unordered_set
+  ///\note TLink must be a base of TValue.
+  //***************************************************************************
+  template <typename TValue, typename TLink = etl::forward_link<0>, typename THash = etl::hash<TValue>, typename TKeyEqual = std::equal_to<TValue> >
+  class iintrusive_unordered_set : public __private_intrusive_hash_table__::intrusive_hash_table<TValue, TValue, __private_intrusive_hash_table__::identity_key<TValue>, TLink, THash, TKeyEqual>
+  {
+  private:
+
+    typedef __private_intrusive_hash_table__::intrusive_hash_table<TValue, TValue, __private_intrusive_hash_table__::identity_key<TValue>, TLink, THash, TKeyEqual> base;
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iintrusive_unordered_set(typename base::bucket_t* pbuckets, size_t number_of_buckets)
+      : base(pbuckets, number_of_buckets)
+    {
+    }
+  };
+
+  //*************************************************************************
+  /// An intrusive_unordered_set with a fixed number of buckets.
+  ///\tparam TValue      The type of value. Must derive from TLink.
+  ///\tparam MAX_BUCKETS The number of buckets.
+  ///\tparam TLink       The link used to thread the values into a bucket.
+  ///\tparam THash       The hash function for the values.
+  ///\tparam TKeyEqual   The equality function for the values.
+  ///\ingroup intrusive_unordered_set
+  //*************************************************************************
+  template <typename TValue, const size_t MAX_BUCKETS_, typename TLink = etl::forward_link<0>, typename THash = etl::hash<TValue>, typename TKeyEqual = std::equal_to<TValue> >
+  class intrusive_unordered_set : public etl::iintrusive_unordered_set<TValue, TLink, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iintrusive_unordered_set<TValue, TLink, THash, TKeyEqual> base;
+
+  public:
+
+    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    intrusive_unordered_set()
+      : base(buckets, MAX_BUCKETS_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a range of values to link.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first value.
+    ///\param last  The iterator to the last value + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_unordered_set(TIterator first, TIterator last)
+      : base(buckets, MAX_BUCKETS_)
+    {
+      base::insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_unordered_set()
+    {
+      base::clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_unordered_set(const intrusive_unordered_set&);
+    intrusive_unordered_set& operator =(const intrusive_unordered_set&);
+
+    /// The buckets of value lists.
+    typename base::bucket_t buckets[MAX_BUCKETS_];
+  };
+}
+
+#endif
@@ -31,10 +31,12 @@ SOFTWARE.
 #ifndef __ETL_MEMORY__
 #define __ETL_MEMORY__
 
+#include <string.h>
 #include <iterator>
 #include <algorithm>
 
 #include "type_traits.h"
+#include "static_assert.h"
 
 ///\defgroup memory memory
 ///\ingroup etl
@@ -662,6 +664,26 @@ namespace etl
 
     return i_begin;
   }
+
+  //*****************************************************************************
+  /// Relocates a range of objects to a destination that may overlap the source.
+  /// The objects are moved as raw memory, so the type must be trivially relocatable.
+  /// Any part of the source not overlapped by the destination is left as
+  /// uninitialised memory, and must not be destroyed.
+  ///\return A pointer to the end of the destination range.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  T* relocate(T* i_begin, T* i_end, T* o_begin)
+  {
+    STATIC_ASSERT(etl::is_trivially_relocatable<T>::value, "Type is not trivially relocatable");
+
+    size_t n = i_end - i_begin;
+
+    memmove(static_cast<void*>(o_begin), static_cast<const void*>(i_begin), n * sizeof(T));
+
+    return o_begin + n;
+  }
 }
 
 #endif
@@ -101,6 +101,17 @@ SOFTWARE.
   #define ETL_C11_ALIGNOF_SUPPORTED
 #endif
 
+// Check to see if the compiler supports C++11 'std::atomic'.
+#if (defined(ETL_COMPILER_MICROSOFT) && (_MSC_VER >= 1700)) || \
+    (defined(ETL_COMPILER_GCC) && (__cplusplus >= 201103L))
+  #define ETL_ATOMIC_SUPPORTED
+#endif
+
+// The size of a cache line, used to keep data written by different threads apart.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 // Some targets do not support 8bit types.
 #define ETL_8BIT_SUPPORT (CHAR_BIT == 8)
 
@@ -0,0 +1,411 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_ALGORITHM_SIMD__
+#define __ETL_ALGORITHM_SIMD__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+//*****************************************************************************
+// Vectorised search and reduction for contiguous ranges of integral types.
+//
+// The instruction set is selected at compile time from the target options.
+// AVX2 is used if enabled (e.g. -mavx2), otherwise SSE2, which is always
+// available on x86-64. Define ETL_NO_SIMD to use the scalar algorithms only.
+//*****************************************************************************
+
+#if !defined(ETL_NO_SIMD)
+  #if defined(__AVX2__)
+    #define ETL_SIMD_AVX2
+    #define ETL_SIMD
+  #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_SIMD_SSE2
+    #define ETL_SIMD
+  #endif
+#endif
+
+#if defined(ETL_SIMD_AVX2)
+  #include <immintrin.h>
+#elif defined(ETL_SIMD_SSE2)
+  #include <emmintrin.h>
+#endif
+
+#if defined(ETL_SIMD) && defined(ETL_COMPILER_MICROSOFT)
+  #include <intrin.h>
+#endif
+
+#if defined(ETL_SIMD)
+
+namespace etl
+{
+  namespace __private_algorithm__
+  {
+    //*************************************************************************
+    /// Integral types of 1, 2 or 4 bytes are vectorised.
+    //*************************************************************************
+    template <typename T>
+    struct is_simd_type : public etl::integral_constant<bool, etl::is_integral<T>::value &&
+                                                              !etl::is_same<T, bool>::value &&
+                                                              (sizeof(T) <= 4)>
+    {
+    };
+
+    //*************************************************************************
+    /// The index of the lowest set bit of a non-zero mask.
+    //*************************************************************************
+    inline uint32_t first_set_bit(uint32_t mask)
+    {
+#if defined(ETL_COMPILER_MICROSOFT)
+      unsigned long index;
+      _BitScanForward(&index, mask);
+      return index;
+#else
+      return __builtin_ctz(mask);
+#endif
+    }
+
+    //*************************************************************************
+    /// The index of the highest set bit of a non-zero mask.
+    //*************************************************************************
+    inline uint32_t last_set_bit(uint32_t mask)
+    {
+#if defined(ETL_COMPILER_MICROSOFT)
+      unsigned long index;
+      _BitScanReverse(&index, mask);
+      return index;
+#else
+      return 31 - __builtin_clz(mask);
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of set bits in a mask.
+    //*************************************************************************
+    inline uint32_t count_bits(uint32_t mask)
+    {
+      mask = mask - ((mask >> 1) & 0x55555555UL);
+      mask = (mask & 0x33333333UL) + ((mask >> 2) & 0x33333333UL);
+      mask = (mask + (mask >> 4)) & 0x0F0F0F0FUL;
+
+      return uint32_t(mask * 0x01010101UL) >> 24;
+    }
+
+#if defined(ETL_SIMD_AVX2)
+    //*************************************************************************
+    /// AVX2 registers.
+    //*************************************************************************
+    struct simd
+    {
+      typedef __m256i reg_t;
+
+      static const size_t BYTES = 32;
+
+      static reg_t    load(const void* p)          { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+      static void     store(void* p, reg_t a)      { _mm256_storeu_si256(static_cast<__m256i*>(p), a); }
+      static reg_t    bit_and(reg_t a, reg_t b)    { return _mm256_and_si256(a, b); }
+      static reg_t    bit_andnot(reg_t a, reg_t b) { return _mm256_andnot_si256(a, b); }
+      static reg_t    bit_or(reg_t a, reg_t b)     { return _mm256_or_si256(a, b); }
+      static reg_t    bit_xor(reg_t a, reg_t b)    { return _mm256_xor_si256(a, b); }
+      static uint32_t mask(reg_t a)                { return uint32_t(_mm256_movemask_epi8(a)); }
+
+      template <const size_t LANE>
+      struct lane;
+    };
+
+    template <>
+    struct simd::lane<1>
+    {
+      static reg_t set(int8_t value)         { return _mm256_set1_epi8(value); }
+      static reg_t equal(reg_t a, reg_t b)   { return _mm256_cmpeq_epi8(a, b); }
+      static reg_t greater(reg_t a, reg_t b) { return _mm256_cmpgt_epi8(a, b); }
+    };
+
+    template <>
+    struct simd::lane<2>
+    {
+      static reg_t set(int16_t value)        { return _mm256_set1_epi16(value); }
+      static reg_t equal(reg_t a, reg_t b)   { return _mm256_cmpeq_epi16(a, b); }
+      static reg_t greater(reg_t a, reg_t b) { return _mm256_cmpgt_epi16(a, b); }
+    };
+
+    template <>
+    struct simd::lane<4>
+    {
+      static reg_t set(int32_t value)        { return _mm256_set1_epi32(value); }
+      static reg_t equal(reg_t a, reg_t b)   { return _mm256_cmpeq_epi32(a, b); }
+      static reg_t greater(reg_t a, reg_t b) { return _mm256_cmpgt_epi32(a, b); }
+    };
+#else
+    //*************************************************************************
+    /// SSE2 registers.
+    //*************************************************************************
+    struct simd
+    {
+      typedef __m128i reg_t;
+
+      static const size_t BYTES = 16;
+
+      static reg_t    load(const void* p)          { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+      static void     store(void* p, reg_t a)      { _mm_storeu_si128(static_cast<__m128i*>(p), a); }
+      static reg_t    bit_and(reg_t a, reg_t b)    { return _mm_and_si128(a, b); }
+      static reg_t    bit_andnot(reg_t a, reg_t b) { return _mm_andnot_si128(a, b); }
+      static reg_t    bit_or(reg_t a, reg_t b)     { return _mm_or_si128(a, b); }
+      static reg_t    bit_xor(reg_t a, reg_t b)    { return _mm_xor_si128(a, b); }
+      static uint32_t mask(reg_t a)                { return uint32_t(_mm_movemask_epi8(a)); }
+
+      template <const size_t LANE>
+      struct lane;
+    };
+
+    template <>
+    struct simd::lane<1>
+    {
+      static reg_t set(int8_t value)         { return _mm_set1_epi8(value); }
+      static reg_t equal(reg_t a, reg_t b)   { return _mm_cmpeq_epi8(a, b); }
+      static reg_t greater(reg_t a, reg_t b) { return _mm_cmpgt_epi8(a, b); }
+    };
+
+    template <>
+    struct simd::lane<2>
+    {
+      static reg_t set(int16_t value)        { return _mm_set1_epi16(value); }
+      static reg_t equal(reg_t a, reg_t b)   { return _mm_cmpeq_epi16(a, b); }
+      static reg_t greater(reg_t a, reg_t b) { return _mm_cmpgt_epi16(a, b); }
+    };
+
+    template <>
+    struct simd::lane<4>
+    {
+      static reg_t set(int32_t value)        { return _mm_set1_epi32(value); }
+      static reg_t equal(reg_t a, reg_t b)   { return _mm_cmpeq_epi32(a, b); }
+      static reg_t greater(reg_t a, reg_t b) { return _mm_cmpgt_epi32(a, b); }
+    };
+#endif
+
+    //*************************************************************************
+    /// Lane operations for type T.
+    /// Unsigned values have their sign bit flipped before ordered comparisons,
+    /// so that the signed compare instructions may be used.
+    //*************************************************************************
+    template <typename T>
+    struct simd_lanes
+    {
+      typedef simd::reg_t           reg_t;
+      typedef simd::lane<sizeof(T)> lane_t;
+
+      typedef typename etl::conditional<sizeof(T) == 1, int8_t,
+              typename etl::conditional<sizeof(T) == 2, int16_t, int32_t>::type>::type signed_t;
+
+      static const size_t COUNT = simd::BYTES / sizeof(T);
+
+      static reg_t set(T value)
+      {
+        return lane_t::set(signed_t(value));
+      }
+
+      static reg_t bias()
+      {
+        return etl::is_signed<T>::value ? lane_t::set(0) : lane_t::set(signed_t(signed_t(1) << ((8 * sizeof(T)) - 1)));
+      }
+
+      static reg_t select(reg_t mask, reg_t a, reg_t b)
+      {
+        return simd::bit_or(simd::bit_and(mask, a), simd::bit_andnot(mask, b));
+      }
+    };
+
+    //*************************************************************************
+    /// Finds the first element equal to value.
+    //*************************************************************************
+    template <typename T>
+    const T* find(const T* begin, const T* end, T value)
+    {
+      typedef simd_lanes<T> lanes;
+
+      const typename lanes::reg_t needle = lanes::set(value);
+
+      while (size_t(end - begin) >= lanes::COUNT)
+      {
+        uint32_t mask = simd::mask(lanes::lane_t::equal(simd::load(begin), needle));
+
+        if (mask != 0)
+        {
+          return begin + (first_set_bit(mask) / sizeof(T));
+        }
+
+        begin += lanes::COUNT;
+      }
+
+      while ((begin != end) && !(*begin == value))
+      {
+        ++begin;
+      }
+
+      return begin;
+    }
+
+    //*************************************************************************
+    /// Counts the elements equal to value.
+    //*************************************************************************
+    template <typename T>
+    ptrdiff_t count(const T* begin, const T* end, T value)
+    {
+      typedef simd_lanes<T> lanes;
+
+      const typename lanes::reg_t needle = lanes::set(value);
+
+      ptrdiff_t n = 0;
+
+      while (size_t(end - begin) >= lanes::COUNT)
+      {
+        n += count_bits(simd::mask(lanes::lane_t::equal(simd::load(begin), needle))) / sizeof(T);
+        begin += lanes::COUNT;
+      }
+
+      while (begin != end)
+      {
+        n += (*begin == value) ? 1 : 0;
+        ++begin;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Finds the first element that is less than the one before it.
+    //*************************************************************************
+    template <typename T>
+    const T* is_sorted_until(const T* begin, const T* end)
+    {
+      typedef simd_lanes<T> lanes;
+
+      if (begin == end)
+      {
+        return end;
+      }
+
+      const typename lanes::reg_t bias = lanes::bias();
+
+      // Compare each element with the next.
+      while (size_t(end - begin) > lanes::COUNT)
+      {
+        typename lanes::reg_t current = simd::bit_xor(simd::load(begin), bias);
+        typename lanes::reg_t next    = simd::bit_xor(simd::load(begin + 1), bias);
+
+        uint32_t mask = simd::mask(lanes::lane_t::greater(current, next));
+
+        if (mask != 0)
+        {
+          return begin + 1 + (first_set_bit(mask) / sizeof(T));
+        }
+
+        begin += lanes::COUNT;
+      }
+
+      const T* next = begin;
+
+      while (++next != end)
+      {
+        if (*next < *begin)
+        {
+          return next;
+        }
+
+        ++begin;
+      }
+
+      return end;
+    }
+
+    //*************************************************************************
+    /// Finds the first smallest and the first greatest element.
+    /// The values are found in one vectorised pass, then located with find.
+    //*************************************************************************
+    template <typename T>
+    void minmax_element(const T* begin, const T* end, const T*& p_minimum, const T*& p_maximum)
+    {
+      typedef simd_lanes<T> lanes;
+
+      T minimum = *begin;
+      T maximum = *begin;
+
+      const T* itr = begin;
+
+      if (size_t(end - itr) >= lanes::COUNT)
+      {
+        const typename lanes::reg_t bias = lanes::bias();
+
+        typename lanes::reg_t vminimum = simd::bit_xor(simd::load(itr), bias);
+        typename lanes::reg_t vmaximum = vminimum;
+        itr += lanes::COUNT;
+
+        while (size_t(end - itr) >= lanes::COUNT)
+        {
+          typename lanes::reg_t value = simd::bit_xor(simd::load(itr), bias);
+
+          vminimum = lanes::select(lanes::lane_t::greater(vminimum, value), value, vminimum);
+          vmaximum = lanes::select(lanes::lane_t::greater(value, vmaximum), value, vmaximum);
+
+          itr += lanes::COUNT;
+        }
+
+        T minimums[lanes::COUNT];
+        T maximums[lanes::COUNT];
+
+        simd::store(minimums, simd::bit_xor(vminimum, bias));
+        simd::store(maximums, simd::bit_xor(vmaximum, bias));
+
+        for (size_t i = 0; i < lanes::COUNT; ++i)
+        {
+          minimum = (minimums[i] < minimum) ? minimums[i] : minimum;
+          maximum = (maximum < maximums[i]) ? maximums[i] : maximum;
+        }
+      }
+
+      while (itr != end)
+      {
+        minimum = (*itr < minimum) ? *itr : minimum;
+        maximum = (maximum < *itr) ? *itr : maximum;
+        ++itr;
+      }
+
+      p_minimum = __private_algorithm__::find(begin, end, minimum);
+      p_maximum = __private_algorithm__::find(begin, end, maximum);
+    }
+  }
+}
+
+#endif
+#endif
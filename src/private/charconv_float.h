@@ -0,0 +1,2053 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_CHARCONV_FLOAT__
+#define __ETL_CHARCONV_FLOAT__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../binary.h"
+
+//*****************************************************************************
+// Floating point conversions for charconv.h.
+//
+// Formatting produces the shortest digits that read back as the original
+// value, choosing the closest to the value if there are several.
+// Grisu3 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+// with Integers") handles about 99.5% of values with 64 bit arithmetic.
+// The remainder are detected, and handled exactly with big integers (Dragon4).
+//
+// Parsing is correctly rounded (round to nearest, ties to even).
+// The first 19 significant digits are accumulated in 64 bits.
+//  1. If the digits and the power of ten are both exact in the type, one
+//     floating point multiply or divide gives the result (Clinger).
+//  2. Otherwise the digits are multiplied by a 64 bit approximation of the
+//     power of ten. This is accurate to a few units in the last place, and
+//     decides the rounding unless the value is close to halfway.
+//  3. Close to halfway, the value is compared exactly with the halfway point
+//     using big integers. All of the digits are used, up to 800, which is more
+//     than can affect the result. This needs about 700 bytes of stack.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_charconv__
+  {
+    extern const uint64_t CACHED_POWER_SIGNIFICANDS[];
+    extern const int16_t  CACHED_POWER_EXPONENTS[];
+    extern const double   EXACT_POWERS_OF_TEN[];
+
+    // The digits accumulated in the 64 bit significand when parsing.
+    static const int MAX_SIGNIFICAND_DIGITS = 19;
+
+    //*************************************************************************
+    /// The range of the cached powers of ten.
+    //*************************************************************************
+    struct cached_powers
+    {
+      static const int MIN_DECIMAL_EXPONENT  = -348;
+      static const int DECIMAL_EXPONENT_STEP = 8;
+    };
+
+    //*************************************************************************
+    /// The IEEE 754 binary formats.
+    /// A value is significand * 2^(biased exponent - EXPONENT_BIAS).
+    /// Decimal magnitudes are the exponent of the smallest power of ten that
+    /// is greater than the value.
+    //*************************************************************************
+    template <typename T>
+    struct float_traits;
+
+    template <>
+    struct float_traits<double>
+    {
+      typedef uint64_t bits_t;
+
+      static const int SIGNIFICAND_BITS      = 53;   ///< Including the hidden bit.
+      static const int EXPONENT_BIAS         = 1075;
+      static const int MAX_EXPONENT_FIELD    = 2047;
+      static const int MAX_EXACT_POWER       = 22;   ///< The largest exact power of ten.
+      static const int MIN_DECIMAL_MAGNITUDE = -324; ///< At or below this, values round to zero.
+      static const int MAX_DECIMAL_MAGNITUDE = 309;  ///< Above this, values overflow.
+    };
+
+    template <>
+    struct float_traits<float>
+    {
+      typedef uint32_t bits_t;
+
+      static const int SIGNIFICAND_BITS      = 24;
+      static const int EXPONENT_BIAS         = 150;
+      static const int MAX_EXPONENT_FIELD    = 255;
+      static const int MAX_EXACT_POWER       = 10;
+      static const int MIN_DECIMAL_MAGNITUDE = -46;
+      static const int MAX_DECIMAL_MAGNITUDE = 39;
+    };
+
+    //*************************************************************************
+    /// float and double are supported.
+    //*************************************************************************
+    template <typename T>
+    struct is_float : public etl::integral_constant<bool, etl::is_same<T, float>::value || etl::is_same<T, double>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// A floating point value with a 64 bit significand, f * 2^e.
+    //*************************************************************************
+    struct diy_fp
+    {
+      diy_fp()
+        : f(0),
+          e(0)
+      {
+      }
+
+      diy_fp(uint64_t f_, int e_)
+        : f(f_),
+          e(e_)
+      {
+      }
+
+      //***********************************************************************
+      /// x - y. The exponents must be the same.
+      //***********************************************************************
+      static diy_fp sub(const diy_fp& x, const diy_fp& y)
+      {
+        return diy_fp(x.f - y.f, x.e);
+      }
+
+      //***********************************************************************
+      /// x * y, rounded to the upper 64 bits of the product.
+      //***********************************************************************
+      static diy_fp mul(const diy_fp& x, const diy_fp& y)
+      {
+        const uint64_t MASK = 0xFFFFFFFFULL;
+
+        const uint64_t a = x.f >> 32;
+        const uint64_t b = x.f & MASK;
+        const uint64_t c = y.f >> 32;
+        const uint64_t d = y.f & MASK;
+
+        const uint64_t ac = a * c;
+        const uint64_t bc = b * c;
+        const uint64_t ad = a * d;
+        const uint64_t bd = b * d;
+
+        uint64_t middle = (bd >> 32) + (ad & MASK) + (bc & MASK);
+        middle += uint64_t(1) << 31;
+
+        return diy_fp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32), x.e + y.e + 64);
+      }
+
+      //***********************************************************************
+      /// Shifts the significand so that the top bit is set. f must not be zero.
+      //***********************************************************************
+      static diy_fp normalize(const diy_fp& x)
+      {
+        const int shift = etl::count_leading_zeros(x.f);
+
+        return diy_fp(x.f << shift, x.e - shift);
+      }
+
+      //***********************************************************************
+      /// Shifts the significand to give the exponent e, which must be <= x.e.
+      //***********************************************************************
+      static diy_fp normalize_to(const diy_fp& x, int e)
+      {
+        return diy_fp(x.f << (x.e - e), e);
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //*************************************************************************
+    /// The cached power of ten at the index, and its decimal exponent.
+    //*************************************************************************
+    inline diy_fp cached_power(int index)
+    {
+      return diy_fp(CACHED_POWER_SIGNIFICANDS[index], CACHED_POWER_EXPONENTS[index]);
+    }
+
+    inline int cached_power_decimal_exponent(int index)
+    {
+      return cached_powers::MIN_DECIMAL_EXPONENT + (index * cached_powers::DECIMAL_EXPONENT_STEP);
+    }
+
+    //*************************************************************************
+    /// The raw bits of a value.
+    //*************************************************************************
+    template <typename T>
+    typename float_traits<T>::bits_t get_bits(T value)
+    {
+      typename float_traits<T>::bits_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      return bits;
+    }
+
+    //*************************************************************************
+    /// A value from its raw bits.
+    //*************************************************************************
+    template <typename T>
+    T from_bits(typename float_traits<T>::bits_t bits)
+    {
+      T value;
+      memcpy(&value, &bits, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Grisu2
+    //*************************************************************************
+    namespace grisu
+    {
+      // The target exponent range of the scaled boundaries.
+      static const int ALPHA = -60;
+      static const int GAMMA = -32;
+
+      //***********************************************************************
+      /// The normalised value and the boundaries halfway to its neighbours.
+      /// The value must be finite and positive.
+      //***********************************************************************
+      template <typename T>
+      void boundaries(T value, diy_fp& w, diy_fp& w_minus, diy_fp& w_plus)
+      {
+        typedef float_traits<T>                   traits;
+        typedef typename float_traits<T>::bits_t bits_t;
+
+        const bits_t HIDDEN_BIT = bits_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+        const bits_t bits     = get_bits(value);
+        const bits_t fraction = bits & (HIDDEN_BIT - 1);
+        const int    biased   = int(bits >> (traits::SIGNIFICAND_BITS - 1)) & traits::MAX_EXPONENT_FIELD;
+
+        const diy_fp v = (biased == 0) ? diy_fp(fraction, 1 - traits::EXPONENT_BIAS)
+                                       : diy_fp(fraction + HIDDEN_BIT, biased - traits::EXPONENT_BIAS);
+
+        // The gap below is half the size when the value is a power of two.
+        const bool lower_is_closer = (fraction == 0) && (biased > 1);
+
+        const diy_fp m_plus(2 * v.f + 1, v.e - 1);
+        const diy_fp m_minus = lower_is_closer ? diy_fp(4 * v.f - 1, v.e - 2)
+                                               : diy_fp(2 * v.f - 1, v.e - 1);
+
+        w_plus  = diy_fp::normalize(m_plus);
+        w_minus = diy_fp::normalize_to(m_minus, w_plus.e);
+        w       = diy_fp::normalize(v);
+      }
+
+      //***********************************************************************
+      /// The number of decimal digits in n, and the largest power of ten <= n.
+      //***********************************************************************
+      inline int largest_power_of_ten(uint32_t n, uint32_t& power)
+      {
+        static const uint32_t POWERS[] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL };
+
+        int digits = 10;
+
+        while ((digits > 1) && (n < POWERS[digits - 1]))
+        {
+          --digits;
+        }
+
+        power = POWERS[digits - 1];
+
+        return digits;
+      }
+
+      //***********************************************************************
+      /// Moves the last digit towards the value while the result stays
+      /// within the unsafe interval and gets closer.
+      ///\return <b>true</b> if the digits are certain to be the closest and
+      /// within the boundaries, allowing for the error of 'unit'.
+      //***********************************************************************
+      inline bool round_weed(char* buffer, int length, uint64_t distance_too_high_w, uint64_t unsafe_interval, uint64_t rest, uint64_t ten_kappa, uint64_t unit)
+      {
+        const uint64_t small_distance = distance_too_high_w - unit;
+        const uint64_t big_distance   = distance_too_high_w + unit;
+
+        while ((rest < small_distance) &&
+               ((unsafe_interval - rest) >= ten_kappa) &&
+               (((rest + ten_kappa) < small_distance) || ((small_distance - rest) >= (rest + ten_kappa - small_distance))))
+        {
+          --buffer[length - 1];
+          rest += ten_kappa;
+        }
+
+        // Could the next digit down be closer?
+        if ((rest < big_distance) &&
+            ((unsafe_interval - rest) >= ten_kappa) &&
+            (((rest + ten_kappa) < big_distance) || ((big_distance - rest) > (rest + ten_kappa - big_distance))))
+        {
+          return false;
+        }
+
+        // Is the result safely inside the boundaries?
+        return ((2 * unit) <= rest) && (rest <= (unsafe_interval - (4 * unit)));
+      }
+
+      //***********************************************************************
+      /// Generates the shortest digits in the interval (low, high), each of
+      /// which is one unit from the exact boundary, and rounds them towards w.
+      ///\return <b>false</b> if the result cannot be proved to be correct.
+      //***********************************************************************
+      inline bool generate_digits(char* buffer, int& length, int& kappa, const diy_fp& low, const diy_fp& w, const diy_fp& high)
+      {
+        uint64_t unit = 1;
+
+        const diy_fp too_low(low.f - unit, low.e);
+        const diy_fp too_high(high.f + unit, high.e);
+        const diy_fp one(uint64_t(1) << -w.e, w.e);
+
+        uint64_t unsafe_interval = diy_fp::sub(too_high, too_low).f;
+        uint32_t integral        = uint32_t(too_high.f >> -one.e);
+        uint64_t fractional      = too_high.f & (one.f - 1);
+
+        uint32_t power;
+        kappa  = largest_power_of_ten(integral, power);
+        length = 0;
+
+        // The integral part.
+        while (kappa > 0)
+        {
+          buffer[length++] = char('0' + (integral / power));
+          integral %= power;
+          --kappa;
+
+          const uint64_t rest = (uint64_t(integral) << -one.e) + fractional;
+
+          if (rest < unsafe_interval)
+          {
+            return round_weed(buffer, length, diy_fp::sub(too_high, w).f, unsafe_interval, rest, uint64_t(power) << -one.e, unit);
+          }
+
+          power /= 10;
+        }
+
+        // The fractional part.
+        while (true)
+        {
+          fractional      *= 10;
+          unit            *= 10;
+          unsafe_interval *= 10;
+
+          buffer[length++] = char('0' + (fractional >> -one.e));
+          fractional &= (one.f - 1);
+          --kappa;
+
+          if (fractional < unsafe_interval)
+          {
+            return round_weed(buffer, length, diy_fp::sub(too_high, w).f * unit, unsafe_interval, fractional, one.f, unit);
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Generates the shortest digits of a finite, positive value.
+      /// The value is digits * 10^decimal_exponent.
+      ///\return <b>false</b> if the result could not be proved to be the
+      /// shortest and closest. This happens for about 0.5% of values.
+      //***********************************************************************
+      template <typename T>
+      bool grisu3(T value, char* buffer, int& length, int& decimal_exponent)
+      {
+        diy_fp w;
+        diy_fp w_minus;
+        diy_fp w_plus;
+
+        boundaries(value, w, w_minus, w_plus);
+
+        // Find the cached power c = 10^-k, such that ALPHA <= c.e + w.e + 64 <= GAMMA.
+        const int f     = ALPHA - w.e - 1;
+        const int k     = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+        const int index = (-cached_powers::MIN_DECIMAL_EXPONENT + k + (cached_powers::DECIMAL_EXPONENT_STEP - 1)) / cached_powers::DECIMAL_EXPONENT_STEP;
+
+        const diy_fp c = cached_power(index);
+
+        int kappa;
+
+        const bool result = generate_digits(buffer, length, kappa, diy_fp::mul(w_minus, c), diy_fp::mul(w, c), diy_fp::mul(w_plus, c));
+
+        decimal_exponent = kappa - cached_power_decimal_exponent(index);
+
+        return result;
+      }
+    }
+
+    // The capacity of the big integers, in 32 bit words.
+    static const size_t FORMAT_WORDS = 40; ///< For 2^1080, when formatting.
+    static const size_t PARSE_WORDS  = 90; ///< For (2^54 * 5^1124), when parsing.
+
+    //*************************************************************************
+    /// An unsigned integer of fixed capacity, for exact comparisons and conversions.
+    //*************************************************************************
+    template <size_t MAX_WORDS>
+    class big_integer
+    {
+    public:
+
+      big_integer()
+        : size(0)
+      {
+      }
+
+      explicit big_integer(uint64_t value)
+        : size(0)
+      {
+        while (value != 0)
+        {
+          words[size++] = uint32_t(value);
+          value >>= 32;
+        }
+      }
+
+      //***********************************************************************
+      /// Multiplies by a 32 bit factor.
+      //***********************************************************************
+      void multiply(uint32_t factor)
+      {
+        multiply_add(factor, 0);
+      }
+
+      //***********************************************************************
+      /// Multiplies by a 32 bit factor and adds a 32 bit value.
+      //***********************************************************************
+      void multiply_add(uint32_t factor, uint32_t addend)
+      {
+        uint64_t carry = addend;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+          const uint64_t product = (uint64_t(words[i]) * factor) + carry;
+
+          words[i] = uint32_t(product);
+          carry    = product >> 32;
+        }
+
+        if (carry != 0)
+        {
+          words[size++] = uint32_t(carry);
+        }
+      }
+
+      //***********************************************************************
+      /// Divides by a 32 bit divisor.
+      ///\return The remainder.
+      //***********************************************************************
+      uint32_t divide(uint32_t divisor)
+      {
+        uint64_t remainder = 0;
+        size_t   i         = size;
+
+        while (i-- != 0)
+        {
+          const uint64_t dividend = (remainder << 32) | words[i];
+
+          words[i]  = uint32_t(dividend / divisor);
+          remainder = dividend % divisor;
+        }
+
+        while ((size != 0) && (words[size - 1] == 0))
+        {
+          --size;
+        }
+
+        return uint32_t(remainder);
+      }
+
+      //***********************************************************************
+      /// Is the value zero?
+      //***********************************************************************
+      bool is_zero() const
+      {
+        return size == 0;
+      }
+
+      //***********************************************************************
+      /// Multiplies by 5^n.
+      //***********************************************************************
+      void multiply_power_of_five(int n)
+      {
+        // 5^13 is the largest power of five that fits in 32 bits.
+        while (n >= 13)
+        {
+          multiply(1220703125UL);
+          n -= 13;
+        }
+
+        uint32_t factor = 1;
+
+        while (n-- > 0)
+        {
+          factor *= 5;
+        }
+
+        multiply(factor);
+      }
+
+      //***********************************************************************
+      /// Multiplies by 10^n.
+      //***********************************************************************
+      void multiply_power_of_ten(int n)
+      {
+        multiply_power_of_five(n);
+        shift_left(n);
+      }
+
+      //***********************************************************************
+      /// Adds another value.
+      //***********************************************************************
+      void add(const big_integer& other)
+      {
+        const size_t length = (size > other.size) ? size : other.size;
+
+        uint64_t carry = 0;
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          const uint64_t sum = carry + ((i < size) ? words[i] : 0) + ((i < other.size) ? other.words[i] : 0);
+
+          words[i] = uint32_t(sum);
+          carry    = sum >> 32;
+        }
+
+        size = length;
+
+        if (carry != 0)
+        {
+          words[size++] = uint32_t(carry);
+        }
+      }
+
+      //***********************************************************************
+      /// Subtracts another value, which must not be greater.
+      //***********************************************************************
+      void subtract(const big_integer& other)
+      {
+        uint32_t borrow = 0;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+          const uint64_t difference = uint64_t(((i < other.size) ? other.words[i] : 0)) + borrow;
+
+          borrow   = (words[i] < difference) ? 1 : 0;
+          words[i] = uint32_t(words[i] - difference);
+        }
+
+        while ((size != 0) && (words[size - 1] == 0))
+        {
+          --size;
+        }
+      }
+
+      //***********************************************************************
+      /// Divides by 2^n, rounding down.
+      ///\return <b>true</b> if any of the bits shifted out were set.
+      //***********************************************************************
+      bool shift_right(int n)
+      {
+        const size_t word_shift = size_t(n / 32);
+        const int    bit_shift  = n % 32;
+
+        if (word_shift >= size)
+        {
+          const bool lost = (size != 0);
+          size = 0;
+          return lost;
+        }
+
+        bool lost = false;
+
+        for (size_t i = 0; i < word_shift; ++i)
+        {
+          lost = lost || (words[i] != 0);
+        }
+
+        if (bit_shift != 0)
+        {
+          lost = lost || ((words[word_shift] & ((uint32_t(1) << bit_shift) - 1)) != 0);
+        }
+
+        const size_t new_size = size - word_shift;
+
+        for (size_t i = 0; i < new_size; ++i)
+        {
+          uint32_t word = words[i + word_shift];
+
+          if (bit_shift != 0)
+          {
+            word >>= bit_shift;
+
+            if ((i + word_shift + 1) < size)
+            {
+              word |= words[i + word_shift + 1] << (32 - bit_shift);
+            }
+          }
+
+          words[i] = word;
+        }
+
+        size = new_size;
+
+        while ((size != 0) && (words[size - 1] == 0))
+        {
+          --size;
+        }
+
+        return lost;
+      }
+
+      //***********************************************************************
+      /// Removes and returns the bits from 2^n upwards, which must fit in 32 bits.
+      //***********************************************************************
+      uint32_t split(int n)
+      {
+        const size_t word_index = size_t(n / 32);
+        const int    bit_shift  = n % 32;
+
+        if (word_index >= size)
+        {
+          return 0;
+        }
+
+        uint64_t high = words[word_index] >> bit_shift;
+
+        if ((word_index + 1) < size)
+        {
+          high |= uint64_t(words[word_index + 1]) << (32 - bit_shift);
+        }
+
+        words[word_index] &= (uint32_t(1) << bit_shift) - 1;
+        size = word_index + 1;
+
+        while ((size != 0) && (words[size - 1] == 0))
+        {
+          --size;
+        }
+
+        return uint32_t(high);
+      }
+
+      //***********************************************************************
+      /// Is the value odd?
+      //***********************************************************************
+      bool is_odd() const
+      {
+        return (size != 0) && ((words[0] & 1) != 0);
+      }
+
+      //***********************************************************************
+      /// Multiplies by 2^n.
+      //***********************************************************************
+      void shift_left(int n)
+      {
+        if (size == 0)
+        {
+          return;
+        }
+
+        const size_t word_shift = size_t(n / 32);
+        const int    bit_shift  = n % 32;
+
+        if (bit_shift != 0)
+        {
+          words[size] = 0;
+
+          for (size_t i = size; i > 0; --i)
+          {
+            words[i] = (words[i] << bit_shift) | (words[i - 1] >> (32 - bit_shift));
+          }
+
+          words[0] <<= bit_shift;
+
+          if (words[size] != 0)
+          {
+            ++size;
+          }
+        }
+
+        if (word_shift != 0)
+        {
+          memmove(words + word_shift, words, size * sizeof(uint32_t));
+          memset(words, 0, word_shift * sizeof(uint32_t));
+          size += word_shift;
+        }
+      }
+
+      //***********************************************************************
+      /// Returns less than, equal to or greater than zero, as for memcmp.
+      //***********************************************************************
+      static int compare(const big_integer& lhs, const big_integer& rhs)
+      {
+        if (lhs.size != rhs.size)
+        {
+          return (lhs.size < rhs.size) ? -1 : 1;
+        }
+
+        size_t i = lhs.size;
+
+        while (i-- != 0)
+        {
+          if (lhs.words[i] != rhs.words[i])
+          {
+            return (lhs.words[i] < rhs.words[i]) ? -1 : 1;
+          }
+        }
+
+        return 0;
+      }
+
+    private:
+
+      uint32_t words[MAX_WORDS];
+      size_t   size;
+    };
+
+    //*************************************************************************
+    /// Generates the shortest, closest digits of a finite, positive value
+    /// exactly, using big integers (Steele and White, Burger and Dybvig).
+    /// Used when Grisu3 cannot prove its result.
+    /// The value is digits * 10^decimal_exponent.
+    //*************************************************************************
+    template <typename T>
+    void dragon4(T value, char* buffer, int& length, int& decimal_exponent)
+    {
+      typedef float_traits<T>                   traits;
+      typedef typename float_traits<T>::bits_t bits_t;
+      typedef big_integer<FORMAT_WORDS>         big_integer_t;
+
+      const bits_t HIDDEN_BIT = bits_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+      const bits_t bits     = get_bits(value);
+      const bits_t fraction = bits & (HIDDEN_BIT - 1);
+      const int    biased   = int(bits >> (traits::SIGNIFICAND_BITS - 1)) & traits::MAX_EXPONENT_FIELD;
+
+      const uint64_t f = (biased == 0) ? uint64_t(fraction) : uint64_t(fraction | HIDDEN_BIT);
+      const int      e = (biased == 0) ? (1 - traits::EXPONENT_BIAS) : (biased - traits::EXPONENT_BIAS);
+
+      const bool lower_is_closer = (fraction == 0) && (biased > 1);
+
+      // The boundaries read back as this value under ties to even.
+      const bool inclusive = (f & 1) == 0;
+
+      // value = r / s. The boundaries are (r - m_minus) / s and (r + m_plus) / s.
+      // Everything is scaled by 2, or 4 if the lower boundary is closer, to make the boundaries integers.
+      const int scale = lower_is_closer ? 2 : 1;
+
+      big_integer_t r(f);
+      big_integer_t s(1);
+      big_integer_t m_plus(lower_is_closer ? 2 : 1);
+      big_integer_t m_minus(1);
+
+      r.shift_left(scale);
+      s.shift_left(scale);
+
+      if (e >= 0)
+      {
+        r.shift_left(e);
+        m_plus.shift_left(e);
+        m_minus.shift_left(e);
+      }
+      else
+      {
+        s.shift_left(-e);
+      }
+
+      // An estimate of the decimal magnitude, never too large.
+      const int x = e + (64 - etl::count_leading_zeros(f)) - 1;
+      int k = ((x * 78913) / (1 << 18)) + ((x > 0) ? 1 : 0) - 1;
+
+      if (k >= 0)
+      {
+        s.multiply_power_of_ten(k);
+      }
+      else
+      {
+        r.multiply_power_of_ten(-k);
+        m_plus.multiply_power_of_ten(-k);
+        m_minus.multiply_power_of_ten(-k);
+      }
+
+      // Correct the estimate, so that the upper boundary is below 10^k.
+      while (true)
+      {
+        big_integer_t high(r);
+        high.add(m_plus);
+
+        const int comparison = big_integer_t::compare(high, s);
+
+        if (inclusive ? (comparison < 0) : (comparison <= 0))
+        {
+          break;
+        }
+
+        s.multiply(10);
+        ++k;
+      }
+
+      length = 0;
+
+      while (true)
+      {
+        r.multiply(10);
+        m_plus.multiply(10);
+        m_minus.multiply(10);
+
+        int digit = 0;
+
+        while (big_integer_t::compare(r, s) >= 0)
+        {
+          r.subtract(s);
+          ++digit;
+        }
+
+        // Would stopping here, or rounding up, be within the boundaries?
+        const int  low_comparison = big_integer_t::compare(r, m_minus);
+        const bool low            = inclusive ? (low_comparison <= 0) : (low_comparison < 0);
+
+        big_integer_t high_sum(r);
+        high_sum.add(m_plus);
+
+        const int  high_comparison = big_integer_t::compare(high_sum, s);
+        const bool high            = inclusive ? (high_comparison >= 0) : (high_comparison > 0);
+
+        if (low && high)
+        {
+          // Round to the closer.
+          big_integer_t twice(r);
+          twice.shift_left(1);
+
+          const int comparison = big_integer_t::compare(twice, s);
+
+          if ((comparison > 0) || ((comparison == 0) && ((digit & 1) != 0)))
+          {
+            ++digit;
+          }
+        }
+        else if (high)
+        {
+          ++digit;
+        }
+
+        buffer[length++] = char('0' + digit);
+
+        if (low || high)
+        {
+          break;
+        }
+      }
+
+      decimal_exponent = k - length;
+    }
+
+    //*************************************************************************
+    /// Writes the decimal digits of a value, which is destroyed.
+    ///\return The number of digits. Zero is written as "0".
+    //*************************************************************************
+    inline int to_decimal(big_integer<FORMAT_WORDS>& value, char* buffer)
+    {
+      int length = 0;
+
+      do
+      {
+        uint32_t chunk = value.divide(1000000000UL);
+
+        for (int i = 0; i < 9; ++i)
+        {
+          buffer[length++] = char('0' + (chunk % 10));
+          chunk /= 10;
+        }
+      } while (!value.is_zero());
+
+      while ((length > 1) && (buffer[length - 1] == '0'))
+      {
+        --length;
+      }
+
+      std::reverse(buffer, buffer + length);
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Is fixed notation no longer than scientific, for digits * 10^decimal_exponent?
+    //*************************************************************************
+    inline bool is_fixed_shorter(int length, int decimal_exponent)
+    {
+      // The position of the decimal point, relative to the first digit.
+      const int point    = length + decimal_exponent;
+      const int exponent = point - 1;
+
+      int fixed_length;
+
+      if (point >= length)
+      {
+        fixed_length = point;
+      }
+      else if (point > 0)
+      {
+        fixed_length = length + 1;
+      }
+      else
+      {
+        fixed_length = 2 - point + length;
+      }
+
+      const int magnitude         = (exponent < 0) ? -exponent : exponent;
+      const int scientific_length = length + ((length > 1) ? 1 : 0) + 2 + ((magnitude >= 100) ? 3 : 2);
+
+      return fixed_length <= scientific_length;
+    }
+
+    //*************************************************************************
+    /// Writes digits * 10^decimal_exponent in the shorter of fixed and
+    /// scientific notation, preferring fixed.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename TChar>
+    TChar* format_shortest(TChar* p, const char* digits, int length, int decimal_exponent)
+    {
+      // The position of the decimal point, relative to the first digit.
+      const int point     = length + decimal_exponent;
+      const int exponent  = point - 1;
+      const int magnitude = (exponent < 0) ? -exponent : exponent;
+
+      if (is_fixed_shorter(length, decimal_exponent))
+      {
+        if (point >= length)
+        {
+          // ddd000
+          for (int i = 0; i < length; ++i)
+          {
+            *p++ = TChar(digits[i]);
+          }
+
+          for (int i = length; i < point; ++i)
+          {
+            *p++ = TChar('0');
+          }
+        }
+        else if (point > 0)
+        {
+          // dd.dd
+          for (int i = 0; i < point; ++i)
+          {
+            *p++ = TChar(digits[i]);
+          }
+
+          *p++ = TChar('.');
+
+          for (int i = point; i < length; ++i)
+          {
+            *p++ = TChar(digits[i]);
+          }
+        }
+        else
+        {
+          // 0.000ddd
+          *p++ = TChar('0');
+          *p++ = TChar('.');
+
+          for (int i = point; i < 0; ++i)
+          {
+            *p++ = TChar('0');
+          }
+
+          for (int i = 0; i < length; ++i)
+          {
+            *p++ = TChar(digits[i]);
+          }
+        }
+      }
+      else
+      {
+        // d.ddde+xx
+        *p++ = TChar(digits[0]);
+
+        if (length > 1)
+        {
+          *p++ = TChar('.');
+
+          for (int i = 1; i < length; ++i)
+          {
+            *p++ = TChar(digits[i]);
+          }
+        }
+
+        *p++ = TChar('e');
+        *p++ = TChar((exponent < 0) ? '-' : '+');
+
+        if (magnitude >= 100)
+        {
+          *p++ = TChar('0' + (magnitude / 100));
+        }
+
+        *p++ = TChar('0' + ((magnitude / 10) % 10));
+        *p++ = TChar('0' + (magnitude % 10));
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Writes a floating point value in the shortest form that reads back
+    /// as the same value.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    TChar* format_float(TChar* p, T value)
+    {
+      typedef float_traits<T>                   traits;
+      typedef typename float_traits<T>::bits_t bits_t;
+
+      const bits_t SIGN_BIT   = bits_t(1) << ((8 * sizeof(T)) - 1);
+      const bits_t HIDDEN_BIT = bits_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+      bits_t bits = get_bits(value);
+
+      if ((bits & SIGN_BIT) != 0)
+      {
+        *p++ = TChar('-');
+        bits &= ~SIGN_BIT;
+      }
+
+      const int biased = int(bits >> (traits::SIGNIFICAND_BITS - 1));
+
+      if (biased == traits::MAX_EXPONENT_FIELD)
+      {
+        const char* text = ((bits & (HIDDEN_BIT - 1)) != 0) ? "nan" : "inf";
+
+        while (*text != 0)
+        {
+          *p++ = TChar(*text++);
+        }
+      }
+      else if (bits == 0)
+      {
+        *p++ = TChar('0');
+      }
+      else
+      {
+        char digits[32];
+        int  length;
+        int  decimal_exponent;
+
+        if (!grisu::grisu3(from_bits<T>(bits), digits, length, decimal_exponent))
+        {
+          dragon4(from_bits<T>(bits), digits, length, decimal_exponent);
+        }
+
+        if ((decimal_exponent > 0) && (biased > traits::EXPONENT_BIAS) && is_fixed_shorter(length, decimal_exponent))
+        {
+          // An integer of 2^SIGNIFICAND_BITS or more, written in full rather
+          // than as the shortest digits padded with zeros, as for std::to_chars.
+          big_integer<FORMAT_WORDS> integer((bits & (HIDDEN_BIT - 1)) | HIDDEN_BIT);
+          integer.shift_left(biased - traits::EXPONENT_BIAS);
+
+          length           = to_decimal(integer, digits);
+          decimal_exponent = 0;
+        }
+
+        p = format_shortest(p, digits, length, decimal_exponent);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Fixed, scientific and general notation with a precision.
+    /// The digits are exact, rounded half to even, computed with big integers.
+    /// Precisions up to MAX_PRECISION are written to a buffer. Larger ones are
+    /// streamed to a sink, a digit at a time.
+    //*************************************************************************
+    namespace precision
+    {
+      // The largest precision written to a buffer by 'format'.
+      static const int MAX_PRECISION = 40;
+
+      // Enough for the integral digits of the largest double and the precision,
+      // with room for to_decimal to write a whole chunk of nine.
+      static const int MAX_DIGITS = 309 + MAX_PRECISION + 9;
+
+      //***********************************************************************
+      /// f * 2^e * 10^k, rounded half to even to an integer.
+      //***********************************************************************
+      inline void scale_and_round(big_integer<FORMAT_WORDS>& n, uint64_t f, int e, int k)
+      {
+        static const uint32_t POWERS[] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL };
+
+        // Twice the value, so that the last bit is the half.
+        n = big_integer<FORMAT_WORDS>(f);
+        n.shift_left(1);
+
+        if (e > 0)
+        {
+          n.shift_left(e);
+        }
+
+        if (k > 0)
+        {
+          n.multiply_power_of_ten(k);
+        }
+
+        bool sticky = false;
+
+        if (e < 0)
+        {
+          sticky = n.shift_right(-e);
+        }
+
+        for (int i = -k; i > 0; i -= 9)
+        {
+          sticky = (n.divide(POWERS[(i > 9) ? 9 : i]) != 0) || sticky;
+        }
+
+        const bool half = n.is_odd();
+        n.shift_right(1);
+
+        if (half && (sticky || n.is_odd()))
+        {
+          n.add(big_integer<FORMAT_WORDS>(1));
+        }
+      }
+
+      //***********************************************************************
+      /// The digits of f * 2^e, rounded to 'precision' places after the point.
+      /// At least precision + 1 digits are written.
+      ///\return The number of digits.
+      //***********************************************************************
+      inline int fixed_digits(uint64_t f, int e, int precision, char* digits)
+      {
+        big_integer<FORMAT_WORDS> n;
+        scale_and_round(n, f, e, precision);
+
+        int length = to_decimal(n, digits);
+
+        if (length <= precision)
+        {
+          const int padding = precision + 1 - length;
+
+          memmove(digits + padding, digits, size_t(length));
+          memset(digits, '0', size_t(padding));
+          length += padding;
+        }
+
+        return length;
+      }
+
+      //***********************************************************************
+      /// The precision + 1 significant digits of f * 2^e, and the decimal
+      /// exponent of the first.
+      //***********************************************************************
+      inline void scientific_digits(uint64_t f, int e, int precision, char* digits, int& exponent)
+      {
+        if (f == 0)
+        {
+          memset(digits, '0', size_t(precision + 1));
+          exponent = 0;
+          return;
+        }
+
+        // The value is in [2^x, 2^(x + 1)). Estimate floor(log10(value)).
+        const int x = e + (64 - etl::count_leading_zeros(f)) - 1;
+        exponent = (x >= 0) ? ((x * 78913) / (1 << 18)) : -((((-x) * 78913) + (1 << 18) - 1) / (1 << 18));
+
+        while (true)
+        {
+          big_integer<FORMAT_WORDS> n;
+          scale_and_round(n, f, e, precision - exponent);
+
+          const int length = to_decimal(n, digits);
+
+          if (length > (precision + 1))
+          {
+            ++exponent;
+          }
+          else if (length < (precision + 1))
+          {
+            --exponent;
+          }
+          else
+          {
+            return;
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Writes ddd.ddd, with 'integral' digits before the point.
+      //***********************************************************************
+      inline char* write_fixed(char* p, const char* digits, int length, int integral, bool point)
+      {
+        memcpy(p, digits, size_t(integral));
+        p += integral;
+
+        if (point || (length > integral))
+        {
+          *p++ = '.';
+        }
+
+        memcpy(p, digits + integral, size_t(length - integral));
+
+        return p + (length - integral);
+      }
+
+      //***********************************************************************
+      /// Writes e+xx.
+      //***********************************************************************
+      inline char* write_exponent(char* p, int exponent, bool upper)
+      {
+        *p++ = upper ? 'E' : 'e';
+        *p++ = (exponent < 0) ? '-' : '+';
+
+        const int magnitude = (exponent < 0) ? -exponent : exponent;
+
+        if (magnitude >= 100)
+        {
+          *p++ = char('0' + (magnitude / 100));
+        }
+
+        *p++ = char('0' + ((magnitude / 10) % 10));
+        *p++ = char('0' + (magnitude % 10));
+
+        return p;
+      }
+
+      //***********************************************************************
+      /// Writes d.ddde+xx.
+      //***********************************************************************
+      inline char* write_scientific(char* p, const char* digits, int length, int exponent, bool point, bool upper)
+      {
+        p = write_fixed(p, digits, length, 1, point);
+
+        return write_exponent(p, exponent, upper);
+      }
+
+      //***********************************************************************
+      /// Removes trailing zeros after the point, and the point if nothing follows.
+      //***********************************************************************
+      inline int strip_trailing_zeros(const char* digits, int length, int integral)
+      {
+        while ((length > integral) && (digits[length - 1] == '0'))
+        {
+          --length;
+        }
+
+        return length;
+      }
+
+      //***********************************************************************
+      /// Writes a finite, positive value as fixed (2), scientific (1) or general (3).
+      /// 'alternate' keeps the point, and trailing zeros for general, as for printf '#'.
+      /// The precision must not be more than MAX_PRECISION. See 'stream'.
+      ///\return The end of the output, which needs at most MAX_DIGITS + 8 characters.
+      //***********************************************************************
+      inline char* format(char* p, double value, int format, int precision, bool alternate, bool upper)
+      {
+        typedef float_traits<double> traits;
+
+        const uint64_t HIDDEN_BIT = uint64_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+        const uint64_t bits     = get_bits(value);
+        const uint64_t fraction = bits & (HIDDEN_BIT - 1);
+        const int      biased   = int(bits >> (traits::SIGNIFICAND_BITS - 1));
+
+        const uint64_t f = (biased == 0) ? fraction : (fraction | HIDDEN_BIT);
+        const int      e = (biased == 0) ? (1 - traits::EXPONENT_BIAS) : (biased - traits::EXPONENT_BIAS);
+
+        char digits[MAX_DIGITS];
+
+        if (format == 2)
+        {
+          const int length = fixed_digits(f, e, precision, digits);
+
+          return write_fixed(p, digits, length, length - precision, alternate);
+        }
+
+        if (format == 1)
+        {
+          int exponent;
+          scientific_digits(f, e, precision, digits, exponent);
+
+          return write_scientific(p, digits, precision + 1, exponent, alternate, upper);
+        }
+
+        // General. 'precision' is the number of significant digits.
+        if (precision == 0)
+        {
+          precision = 1;
+        }
+
+        int exponent;
+        scientific_digits(f, e, precision - 1, digits, exponent);
+
+        if ((exponent < precision) && (exponent >= -4))
+        {
+          const int length = fixed_digits(f, e, precision - 1 - exponent, digits);
+          const int integral = length - (precision - 1 - exponent);
+
+          return write_fixed(p, digits, alternate ? length : strip_trailing_zeros(digits, length, integral), integral, alternate);
+        }
+        else
+        {
+          const int length = alternate ? precision : strip_trailing_zeros(digits, precision, 1);
+
+          return write_scientific(p, digits, length, exponent, alternate, upper);
+        }
+      }
+
+      //***********************************************************************
+      /// The exact decimal digits of f * 2^e, from the first significant
+      /// digit, followed by endless zeros. The value is 0.ddd... * 10^point.
+      /// Integral digits are held as text. Fraction digits are generated from
+      /// the remainder, which is multiplied by ten for each one.
+      //***********************************************************************
+      class exact_digits
+      {
+      public:
+
+        exact_digits(uint64_t f, int e)
+          : length(0)
+          , zeros_from(0)
+          , position(0)
+          , shift(0)
+          , point(0)
+        {
+          if ((e >= 0) || (f == 0))
+          {
+            big_integer<FORMAT_WORDS> integral(f);
+            integral.shift_left(e > 0 ? e : 0);
+
+            length = to_decimal(integral, digits);
+            point  = (f == 0) ? 1 : length;
+          }
+          else
+          {
+            shift = -e;
+
+            const uint64_t integral = (shift < 64) ? (f >> shift) : 0;
+
+            initial = big_integer<FORMAT_WORDS>(f - ((shift < 64) ? (integral << shift) : 0));
+
+            if (integral != 0)
+            {
+              big_integer<FORMAT_WORDS> value(integral);
+
+              length = to_decimal(value, digits);
+              point  = length;
+            }
+            else
+            {
+              // Skip the zeros after the point.
+              remainder = initial;
+
+              uint32_t digit;
+
+              while ((digit = next_fraction_digit()) == 0)
+              {
+                --point;
+              }
+
+              digits[0] = char('0' + digit);
+              length    = 1;
+              initial   = remainder;
+            }
+          }
+
+          zeros_from = length;
+
+          while ((zeros_from != 0) && (digits[zeros_from - 1] == '0'))
+          {
+            --zeros_from;
+          }
+
+          reset();
+        }
+
+        //*********************************************************************
+        /// Restarts from the first significant digit.
+        //*********************************************************************
+        void reset()
+        {
+          position  = 0;
+          remainder = initial;
+        }
+
+        //*********************************************************************
+        /// The next digit.
+        //*********************************************************************
+        int next()
+        {
+          if (position < length)
+          {
+            return digits[position++] - '0';
+          }
+
+          return remainder.is_zero() ? 0 : int(next_fraction_digit());
+        }
+
+        //*********************************************************************
+        /// Are all of the remaining digits zero?
+        //*********************************************************************
+        bool rest_is_zero() const
+        {
+          return (position >= zeros_from) && remainder.is_zero();
+        }
+
+        //*********************************************************************
+        /// The position of the point relative to the first digit.
+        //*********************************************************************
+        int get_point() const
+        {
+          return point;
+        }
+
+      private:
+
+        uint32_t next_fraction_digit()
+        {
+          remainder.multiply(10);
+
+          return remainder.split(shift);
+        }
+
+        char digits[MAX_DIGITS];
+        int  length;
+        int  zeros_from;
+        int  position;
+        int  shift;
+        int  point;
+
+        big_integer<FORMAT_WORDS> initial;
+        big_integer<FORMAT_WORDS> remainder;
+      };
+
+      //***********************************************************************
+      /// The first 'count' exact digits, rounded half to even.
+      /// A first pass finds where a round up carries to. The digits are then
+      /// generated again as they are written.
+      //***********************************************************************
+      class rounded_digits
+      {
+      public:
+
+        rounded_digits(exact_digits& digits_, int count_)
+          : digits(digits_)
+          , count(count_)
+          , last_not_nine(-1)
+          , last_not_zero(-1)
+          , round_up(false)
+          , carry(false)
+          , index(0)
+        {
+          digits.reset();
+
+          int last = 0;
+          int i    = 0;
+
+          while ((i < count) && !digits.rest_is_zero())
+          {
+            last = digits.next();
+
+            if (last != 9)
+            {
+              last_not_nine = i;
+            }
+
+            if (last != 0)
+            {
+              last_not_zero = i;
+            }
+
+            ++i;
+          }
+
+          if (i < count)
+          {
+            // The remaining digits are all zero.
+            last_not_nine = count - 1;
+          }
+          else if (count >= 0)
+          {
+            const int next = digits.next();
+
+            round_up = (next > 5) || ((next == 5) && (!digits.rest_is_zero() || ((last & 1) != 0)));
+          }
+
+          if (round_up)
+          {
+            carry         = (last_not_nine < 0);
+            last_not_zero = carry ? 0 : last_not_nine;
+          }
+
+          digits.reset();
+        }
+
+        //*********************************************************************
+        /// The number of digits, which is one more than asked for if a round
+        /// up carried past the first digit.
+        //*********************************************************************
+        int size() const
+        {
+          return carry ? count + 1 : ((count > 0) ? count : 0);
+        }
+
+        //*********************************************************************
+        /// Did a round up carry past the first digit?
+        //*********************************************************************
+        bool carried() const
+        {
+          return carry;
+        }
+
+        //*********************************************************************
+        /// The index of the last non-zero digit, or -1 if they are all zero.
+        //*********************************************************************
+        int last_non_zero() const
+        {
+          return last_not_zero;
+        }
+
+        //*********************************************************************
+        /// The next digit.
+        //*********************************************************************
+        char next()
+        {
+          int digit;
+
+          if (carry)
+          {
+            digit = (index == 0) ? 1 : 0;
+          }
+          else
+          {
+            digit = digits.next();
+
+            if (round_up && (index >= last_not_nine))
+            {
+              digit = (index == last_not_nine) ? digit + 1 : 0;
+            }
+          }
+
+          ++index;
+
+          return char('0' + digit);
+        }
+
+      private:
+
+        exact_digits& digits;
+        int           count;
+        int           last_not_nine;
+        int           last_not_zero;
+        bool          round_up;
+        bool          carry;
+        int           index;
+      };
+
+      //***********************************************************************
+      /// Streams d.ddd with 'precision' digits after the point.
+      //***********************************************************************
+      template <typename TSink>
+      void stream_fixed(TSink& sink, exact_digits& digits, int precision, bool point, bool strip)
+      {
+        rounded_digits rounded(digits, digits.get_point() + precision);
+
+        const int size     = rounded.size();
+        const int total    = (size > precision) ? size : precision + 1;
+        const int zeros    = total - size;
+        const int integral = total - precision;
+
+        int last = total - 1;
+
+        if (strip)
+        {
+          last = (rounded.last_non_zero() >= 0) ? zeros + rounded.last_non_zero() : -1;
+
+          if (last < (integral - 1))
+          {
+            last = integral - 1;
+          }
+        }
+
+        for (int i = 0; i <= last; ++i)
+        {
+          if (i == integral)
+          {
+            sink('.');
+          }
+
+          sink((i < zeros) ? '0' : rounded.next());
+        }
+
+        if (point && (last < integral))
+        {
+          sink('.');
+        }
+      }
+
+      //***********************************************************************
+      /// Streams d.ddde+xx with 'precision' digits after the point.
+      //***********************************************************************
+      template <typename TSink>
+      void stream_scientific(TSink& sink, exact_digits& digits, int precision, bool point, bool strip, bool upper)
+      {
+        rounded_digits rounded(digits, precision + 1);
+
+        const int exponent = digits.get_point() - 1 + (rounded.carried() ? 1 : 0);
+
+        int last = precision;
+
+        if (strip)
+        {
+          last = (rounded.last_non_zero() > 0) ? rounded.last_non_zero() : 0;
+        }
+
+        sink(rounded.next());
+
+        if (point || (last > 0))
+        {
+          sink('.');
+        }
+
+        for (int i = 1; i <= last; ++i)
+        {
+          sink(rounded.next());
+        }
+
+        char  suffix[8];
+        char* p_end = write_exponent(suffix, exponent, upper);
+
+        for (const char* p = suffix; p != p_end; ++p)
+        {
+          sink(*p);
+        }
+      }
+
+      //***********************************************************************
+      /// Streams a finite, positive value, for any precision.
+      /// The digits are generated one at a time, so no buffer is needed.
+      //***********************************************************************
+      template <typename TSink>
+      void stream(TSink& sink, double value, int format, int precision, bool alternate, bool upper)
+      {
+        typedef float_traits<double> traits;
+
+        const uint64_t HIDDEN_BIT = uint64_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+        const uint64_t bits     = get_bits(value);
+        const uint64_t fraction = bits & (HIDDEN_BIT - 1);
+        const int      biased   = int(bits >> (traits::SIGNIFICAND_BITS - 1));
+
+        const uint64_t f = (biased == 0) ? fraction : (fraction | HIDDEN_BIT);
+        const int      e = (biased == 0) ? (1 - traits::EXPONENT_BIAS) : (biased - traits::EXPONENT_BIAS);
+
+        exact_digits digits(f, e);
+
+        if (format == 2)
+        {
+          stream_fixed(sink, digits, precision, alternate, false);
+        }
+        else if (format == 1)
+        {
+          stream_scientific(sink, digits, precision, alternate, false, upper);
+        }
+        else
+        {
+          // General. 'precision' is the number of significant digits.
+          if (precision == 0)
+          {
+            precision = 1;
+          }
+
+          int exponent;
+          {
+            rounded_digits rounded(digits, precision);
+            exponent = digits.get_point() - 1 + (rounded.carried() ? 1 : 0);
+          }
+
+          if ((exponent < precision) && (exponent >= -4))
+          {
+            stream_fixed(sink, digits, precision - 1 - exponent, alternate, !alternate);
+          }
+          else
+          {
+            stream_scientific(sink, digits, precision - 1, alternate, !alternate, upper);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a floating point value as fixed (2), scientific (1) or general (3)
+    /// with a precision. A negative precision is 6, as for printf.
+    /// The precision must not be more than precision::MAX_PRECISION.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename T>
+    char* format_float_precision(char* p, T value, int format, int precision, bool alternate, bool upper)
+    {
+      typedef float_traits<double> traits;
+
+      const uint64_t SIGN_BIT   = uint64_t(1) << 63;
+      const uint64_t HIDDEN_BIT = uint64_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+      // float to double is exact.
+      uint64_t bits = get_bits(double(value));
+
+      if ((bits & SIGN_BIT) != 0)
+      {
+        *p++ = '-';
+        bits &= ~SIGN_BIT;
+      }
+
+      if (int(bits >> (traits::SIGNIFICAND_BITS - 1)) == traits::MAX_EXPONENT_FIELD)
+      {
+        const char* text = ((bits & (HIDDEN_BIT - 1)) != 0) ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf");
+
+        while (*text != 0)
+        {
+          *p++ = *text++;
+        }
+
+        return p;
+      }
+
+      return precision::format(p, from_bits<double>(bits), format, (precision < 0) ? 6 : precision, alternate, upper);
+    }
+
+    //*************************************************************************
+    /// Writes a floating point value as fixed (2), scientific (1) or general (3)
+    /// with any precision, a character at a time, to a sink that is called
+    /// with each char. A negative precision is 6, as for printf.
+    /// Precisions up to precision::MAX_PRECISION go through a buffer.
+    //*************************************************************************
+    template <typename TSink, typename T>
+    void format_float_precision_to(TSink& sink, T value, int format, int precision, bool alternate, bool upper)
+    {
+      if (precision <= precision::MAX_PRECISION)
+      {
+        char  buffer[precision::MAX_DIGITS + 8];
+        char* p_end = format_float_precision(buffer, value, format, precision, alternate, upper);
+
+        for (const char* p = buffer; p != p_end; ++p)
+        {
+          sink(*p);
+        }
+
+        return;
+      }
+
+      typedef float_traits<double> traits;
+
+      const uint64_t SIGN_BIT = uint64_t(1) << 63;
+
+      // float to double is exact.
+      uint64_t bits = get_bits(double(value));
+
+      if ((bits & SIGN_BIT) != 0)
+      {
+        sink('-');
+        bits &= ~SIGN_BIT;
+      }
+
+      if (int(bits >> (traits::SIGNIFICAND_BITS - 1)) == traits::MAX_EXPONENT_FIELD)
+      {
+        char  buffer[4];
+        char* p_end = format_float_precision(buffer, from_bits<double>(bits), format, 0, false, upper);
+
+        for (const char* p = buffer; p != p_end; ++p)
+        {
+          sink(*p);
+        }
+
+        return;
+      }
+
+      precision::stream(sink, from_bits<double>(bits), format, precision, alternate, upper);
+    }
+
+    //*************************************************************************
+    /// Loads up to MAX_DIGITS significant digits of a mantissa, skipping any
+    /// leading zeros and the decimal point.
+    ///\return <b>true</b> if any of the remaining digits are non-zero.
+    //*************************************************************************
+    template <typename TChar>
+    bool load_digits(big_integer<PARSE_WORDS>& value, int& count, const TChar* first, const TChar* last)
+    {
+      static const uint32_t POWERS[] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL };
+
+      const int MAX_DIGITS = 800;
+
+      uint32_t chunk        = 0;
+      int      chunk_length = 0;
+      bool     sticky       = false;
+
+      count = 0;
+
+      for (; first != last; ++first)
+      {
+        if (*first == TChar('.'))
+        {
+          continue;
+        }
+
+        const uint32_t digit = uint32_t(*first - TChar('0'));
+
+        if ((count == 0) && (digit == 0))
+        {
+          continue;
+        }
+
+        if (count < MAX_DIGITS)
+        {
+          chunk = (chunk * 10) + digit;
+          ++count;
+
+          // Nine digits at a time.
+          if (++chunk_length == 9)
+          {
+            value.multiply_add(POWERS[9], chunk);
+            chunk        = 0;
+            chunk_length = 0;
+          }
+        }
+        else
+        {
+          sticky = sticky || (digit != 0);
+        }
+      }
+
+      if (chunk_length != 0)
+      {
+        value.multiply_add(POWERS[chunk_length], chunk);
+      }
+
+      return sticky;
+    }
+
+    //*************************************************************************
+    /// Compares digits * 10^exponent with the point halfway between
+    /// candidate * 2^binary_exponent and the next value up.
+    //*************************************************************************
+    inline int compare_with_halfway(big_integer<PARSE_WORDS>& value, int exponent, uint64_t candidate, int binary_exponent)
+    {
+      big_integer<PARSE_WORDS> halfway((2 * candidate) + 1);
+
+      // value = digits * 5^exponent * 2^exponent
+      // halfway = (2 * candidate + 1) * 2^(binary_exponent - 1)
+      if (exponent >= 0)
+      {
+        value.multiply_power_of_five(exponent);
+      }
+      else
+      {
+        halfway.multiply_power_of_five(-exponent);
+      }
+
+      const int value_shift   = exponent;
+      const int halfway_shift = binary_exponent - 1;
+
+      if (value_shift > halfway_shift)
+      {
+        value.shift_left(value_shift - halfway_shift);
+      }
+      else
+      {
+        halfway.shift_left(halfway_shift - value_shift);
+      }
+
+      return big_integer<PARSE_WORDS>::compare(value, halfway);
+    }
+
+    //*************************************************************************
+    /// Converts significand * 10^exponent to the nearest T.
+    /// The significand must be non-zero and the decimal magnitude within the
+    /// limits of the type. 'inexact' is set if non-zero digits were dropped,
+    /// in which case all of the digits are read again from the mantissa.
+    ///\return <b>false</b> if the value overflows or rounds to zero.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    bool decimal_to_binary(uint64_t significand, int exponent, bool inexact, const TChar* p_mantissa, const TChar* p_mantissa_end, T& value)
+    {
+      typedef float_traits<T>                   traits;
+      typedef typename float_traits<T>::bits_t bits_t;
+
+      // Clinger's fast path.
+      if (!inexact &&
+          (significand <= (uint64_t(1) << traits::SIGNIFICAND_BITS)) &&
+          (exponent >= -traits::MAX_EXACT_POWER) &&
+          (exponent <= traits::MAX_EXACT_POWER))
+      {
+        const T power = T(EXACT_POWERS_OF_TEN[(exponent < 0) ? -exponent : exponent]);
+
+        value = (exponent < 0) ? (T(significand) / power) : (T(significand) * power);
+
+        return true;
+      }
+
+      // Multiply by the nearest cached power of ten, then by the exact remainder.
+      const int offset    = exponent - cached_powers::MIN_DECIMAL_EXPONENT;
+      const int index     = offset / cached_powers::DECIMAL_EXPONENT_STEP;
+      const int remainder = offset % cached_powers::DECIMAL_EXPONENT_STEP;
+
+      diy_fp x = diy_fp::normalize(diy_fp(significand, 0));
+
+      x = diy_fp::normalize(diy_fp::mul(x, cached_power(index)));
+
+      if (remainder > 0)
+      {
+        uint64_t power = 1;
+
+        for (int i = 0; i < remainder; ++i)
+        {
+          power *= 10;
+        }
+
+        x = diy_fp::normalize(diy_fp::mul(x, diy_fp::normalize(diy_fp(power, 0))));
+      }
+
+      // x is within this many units of the exact value.
+      // The dropped digits add up to 19 more.
+      const uint64_t MAX_ERROR = inexact ? 32 : 8;
+
+      const int MIN_BINARY_EXPONENT = 1 - traits::EXPONENT_BIAS;
+
+      // The exponent of the least significant bit of the result.
+      int binary_exponent = x.e + 64 - traits::SIGNIFICAND_BITS;
+
+      if (binary_exponent < MIN_BINARY_EXPONENT)
+      {
+        binary_exponent = MIN_BINARY_EXPONENT;
+      }
+
+      const int shift = binary_exponent - x.e;
+
+      if (shift > 64)
+      {
+        // Less than half of the smallest value.
+        return false;
+      }
+
+      uint64_t candidate;
+      uint64_t rest;
+      uint64_t half;
+
+      if (shift == 64)
+      {
+        candidate = 0;
+        rest      = x.f;
+        half      = uint64_t(1) << 63;
+      }
+      else
+      {
+        candidate = x.f >> shift;
+        rest      = x.f & ((uint64_t(1) << shift) - 1);
+        half      = uint64_t(1) << (shift - 1);
+      }
+
+      const uint64_t distance = (rest > half) ? (rest - half) : (half - rest);
+
+      bool round_up;
+
+      if (distance > MAX_ERROR)
+      {
+        round_up = (rest > half);
+      }
+      else
+      {
+        big_integer<PARSE_WORDS> digits(significand);
+        int         digits_exponent = exponent;
+        bool        sticky          = false;
+
+        if (inexact)
+        {
+          int count;
+
+          digits          = big_integer<PARSE_WORDS>();
+          sticky          = load_digits(digits, count, p_mantissa, p_mantissa_end);
+          digits_exponent = exponent + MAX_SIGNIFICAND_DIGITS - count;
+        }
+
+        const int comparison = compare_with_halfway(digits, digits_exponent, candidate, binary_exponent);
+
+        round_up = (comparison > 0) || ((comparison == 0) && (sticky || ((candidate & 1) != 0)));
+      }
+
+      if (round_up)
+      {
+        ++candidate;
+
+        if (candidate == (uint64_t(1) << traits::SIGNIFICAND_BITS))
+        {
+          candidate >>= 1;
+          ++binary_exponent;
+        }
+      }
+
+      if (candidate == 0)
+      {
+        return false;
+      }
+
+      const uint64_t HIDDEN_BIT = uint64_t(1) << (traits::SIGNIFICAND_BITS - 1);
+
+      if (candidate < HIDDEN_BIT)
+      {
+        // Subnormal.
+        value = from_bits<T>(bits_t(candidate));
+      }
+      else
+      {
+        const int biased = binary_exponent + traits::EXPONENT_BIAS;
+
+        if (biased >= traits::MAX_EXPONENT_FIELD)
+        {
+          return false;
+        }
+
+        value = from_bits<T>(bits_t((bits_t(biased) << (traits::SIGNIFICAND_BITS - 1)) | bits_t(candidate - HIDDEN_BIT)));
+      }
+
+      return true;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,194 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_FLAT_MERGE__
+#define __ETL_FLAT_MERGE__
+
+#include <stddef.h>
+#include <algorithm>
+
+//*****************************************************************************
+// Bulk insertion support for the flat containers.
+//
+// The lookup of a flat container is a sorted array of pointers with a fixed
+// capacity. A batch of new elements is staged at the top of the unused part
+// of the lookup, where 'n' is the stage size.
+//
+// [ lookup (size) | free (>= n) | stage (n) ]
+//
+// The staged pointers are stable sorted, using the free area immediately
+// below the stage as a buffer, and are then merged with the lookup in a
+// single backward pass. As the stage starts at or beyond 'size + count', the
+// merge never overwrites a staged pointer that has not yet been read.
+// The exception is a single value staged in the last free slot, which is
+// read before it can be overwritten.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_flat__
+  {
+    //*************************************************************************
+    /// The number of elements that can be staged in the unused part of a lookup.
+    //*************************************************************************
+    inline size_t stage_size(size_t size, size_t capacity)
+    {
+      size_t free = capacity - size;
+
+      return (free == 1) ? 1 : free / 2;
+    }
+
+    //*************************************************************************
+    /// Returns the start of the stage.
+    //*************************************************************************
+    template <typename TPointer>
+    TPointer* stage_begin(TPointer* p_lookup, size_t size, size_t capacity)
+    {
+      return p_lookup + capacity - stage_size(size, capacity);
+    }
+
+    //*************************************************************************
+    /// Compares the keys of two pairs, which may be of different types.
+    /// Used to check that a range passed to a map's insert_sorted is sorted.
+    //*************************************************************************
+    template <typename TKeyCompare>
+    struct key_first_compare
+    {
+      template <typename T1, typename T2>
+      bool operator ()(const T1& lhs, const T2& rhs) const
+      {
+        return TKeyCompare()(lhs.first, rhs.first);
+      }
+    };
+
+    //*************************************************************************
+    /// Stable sorts the staged pointers, using the buffer immediately below them.
+    /// Bottom up merge sort, ping-ponging between the stage and the buffer.
+    //*************************************************************************
+    template <typename TPointer, typename TCompare>
+    void sort_stage(TPointer* p_stage, size_t count, TCompare compare)
+    {
+      if (count < 2)
+      {
+        return;
+      }
+
+      TPointer* p_source      = p_stage;
+      TPointer* p_destination = p_stage - count;
+
+      for (size_t width = 1; width < count; width *= 2)
+      {
+        for (size_t i = 0; i < count; i += (2 * width))
+        {
+          size_t middle = std::min(i + width, count);
+          size_t end    = std::min(i + (2 * width), count);
+
+          std::merge(p_source + i, p_source + middle, p_source + middle, p_source + end, p_destination + i, compare);
+        }
+
+        std::swap(p_source, p_destination);
+      }
+
+      if (p_source != p_stage)
+      {
+        std::copy(p_source, p_source + count, p_stage);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves sorted staged pointers that are duplicates, either of each other
+    /// or of an existing entry in the lookup, to the end of the stage.
+    /// The first of a run of equivalent staged pointers is the one retained.
+    ///\return The number of unique staged pointers.
+    //*************************************************************************
+    template <typename TPointer, typename TCompare>
+    size_t unique_stage(TPointer* p_lookup, size_t size, TPointer* p_stage, size_t count, TCompare compare)
+    {
+      size_t i = 0;
+      size_t unique_count = 0;
+
+      for (size_t j = 0; j < count; ++j)
+      {
+        while ((i < size) && compare(p_lookup[i], p_stage[j]))
+        {
+          ++i;
+        }
+
+        bool exists = ((i < size) && !compare(p_stage[j], p_lookup[i])) ||
+                      ((unique_count > 0) && !compare(p_stage[unique_count - 1], p_stage[j]));
+
+        if (!exists)
+        {
+          std::swap(p_stage[unique_count++], p_stage[j]);
+        }
+      }
+
+      return unique_count;
+    }
+
+    //*************************************************************************
+    /// Merges the sorted staged pointers into the lookup, in one backward pass.
+    /// Staged pointers are placed after existing equivalent entries.
+    /// The lookup must already have been resized to 'size + count'.
+    //*************************************************************************
+    template <typename TPointer, typename TCompare>
+    void merge_stage(TPointer* p_lookup, size_t size, TPointer* p_stage, size_t count, TCompare compare)
+    {
+      if (count == 0)
+      {
+        return;
+      }
+
+      TPointer* p_out    = p_lookup + size + count;
+      TPointer  p_staged = p_stage[--count];
+
+      while (true)
+      {
+        if ((size > 0) && compare(p_staged, p_lookup[size - 1]))
+        {
+          *--p_out = p_lookup[--size];
+        }
+        else
+        {
+          *--p_out = p_staged;
+
+          if (count == 0)
+          {
+            break;
+          }
+
+          p_staged = p_stage[--count];
+        }
+      }
+    }
+  }
+}
+
+#endif
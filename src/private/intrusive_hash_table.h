@@ -0,0 +1,801 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INTRUSIVE_HASH_TABLE__
+#define __ETL_INTRUSIVE_HASH_TABLE__
+
+#include <stddef.h>
+#include <iterator>
+#include <utility>
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../parameter_type.h"
+#include "../intrusive_links.h"
+#include "../intrusive_forward_list.h"
+
+//*****************************************************************************
+// The hash table shared by the intrusive unordered containers.
+//
+// Each bucket is an etl::intrusive_forward_list threaded through a forward
+// link embedded in the values, so the table never allocates. 'TGetKey'
+// returns the key of a value; for a set it returns the value itself.
+//
+// 'first' is never after the first non-empty bucket, which lets begin() skip
+// the leading empty buckets without being updated on erase.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_intrusive_hash_table__
+  {
+    //*************************************************************************
+    /// Returns a value as its own key.
+    //*************************************************************************
+    template <typename TValue>
+    struct identity_key
+    {
+      const TValue& operator ()(const TValue& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The intrusive hash table.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TGetKey, typename TLink, typename THash, typename TKeyEqual>
+    class intrusive_hash_table
+    {
+    public:
+
+      typedef TKey              key_type;
+      typedef TValue            value_type;
+      typedef TLink             link_type;
+      typedef THash             hasher;
+      typedef TKeyEqual         key_equal;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      typedef etl::intrusive_forward_list<TValue, TLink> bucket_t;
+
+      // Local iterators iterate over one bucket.
+      typedef typename bucket_t::iterator       local_iterator;
+      typedef typename bucket_t::const_iterator local_const_iterator;
+
+      class const_iterator;
+
+      //*********************************************************************
+      /// iterator.
+      //*********************************************************************
+      class iterator : public std::iterator<std::forward_iterator_tag, TValue>
+      {
+      public:
+
+        friend class intrusive_hash_table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          ++inode;
+
+          // The end of this bucket?
+          if (inode == pbucket->end())
+          {
+            // Search for the next non-empty bucket.
+            ++pbucket;
+            while ((pbucket != pbuckets_end) && (pbucket->empty()))
+            {
+              ++pbucket;
+            }
+
+            // If not past the end, get the first value in the bucket.
+            if (pbucket != pbuckets_end)
+            {
+              inode = pbucket->begin();
+            }
+          }
+
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        reference operator *()
+        {
+          return *inode;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return *inode;
+        }
+
+        //*********************************
+        pointer operator ->()
+        {
+          return &*inode;
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return &*inode;
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.inode == rhs.inode;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
+          : pbuckets_end(pbuckets_end_),
+            pbucket(pbucket_),
+            inode(inode_)
+        {
+        }
+
+        bucket_t*      pbuckets_end;
+        bucket_t*      pbucket;
+        local_iterator inode;
+      };
+
+      //*********************************************************************
+      /// const_iterator.
+      //*********************************************************************
+      class const_iterator : public std::iterator<std::forward_iterator_tag, const TValue>
+      {
+      public:
+
+        friend class intrusive_hash_table;
+
+        //*********************************
+        const_iterator()
+        {
+        }
+
+        //*********************************
+        const_iterator(const iterator& other)
+          : pbuckets_end(other.pbuckets_end),
+            pbucket(other.pbucket),
+            inode(other.inode)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          ++inode;
+
+          // The end of this bucket?
+          if (inode == pbucket->end())
+          {
+            // Search for the next non-empty bucket.
+            ++pbucket;
+            while ((pbucket != pbuckets_end) && (pbucket->empty()))
+            {
+              ++pbucket;
+            }
+
+            // If not past the end, get the first value in the bucket.
+            if (pbucket != pbuckets_end)
+            {
+              inode = pbucket->begin();
+            }
+          }
+
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return *inode;
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return &*inode;
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.inode == rhs.inode;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const bucket_t* pbuckets_end_, const bucket_t* pbucket_, local_const_iterator inode_)
+          : pbuckets_end(pbuckets_end_),
+            pbucket(pbucket_),
+            inode(inode_)
+        {
+        }
+
+        const bucket_t*      pbuckets_end;
+        const bucket_t*      pbucket;
+        local_const_iterator inode;
+      };
+
+      typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the container.
+      //*********************************************************************
+      iterator begin()
+      {
+        bucket_t* pbucket = first_non_empty();
+
+        return (pbucket == end_bucket()) ? end() : iterator(end_bucket(), pbucket, pbucket->begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the container.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        const bucket_t* pbucket = first_non_empty();
+
+        return (pbucket == end_bucket()) ? end() : const_iterator(end_bucket(), pbucket, pbucket->begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the container.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return begin();
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the container.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(end_bucket(), end_bucket(), local_iterator());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the container.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(end_bucket(), end_bucket(), local_const_iterator());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the container.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return end();
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of bucket 'i'.
+      //*********************************************************************
+      local_iterator begin(size_t i)
+      {
+        return pbuckets[i].begin();
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of bucket 'i'.
+      //*********************************************************************
+      local_const_iterator begin(size_t i) const
+      {
+        return pbuckets[i].cbegin();
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of bucket 'i'.
+      //*********************************************************************
+      local_const_iterator cbegin(size_t i) const
+      {
+        return pbuckets[i].cbegin();
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of bucket 'i'.
+      //*********************************************************************
+      local_iterator end(size_t i)
+      {
+        return pbuckets[i].end();
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of bucket 'i'.
+      //*********************************************************************
+      local_const_iterator end(size_t i) const
+      {
+        return pbuckets[i].cend();
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of bucket 'i'.
+      //*********************************************************************
+      local_const_iterator cend(size_t i) const
+      {
+        return pbuckets[i].cend();
+      }
+
+      //*********************************************************************
+      /// Returns the bucket index for the key.
+      //*********************************************************************
+      size_type bucket(key_parameter_t key) const
+      {
+        return key_hash_function(key) % number_of_buckets;
+      }
+
+      //*********************************************************************
+      /// Returns the number of values in the bucket for the key.
+      //*********************************************************************
+      size_type bucket_size(key_parameter_t key) const
+      {
+        return pbuckets[bucket(key)].size();
+      }
+
+      //*********************************************************************
+      /// Returns the maximum number of buckets.
+      //*********************************************************************
+      size_type max_bucket_count() const
+      {
+        return number_of_buckets;
+      }
+
+      //*********************************************************************
+      /// Returns the number of buckets.
+      //*********************************************************************
+      size_type bucket_count() const
+      {
+        return number_of_buckets;
+      }
+
+      //*********************************************************************
+      /// Links a value into the container, if no value with an equal key is
+      /// already there. The value must not be linked in another container
+      /// through the same link.
+      ///\param value The value to link.
+      ///\return An iterator to the value with the key, and <b>true</b> if
+      /// the value was linked.
+      //*********************************************************************
+      std::pair<iterator, bool> insert(value_type& value)
+      {
+        const key_type& key = key_of(value);
+
+        bucket_t* pbucket = pbuckets + bucket(key);
+
+        local_iterator inode = find_in_bucket(*pbucket, key);
+
+        if (inode != pbucket->end())
+        {
+          return std::pair<iterator, bool>(iterator(end_bucket(), pbucket, inode), false);
+        }
+
+        pbucket->push_front(value);
+        ++current_size;
+
+        if (pbucket < first)
+        {
+          first = pbucket;
+        }
+
+        return std::pair<iterator, bool>(iterator(end_bucket(), pbucket, pbucket->begin()), true);
+      }
+
+      //*********************************************************************
+      /// Links a range of values into the container.
+      ///\param first The first value to link.
+      ///\param last  The last + 1 value to link.
+      //*********************************************************************
+      template <typename TIterator>
+      void insert(TIterator first_, TIterator last_)
+      {
+        while (first_ != last_)
+        {
+          insert(*first_++);
+        }
+      }
+
+      //*********************************************************************
+      /// Unlinks the value with the key.
+      ///\param key The key to erase.
+      ///\return The number of values erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        bucket_t& bucket_ = pbuckets[bucket(key)];
+
+        if (bucket_.empty())
+        {
+          return 0;
+        }
+
+        local_iterator iprevious = bucket_.before_begin();
+        local_iterator icurrent  = bucket_.begin();
+
+        while (icurrent != bucket_.end())
+        {
+          if (key_equal_function(key, key_of(*icurrent)))
+          {
+            bucket_.erase_after(iprevious);
+            --current_size;
+            return 1;
+          }
+
+          ++iprevious;
+          ++icurrent;
+        }
+
+        return 0;
+      }
+
+      //*********************************************************************
+      /// Unlinks a value.
+      ///\param ielement Iterator to the value.
+      ///\return An iterator to the next value.
+      //*********************************************************************
+      iterator erase(const_iterator ielement)
+      {
+        // Make a note of the next one.
+        iterator inext = to_iterator(ielement);
+        ++inext;
+
+        unlink(*const_cast<bucket_t*>(ielement.pbucket), *ielement);
+
+        return inext;
+      }
+
+      //*********************************************************************
+      /// Unlinks a range of values.
+      ///\param first Iterator to the first value.
+      ///\param last  Iterator to the last + 1 value.
+      ///\return An iterator to the value after the last erased.
+      //*********************************************************************
+      iterator erase(const_iterator first_, const_iterator last_)
+      {
+        while (first_ != last_)
+        {
+          first_ = erase(first_);
+        }
+
+        return to_iterator(last_);
+      }
+
+      //*********************************************************************
+      /// Unlinks all of the values.
+      //*********************************************************************
+      void clear()
+      {
+        for (size_t i = 0; i < number_of_buckets; ++i)
+        {
+          pbuckets[i].clear();
+        }
+
+        current_size = 0;
+        first = end_bucket();
+      }
+
+      //*********************************************************************
+      /// Finds a value.
+      ///\param key The key to search for.
+      ///\return An iterator to the value if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        bucket_t* pbucket = pbuckets + bucket(key);
+
+        local_iterator inode = find_in_bucket(*pbucket, key);
+
+        return (inode == pbucket->end()) ? end() : iterator(end_bucket(), pbucket, inode);
+      }
+
+      //*********************************************************************
+      /// Finds a value.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the value if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        const bucket_t* pbucket = pbuckets + bucket(key);
+
+        if (pbucket->empty())
+        {
+          return end();
+        }
+
+        local_const_iterator inode = pbucket->begin();
+
+        while (inode != pbucket->end())
+        {
+          if (key_equal_function(key, key_of(*inode)))
+          {
+            return const_iterator(end_bucket(), pbucket, inode);
+          }
+
+          ++inode;
+        }
+
+        return end();
+      }
+
+      //*********************************************************************
+      /// Counts the values with the key.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find(key) == end()) ? 0 : 1;
+      }
+
+      //*********************************************************************
+      /// Returns the range of values with the key.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of values.
+      //*********************************************************************
+      std::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        iterator first_ = find(key);
+        iterator last_  = first_;
+
+        if (last_ != end())
+        {
+          ++last_;
+        }
+
+        return std::pair<iterator, iterator>(first_, last_);
+      }
+
+      //*********************************************************************
+      /// Returns the range of values with the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator pair to the range of values.
+      //*********************************************************************
+      std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        const_iterator first_ = find(key);
+        const_iterator last_  = first_;
+
+        if (last_ != end())
+        {
+          ++last_;
+        }
+
+        return std::pair<const_iterator, const_iterator>(first_, last_);
+      }
+
+      //*********************************************************************
+      /// Gets the number of values in the container.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the container is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0;
+      }
+
+      //*********************************************************************
+      /// Returns the load factor = size / bucket_count.
+      //*********************************************************************
+      float load_factor() const
+      {
+        return static_cast<float>(size()) / static_cast<float>(bucket_count());
+      }
+
+      //*********************************************************************
+      /// Returns the function that hashes the keys.
+      //*********************************************************************
+      hasher hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //*********************************************************************
+      /// Returns the function that compares the keys.
+      //*********************************************************************
+      key_equal key_eq() const
+      {
+        return key_equal_function;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      /// The buckets are owned, and constructed, by the derived class.
+      //*********************************************************************
+      intrusive_hash_table(bucket_t* pbuckets_, size_t number_of_buckets_)
+        : pbuckets(pbuckets_),
+          number_of_buckets(number_of_buckets_),
+          first(pbuckets_ + number_of_buckets_),
+          current_size(0)
+      {
+      }
+
+      //*********************************************************************
+      /// Unlinks a value from its bucket.
+      //*********************************************************************
+      void unlink(bucket_t& bucket_, const value_type& value)
+      {
+        local_iterator iprevious = bucket_.before_begin();
+        local_iterator icurrent  = bucket_.begin();
+
+        // Find the value previous to the one we're interested in.
+        while (&*icurrent != &value)
+        {
+          ++iprevious;
+          ++icurrent;
+        }
+
+        bucket_.erase_after(iprevious);
+        --current_size;
+      }
+
+    private:
+
+      //*********************************************************************
+      /// Finds the value with the key in the bucket.
+      //*********************************************************************
+      local_iterator find_in_bucket(bucket_t& bucket_, key_parameter_t key)
+      {
+        if (bucket_.empty())
+        {
+          return bucket_.end();
+        }
+
+        local_iterator inode = bucket_.begin();
+
+        while ((inode != bucket_.end()) && !key_equal_function(key, key_of(*inode)))
+        {
+          ++inode;
+        }
+
+        return inode;
+      }
+
+      //*********************************************************************
+      /// Converts a const_iterator to an iterator.
+      //*********************************************************************
+      iterator to_iterator(const_iterator position)
+      {
+        if (position == cend())
+        {
+          return end();
+        }
+
+        return iterator(end_bucket(), const_cast<bucket_t*>(position.pbucket), local_iterator(const_cast<value_type&>(*position)));
+      }
+
+      //*********************************************************************
+      /// The first non-empty bucket, or the end.
+      //*********************************************************************
+      bucket_t* first_non_empty() const
+      {
+        bucket_t* pbucket = first;
+
+        while ((pbucket != end_bucket()) && pbucket->empty())
+        {
+          ++pbucket;
+        }
+
+        return pbucket;
+      }
+
+      //*********************************************************************
+      /// One past the last bucket.
+      //*********************************************************************
+      bucket_t* end_bucket() const
+      {
+        return pbuckets + number_of_buckets;
+      }
+
+      // Disable copy construction and assignment.
+      intrusive_hash_table(const intrusive_hash_table&);
+      intrusive_hash_table& operator =(const intrusive_hash_table&);
+
+      /// The buckets.
+      bucket_t* pbuckets;
+
+      /// The number of buckets.
+      const size_t number_of_buckets;
+
+      /// Never after the first non-empty bucket.
+      bucket_t* first;
+
+      /// The number of values in the container.
+      size_t current_size;
+
+      /// The function that creates the hashes.
+      hasher key_hash_function;
+
+      /// The function that compares the keys for equality.
+      key_equal key_equal_function;
+
+      /// The function that gets the key of a value.
+      TGetKey key_of;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,1014 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_INTRUSIVE_TREE__
+#define __ETL_INTRUSIVE_TREE__
+
+#include <stddef.h>
+#include <iterator>
+#include <utility>
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../parameter_type.h"
+#include "../intrusive_links.h"
+
+//*****************************************************************************
+// The AVL tree shared by the intrusive ordered containers.
+//
+// The tree is threaded through an etl::tree_link embedded in the values, so
+// it never allocates. 'TGetKey' returns the key of a value; for a set it
+// returns the value itself.
+//
+// 'etl_balance' in each link is the height of the right subtree minus the
+// height of the left, and is kept in the range -1 to +1 by the rotations in
+// rebalance_after_insert and rebalance_after_erase. The etl::link_rotate
+// functions do not update the child pointer of the grandparent, so 'rotate'
+// does that here.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_intrusive_tree__
+  {
+    //*************************************************************************
+    /// Returns a value as its own key.
+    //*************************************************************************
+    template <typename TValue>
+    struct identity_key
+    {
+      const TValue& operator ()(const TValue& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The intrusive AVL tree.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TGetKey, typename TLink, typename TCompare>
+    class intrusive_tree
+    {
+    public:
+
+      typedef TKey              key_type;
+      typedef TValue            value_type;
+      typedef TLink             link_type;
+      typedef TCompare          key_compare;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      class const_iterator;
+
+      //*********************************************************************
+      /// iterator.
+      //*********************************************************************
+      class iterator : public std::iterator<std::bidirectional_iterator_tag, TValue>
+      {
+      public:
+
+        friend class intrusive_tree;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : p_tree(nullptr),
+            p_link(nullptr)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          p_link = intrusive_tree::next_link(p_link);
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          p_link = intrusive_tree::next_link(p_link);
+          return temp;
+        }
+
+        //*********************************
+        iterator& operator --()
+        {
+          p_link = (p_link == nullptr) ? intrusive_tree::maximum_link(p_tree->p_root) : intrusive_tree::previous_link(p_link);
+          return *this;
+        }
+
+        //*********************************
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return *static_cast<value_type*>(p_link);
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return static_cast<value_type*>(p_link);
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.p_link == rhs.p_link;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(const intrusive_tree* p_tree_, link_type* p_link_)
+          : p_tree(p_tree_),
+            p_link(p_link_)
+        {
+        }
+
+        const intrusive_tree* p_tree;
+        link_type*            p_link;
+      };
+
+      //*********************************************************************
+      /// const_iterator.
+      //*********************************************************************
+      class const_iterator : public std::iterator<std::bidirectional_iterator_tag, const TValue>
+      {
+      public:
+
+        friend class intrusive_tree;
+
+        //*********************************
+        const_iterator()
+          : p_tree(nullptr),
+            p_link(nullptr)
+        {
+        }
+
+        //*********************************
+        const_iterator(const iterator& other)
+          : p_tree(other.p_tree),
+            p_link(other.p_link)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          p_link = intrusive_tree::next_link(p_link);
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          p_link = intrusive_tree::next_link(p_link);
+          return temp;
+        }
+
+        //*********************************
+        const_iterator& operator --()
+        {
+          p_link = (p_link == nullptr) ? intrusive_tree::maximum_link(p_tree->p_root) : intrusive_tree::previous_link(p_link);
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return *static_cast<const value_type*>(p_link);
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return static_cast<const value_type*>(p_link);
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.p_link == rhs.p_link;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const intrusive_tree* p_tree_, link_type* p_link_)
+          : p_tree(p_tree_),
+            p_link(p_link_)
+        {
+        }
+
+        const intrusive_tree* p_tree;
+        link_type*            p_link;
+      };
+
+      typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+      typedef std::reverse_iterator<iterator>       reverse_iterator;
+      typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the container.
+      //*********************************************************************
+      iterator begin()
+      {
+        return iterator(this, minimum_link(p_root));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the container.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(this, minimum_link(p_root));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the container.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(this, minimum_link(p_root));
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the container.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(this, nullptr);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the container.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(this, nullptr);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the container.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(this, nullptr);
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the container.
+      //*********************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the container.
+      //*********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the container.
+      //*********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the container.
+      //*********************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the container.
+      //*********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the container.
+      //*********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Links a value into the container, if no value with an equivalent
+      /// key is already there. The value must not be linked in another
+      /// container through the same link.
+      /// O(logN)
+      ///\param value The value to link.
+      ///\return An iterator to the value with the key, and <b>true</b> if
+      /// the value was linked.
+      //*********************************************************************
+      std::pair<iterator, bool> insert(value_type& value)
+      {
+        const key_type& key = key_of(value);
+
+        link_type* p_parent = nullptr;
+        link_type* p_link   = p_root;
+        bool       is_left  = false;
+
+        // Find the leaf position for the key.
+        while (p_link != nullptr)
+        {
+          p_parent = p_link;
+
+          if (compare(key, key_of(p_link)))
+          {
+            p_link  = p_link->etl_left;
+            is_left = true;
+          }
+          else if (compare(key_of(p_link), key))
+          {
+            p_link  = p_link->etl_right;
+            is_left = false;
+          }
+          else
+          {
+            return std::pair<iterator, bool>(iterator(this, p_link), false);
+          }
+        }
+
+        link_type* p_new = &value;
+
+        p_new->etl_parent  = p_parent;
+        p_new->etl_left    = nullptr;
+        p_new->etl_right   = nullptr;
+        p_new->etl_balance = 0;
+
+        if (p_parent == nullptr)
+        {
+          p_root = p_new;
+        }
+        else if (is_left)
+        {
+          p_parent->etl_left = p_new;
+        }
+        else
+        {
+          p_parent->etl_right = p_new;
+        }
+
+        ++current_size;
+
+        rebalance_after_insert(p_new);
+
+        return std::pair<iterator, bool>(iterator(this, p_new), true);
+      }
+
+      //*********************************************************************
+      /// Links a range of values into the container.
+      ///\param first The first value to link.
+      ///\param last  The last + 1 value to link.
+      //*********************************************************************
+      template <typename TIterator>
+      void insert(TIterator first, TIterator last)
+      {
+        while (first != last)
+        {
+          insert(*first++);
+        }
+      }
+
+      //*********************************************************************
+      /// Unlinks the value with the key.
+      /// O(logN)
+      ///\param key The key to erase.
+      ///\return The number of values erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        link_type* p_link = find_link(key);
+
+        if (p_link == nullptr)
+        {
+          return 0;
+        }
+
+        unlink(p_link);
+
+        return 1;
+      }
+
+      //*********************************************************************
+      /// Unlinks a value.
+      /// O(logN)
+      ///\param position Iterator to the value.
+      ///\return An iterator to the next value.
+      //*********************************************************************
+      iterator erase(const_iterator position)
+      {
+        link_type* p_link = position.p_link;
+        link_type* p_next = next_link(p_link);
+
+        unlink(p_link);
+
+        return iterator(this, p_next);
+      }
+
+      //*********************************************************************
+      /// Unlinks a range of values.
+      ///\param first Iterator to the first value.
+      ///\param last  Iterator to the last + 1 value.
+      ///\return An iterator to the value after the last erased.
+      //*********************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        while (first != last)
+        {
+          first = erase(first);
+        }
+
+        return iterator(this, last.p_link);
+      }
+
+      //*********************************************************************
+      /// Unlinks all of the values.
+      //*********************************************************************
+      void clear()
+      {
+        p_root       = nullptr;
+        current_size = 0;
+      }
+
+      //*********************************************************************
+      /// Finds a value.
+      ///\param key The key to search for.
+      ///\return An iterator to the value if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return iterator(this, find_link(key));
+      }
+
+      //*********************************************************************
+      /// Finds a value.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the value if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return const_iterator(this, find_link(key));
+      }
+
+      //*********************************************************************
+      /// Counts the values with the key.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find_link(key) == nullptr) ? 0 : 1;
+      }
+
+      //*********************************************************************
+      /// Finds the first value with a key not less than the key.
+      //*********************************************************************
+      iterator lower_bound(key_parameter_t key)
+      {
+        return iterator(this, lower_bound_link(key));
+      }
+
+      //*********************************************************************
+      /// Finds the first value with a key not less than the key.
+      //*********************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        return const_iterator(this, lower_bound_link(key));
+      }
+
+      //*********************************************************************
+      /// Finds the first value with a key greater than the key.
+      //*********************************************************************
+      iterator upper_bound(key_parameter_t key)
+      {
+        return iterator(this, upper_bound_link(key));
+      }
+
+      //*********************************************************************
+      /// Finds the first value with a key greater than the key.
+      //*********************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        return const_iterator(this, upper_bound_link(key));
+      }
+
+      //*********************************************************************
+      /// Returns the range of values with the key.
+      //*********************************************************************
+      std::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+      }
+
+      //*********************************************************************
+      /// Returns the range of values with the key.
+      //*********************************************************************
+      std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        return std::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+
+      //*********************************************************************
+      /// Gets the number of values in the container.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the container is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0;
+      }
+
+      //*********************************************************************
+      /// Returns the function that compares the keys.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      intrusive_tree()
+        : p_root(nullptr),
+          current_size(0)
+      {
+      }
+
+    private:
+
+      //*********************************************************************
+      /// The key of a linked value.
+      //*********************************************************************
+      const key_type& key_of(const link_type* p_link) const
+      {
+        return key_of(*static_cast<const value_type*>(p_link));
+      }
+
+      //*********************************************************************
+      /// The key of a value.
+      //*********************************************************************
+      const key_type& key_of(const value_type& value) const
+      {
+        return get_key(value);
+      }
+
+      //*********************************************************************
+      /// Finds the link with the key, or nullptr.
+      //*********************************************************************
+      link_type* find_link(key_parameter_t key) const
+      {
+        link_type* p_link = p_root;
+
+        while (p_link != nullptr)
+        {
+          if (compare(key, key_of(p_link)))
+          {
+            p_link = p_link->etl_left;
+          }
+          else if (compare(key_of(p_link), key))
+          {
+            p_link = p_link->etl_right;
+          }
+          else
+          {
+            break;
+          }
+        }
+
+        return p_link;
+      }
+
+      //*********************************************************************
+      /// Finds the first link with a key not less than the key, or nullptr.
+      //*********************************************************************
+      link_type* lower_bound_link(key_parameter_t key) const
+      {
+        link_type* p_result = nullptr;
+        link_type* p_link   = p_root;
+
+        while (p_link != nullptr)
+        {
+          if (compare(key_of(p_link), key))
+          {
+            p_link = p_link->etl_right;
+          }
+          else
+          {
+            p_result = p_link;
+            p_link   = p_link->etl_left;
+          }
+        }
+
+        return p_result;
+      }
+
+      //*********************************************************************
+      /// Finds the first link with a key greater than the key, or nullptr.
+      //*********************************************************************
+      link_type* upper_bound_link(key_parameter_t key) const
+      {
+        link_type* p_result = nullptr;
+        link_type* p_link   = p_root;
+
+        while (p_link != nullptr)
+        {
+          if (compare(key, key_of(p_link)))
+          {
+            p_result = p_link;
+            p_link   = p_link->etl_left;
+          }
+          else
+          {
+            p_link = p_link->etl_right;
+          }
+        }
+
+        return p_result;
+      }
+
+      //*********************************************************************
+      /// The leftmost link in the subtree, or nullptr if empty.
+      //*********************************************************************
+      static link_type* minimum_link(link_type* p_link)
+      {
+        if (p_link != nullptr)
+        {
+          while (p_link->etl_left != nullptr)
+          {
+            p_link = p_link->etl_left;
+          }
+        }
+
+        return p_link;
+      }
+
+      //*********************************************************************
+      /// The rightmost link in the subtree, or nullptr if empty.
+      //*********************************************************************
+      static link_type* maximum_link(link_type* p_link)
+      {
+        if (p_link != nullptr)
+        {
+          while (p_link->etl_right != nullptr)
+          {
+            p_link = p_link->etl_right;
+          }
+        }
+
+        return p_link;
+      }
+
+      //*********************************************************************
+      /// The in-order successor, or nullptr.
+      //*********************************************************************
+      static link_type* next_link(link_type* p_link)
+      {
+        if (p_link->etl_right != nullptr)
+        {
+          return minimum_link(p_link->etl_right);
+        }
+
+        while ((p_link->etl_parent != nullptr) && (p_link == p_link->etl_parent->etl_right))
+        {
+          p_link = p_link->etl_parent;
+        }
+
+        return p_link->etl_parent;
+      }
+
+      //*********************************************************************
+      /// The in-order predecessor, or nullptr.
+      //*********************************************************************
+      static link_type* previous_link(link_type* p_link)
+      {
+        if (p_link->etl_left != nullptr)
+        {
+          return maximum_link(p_link->etl_left);
+        }
+
+        while ((p_link->etl_parent != nullptr) && (p_link == p_link->etl_parent->etl_left))
+        {
+          p_link = p_link->etl_parent;
+        }
+
+        return p_link->etl_parent;
+      }
+
+      //*********************************************************************
+      /// Replaces a child of the parent, or the root if there is no parent.
+      //*********************************************************************
+      void replace_child(link_type* p_parent, link_type* p_old, link_type* p_new)
+      {
+        if (p_parent == nullptr)
+        {
+          p_root = p_new;
+        }
+        else if (p_parent->etl_left == p_old)
+        {
+          p_parent->etl_left = p_new;
+        }
+        else
+        {
+          p_parent->etl_right = p_new;
+        }
+      }
+
+      //*********************************************************************
+      /// Rotates the child up into the place of the parent.
+      /// Does not change the balance factors.
+      //*********************************************************************
+      void rotate(link_type* p_parent, link_type* p_child)
+      {
+        link_type* p_grandparent = p_parent->etl_parent;
+
+        etl::link_rotate(*p_parent, *p_child);
+        replace_child(p_grandparent, p_parent, p_child);
+      }
+
+      //*********************************************************************
+      /// Rebalances the subtree at 'p_parent', which is two higher on the
+      /// side of its child 'p_child', by one or two rotations.
+      ///\return The new root of the subtree.
+      //*********************************************************************
+      link_type* rebalance(link_type* p_parent, link_type* p_child)
+      {
+        // +1 if the child is on the right, -1 if on the left.
+        const int_least8_t side = (p_parent->etl_right == p_child) ? 1 : -1;
+
+        if (p_child->etl_balance == -side)
+        {
+          // The child is heavy on the inside, so rotate twice.
+          link_type* p_grandchild = (side == 1) ? p_child->etl_left : p_child->etl_right;
+
+          rotate(p_child, p_grandchild);
+          rotate(p_parent, p_grandchild);
+
+          const int_least8_t balance = p_grandchild->etl_balance;
+
+          p_parent->etl_balance     = (balance == side)  ? -side : 0;
+          p_child->etl_balance      = (balance == -side) ?  side : 0;
+          p_grandchild->etl_balance = 0;
+
+          return p_grandchild;
+        }
+        else
+        {
+          rotate(p_parent, p_child);
+
+          if (p_child->etl_balance == 0)
+          {
+            // Only occurs when erasing. The height is unchanged.
+            p_parent->etl_balance = side;
+            p_child->etl_balance  = -side;
+          }
+          else
+          {
+            p_parent->etl_balance = 0;
+            p_child->etl_balance  = 0;
+          }
+
+          return p_child;
+        }
+      }
+
+      //*********************************************************************
+      /// Restores the balance up the tree from a newly linked leaf.
+      //*********************************************************************
+      void rebalance_after_insert(link_type* p_child)
+      {
+        link_type* p_parent = p_child->etl_parent;
+
+        // The subtree at 'p_child' has grown by one.
+        while (p_parent != nullptr)
+        {
+          const int_least8_t side = (p_parent->etl_right == p_child) ? 1 : -1;
+
+          if (p_parent->etl_balance == side)
+          {
+            // Too heavy on this side. The rotation restores the previous height.
+            rebalance(p_parent, p_child);
+            return;
+          }
+          else if (p_parent->etl_balance == -side)
+          {
+            // Now balanced. The height is unchanged.
+            p_parent->etl_balance = 0;
+            return;
+          }
+
+          p_parent->etl_balance = side;
+
+          p_child  = p_parent;
+          p_parent = p_parent->etl_parent;
+        }
+      }
+
+      //*********************************************************************
+      /// Restores the balance up the tree from a parent whose subtree on
+      /// 'side' (+1 right, -1 left) has shrunk by one.
+      //*********************************************************************
+      void rebalance_after_erase(link_type* p_parent, int_least8_t side)
+      {
+        while (p_parent != nullptr)
+        {
+          link_type* p_subtree = p_parent;
+
+          if (p_parent->etl_balance == -side)
+          {
+            // Too heavy on the other side.
+            link_type* p_sibling = (side == 1) ? p_parent->etl_left : p_parent->etl_right;
+
+            const bool height_unchanged = (p_sibling->etl_balance == 0);
+
+            p_subtree = rebalance(p_parent, p_sibling);
+
+            if (height_unchanged)
+            {
+              return;
+            }
+          }
+          else if (p_parent->etl_balance == 0)
+          {
+            // Now heavy on the other side. The height is unchanged.
+            p_parent->etl_balance = -side;
+            return;
+          }
+          else
+          {
+            p_parent->etl_balance = 0;
+          }
+
+          // The subtree at 'p_subtree' has shrunk by one.
+          p_parent = p_subtree->etl_parent;
+
+          if (p_parent != nullptr)
+          {
+            side = (p_parent->etl_right == p_subtree) ? 1 : -1;
+          }
+        }
+      }
+
+      //*********************************************************************
+      /// Unlinks a linked value.
+      //*********************************************************************
+      void unlink(link_type* p_link)
+      {
+        link_type*   p_parent = p_link->etl_parent;
+        link_type*   p_rebalance;
+        int_least8_t side;
+
+        if ((p_link->etl_left != nullptr) && (p_link->etl_right != nullptr))
+        {
+          // Move the successor into the place of the link.
+          link_type* p_successor = minimum_link(p_link->etl_right);
+
+          if (p_successor == p_link->etl_right)
+          {
+            // The right subtree of the successor takes its place.
+            p_rebalance = p_successor;
+            side        = 1;
+          }
+          else
+          {
+            p_rebalance = p_successor->etl_parent;
+            side        = -1;
+
+            etl::link_left(p_rebalance, p_successor->etl_right);
+            etl::link_right(p_successor, p_link->etl_right);
+          }
+
+          etl::link_left(p_successor, p_link->etl_left);
+
+          p_successor->etl_parent  = p_parent;
+          p_successor->etl_balance = p_link->etl_balance;
+          replace_child(p_parent, p_link, p_successor);
+        }
+        else
+        {
+          // The only child, if any, takes the place of the link.
+          link_type* p_child = (p_link->etl_left != nullptr) ? p_link->etl_left : p_link->etl_right;
+
+          p_rebalance = p_parent;
+          side        = ((p_parent != nullptr) && (p_parent->etl_left == p_link)) ? -1 : 1;
+
+          if (p_child != nullptr)
+          {
+            p_child->etl_parent = p_parent;
+          }
+
+          replace_child(p_parent, p_link, p_child);
+        }
+
+        p_link->clear();
+        --current_size;
+
+        rebalance_after_erase(p_rebalance, side);
+      }
+
+      // Disable copy construction and assignment.
+      intrusive_tree(const intrusive_tree&);
+      intrusive_tree& operator =(const intrusive_tree&);
+
+      /// The root of the tree.
+      link_type* p_root;
+
+      /// The number of values in the container.
+      size_t current_size;
+
+      /// The function that compares the keys.
+      key_compare compare;
+
+      /// The function that gets the key of a value.
+      TGetKey get_key;
+    };
+  }
+}
+
+#endif
@@ -42,6 +42,7 @@ SOFTWARE.
 #include "../algorithm.h"
 #include "vector_base.h"
 #include "../type_traits.h"
+#include "../memory.h"
 #include "../error_handler.h"
 
 #ifdef ETL_COMPILER_GCC
@@ -416,8 +417,7 @@ namespace etl
 
       if (position != end())
       {
-        ++p_end;
-        std::copy_backward(position, end() - 1, end());
+        p_end = etl::relocate(position, p_end, position + 1);
         *position = value;
       }
       else
@@ -437,12 +437,10 @@ namespace etl
     //*********************************************************************
     void insert(iterator position, size_t n, value_type value)
     {
-      ETL_ASSERT((size() + 1) <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
-      std::copy_backward(position, p_end, p_end + n);
+      p_end = etl::relocate(position, p_end, position + n);
       std::fill_n(position, n, value);
-
-      p_end += n;
     }
 
     //*********************************************************************
@@ -460,9 +458,8 @@ namespace etl
 
       ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
-      std::copy_backward(position, p_end, p_end + count);
+      p_end = etl::relocate(position, p_end, position + count);
       std::copy(first, last, position);
-      p_end += count;
     }
 
     //*********************************************************************
@@ -472,8 +469,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
-      --p_end;
+      p_end = etl::relocate(i_element + 1, p_end, i_element);
 
       return i_element;
     }
@@ -488,11 +484,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator first, iterator last)
     {
-      std::copy(last, end(), first);
-      size_t n_delete = std::distance(first, last);
-
-      // Just adjust the count.
-      p_end -= n_delete;
+      p_end = etl::relocate(last, p_end, first);
 
       return first;
     }
@@ -0,0 +1,346 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_STRING_SEARCH__
+#define __ETL_STRING_SEARCH__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "algorithm_simd.h"
+
+//*****************************************************************************
+// Substring and character class search for ibasic_string.
+//
+// A substring search first filters the candidate positions by comparing the
+// first and last characters of the needle, and only compares the whole needle
+// where both match. For integral characters of 1, 2 or 4 bytes the filter
+// tests a register's worth of positions at a time.
+//
+// Character class searches (find_first_of etc.) build the set of characters
+// once per call. Single byte characters use a 256 bit map, so each test is a
+// shift and a mask, whatever the number of characters in the set.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_basic_string__
+  {
+    //*************************************************************************
+    /// Compares n characters.
+    //*************************************************************************
+    template <typename T>
+    bool equal(const T* a, const T* b, size_t n)
+    {
+      while (n-- != 0)
+      {
+        if (!(*a++ == *b++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of s[0, n) in [first, last).
+    /// n must be at least 1.
+    ///\return A pointer to the start of the match, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* search_scalar(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      const T  front      = s[0];
+      const T  back       = s[n - 1];
+      const T* last_start = last - n;
+
+      while (first <= last_start)
+      {
+        if ((*first == front) && (first[n - 1] == back) && equal(first + 1, s + 1, n - 1))
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of s[0, n) in [first, last).
+    /// n must be at least 1.
+    ///\return A pointer to the start of the match, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* search_last_scalar(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      const T  front = s[0];
+      const T  back  = s[n - 1];
+      const T* start = last - n;
+
+      while (true)
+      {
+        if ((*start == front) && (start[n - 1] == back) && equal(start + 1, s + 1, n - 1))
+        {
+          return start;
+        }
+
+        if (start == first)
+        {
+          return last;
+        }
+
+        --start;
+      }
+    }
+
+#if defined(ETL_SIMD)
+    //*************************************************************************
+    /// The mask bits for one character of type T.
+    //*************************************************************************
+    template <typename T>
+    struct lane_mask
+    {
+      static const uint32_t value = (uint32_t(1) << sizeof(T)) - 1;
+    };
+
+    //*************************************************************************
+    /// Vectorised search for integral characters.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<__private_algorithm__::is_simd_type<T>::value, const T*>::type
+      search(const T* first, const T* last, const T* s, size_t n)
+    {
+      typedef __private_algorithm__::simd         simd;
+      typedef __private_algorithm__::simd_lanes<T> lanes;
+
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      if (n == 1)
+      {
+        return __private_algorithm__::find(first, last, s[0]);
+      }
+
+      const typename lanes::reg_t front = lanes::set(s[0]);
+      const typename lanes::reg_t back  = lanes::set(s[n - 1]);
+
+      // The number of positions at which a match may start.
+      size_t count = size_t(last - first) - n + 1;
+
+      while (count >= lanes::COUNT)
+      {
+        uint32_t mask = simd::mask(simd::bit_and(lanes::lane_t::equal(simd::load(first), front),
+                                                 lanes::lane_t::equal(simd::load(first + n - 1), back)));
+
+        while (mask != 0)
+        {
+          uint32_t index = __private_algorithm__::first_set_bit(mask) / sizeof(T);
+
+          if (equal(first + index + 1, s + 1, n - 1))
+          {
+            return first + index;
+          }
+
+          mask &= ~(lane_mask<T>::value << (index * sizeof(T)));
+        }
+
+        first += lanes::COUNT;
+        count -= lanes::COUNT;
+      }
+
+      return search_scalar(first, last, s, n);
+    }
+
+    //*************************************************************************
+    /// Vectorised reverse search for integral characters.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<__private_algorithm__::is_simd_type<T>::value, const T*>::type
+      search_last(const T* first, const T* last, const T* s, size_t n)
+    {
+      typedef __private_algorithm__::simd         simd;
+      typedef __private_algorithm__::simd_lanes<T> lanes;
+
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      const typename lanes::reg_t front = lanes::set(s[0]);
+      const typename lanes::reg_t back  = lanes::set(s[n - 1]);
+
+      // The number of positions at which a match may start.
+      size_t count = size_t(last - first) - n + 1;
+
+      while (count >= lanes::COUNT)
+      {
+        count -= lanes::COUNT;
+
+        const T* block = first + count;
+
+        uint32_t mask = simd::mask(simd::bit_and(lanes::lane_t::equal(simd::load(block), front),
+                                                 lanes::lane_t::equal(simd::load(block + n - 1), back)));
+
+        while (mask != 0)
+        {
+          uint32_t index = __private_algorithm__::last_set_bit(mask) / sizeof(T);
+
+          if (equal(block + index + 1, s + 1, n - 1))
+          {
+            return block + index;
+          }
+
+          mask &= ~(lane_mask<T>::value << (index * sizeof(T)));
+        }
+      }
+
+      // The remaining positions are at the start.
+      const T* remainder_last = first + count + n - 1;
+      const T* match          = search_last_scalar(first, remainder_last, s, n);
+
+      return (match == remainder_last) ? last : match;
+    }
+#endif
+
+    //*************************************************************************
+    /// Search for other characters.
+    //*************************************************************************
+    template <typename T>
+#if defined(ETL_SIMD)
+    typename etl::enable_if<!__private_algorithm__::is_simd_type<T>::value, const T*>::type
+#else
+    const T*
+#endif
+      search(const T* first, const T* last, const T* s, size_t n)
+    {
+      return search_scalar(first, last, s, n);
+    }
+
+    //*************************************************************************
+    /// Reverse search for other characters.
+    //*************************************************************************
+    template <typename T>
+#if defined(ETL_SIMD)
+    typename etl::enable_if<!__private_algorithm__::is_simd_type<T>::value, const T*>::type
+#else
+    const T*
+#endif
+      search_last(const T* first, const T* last, const T* s, size_t n)
+    {
+      return search_last_scalar(first, last, s, n);
+    }
+
+    //*************************************************************************
+    /// A set of characters.
+    /// Wider characters are compared against each member in turn.
+    //*************************************************************************
+    template <typename T, const bool IS_BYTE = (sizeof(T) == 1)>
+    class char_set
+    {
+    public:
+
+      char_set(const T* s, size_t n)
+        : p_chars(s),
+          length(n)
+      {
+      }
+
+      bool contains(T c) const
+      {
+        for (size_t i = 0; i < length; ++i)
+        {
+          if (p_chars[i] == c)
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      const T* p_chars;
+      size_t   length;
+    };
+
+    //*************************************************************************
+    /// A set of single byte characters, as a 256 bit map.
+    //*************************************************************************
+    template <typename T>
+    class char_set<T, true>
+    {
+    public:
+
+      char_set(const T* s, size_t n)
+      {
+        memset(bits, 0, sizeof(bits));
+
+        while (n-- != 0)
+        {
+          uint8_t c = uint8_t(*s++);
+          bits[c >> 5] |= uint32_t(1) << (c & 31);
+        }
+      }
+
+      bool contains(T c) const
+      {
+        uint8_t u = uint8_t(c);
+
+        return ((bits[u >> 5] >> (u & 31)) & 1) != 0;
+      }
+
+    private:
+
+      uint32_t bits[8];
+    };
+  }
+}
+
+#endif
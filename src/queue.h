@@ -33,6 +33,9 @@ SOFTWARE.
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <utility>
 
 #include "container.h"
 #include "alignment.h"
@@ -307,6 +310,75 @@ namespace etl
       --construct_count;
     }
 
+    //*************************************************************************
+    /// Gets the contiguous run of free storage at the back of the queue, so
+    /// that items may be written directly into it, for example by 'read'.
+    /// The items become part of the queue when passed to 'commit'.
+    /// The storage is uninitialised; the caller constructs the items.
+    /// If the queue is empty the run starts at the beginning of the storage.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<pointer, size_type> reserve()
+    {
+      if (current_size == 0)
+      {
+        in  = 0;
+        out = 0;
+      }
+
+      return std::pair<pointer, size_type>(p_buffer + in, free_length());
+    }
+
+    //*************************************************************************
+    /// Adds 'n' items, constructed at the start of the run returned by 'reserve',
+    /// to the back of the queue.
+    /// If asserts or exceptions are enabled, throws an etl::queue_full if 'n'
+    /// is larger than the run.
+    ///\param n The number of items to add.
+    //*************************************************************************
+    void commit(size_type n)
+    {
+      ETL_ASSERT(n <= free_length(), ETL_ERROR(queue_full));
+
+      in = (in + n == CAPACITY) ? 0 : in + n;
+      current_size    += n;
+      construct_count += n;
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous run of items at the front of the queue, so that
+    /// they may be read directly, for example by 'write'.
+    /// The items are removed with 'consume'.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<pointer, size_type> peek()
+    {
+      return std::pair<pointer, size_type>(p_buffer + out, std::min(current_size, CAPACITY - out));
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous run of items at the front of the queue.
+    ///\return A pointer to the run and its length.
+    //*************************************************************************
+    std::pair<const_pointer, size_type> peek() const
+    {
+      return std::pair<const_pointer, size_type>(p_buffer + out, std::min(current_size, CAPACITY - out));
+    }
+
+    //*************************************************************************
+    /// Removes 'n' items from the front of the queue.
+    /// The items may span the end of the run returned by 'peek'.
+    /// If asserts or exceptions are enabled, throws an etl::queue_empty if
+    /// there are fewer than 'n' items.
+    ///\param n The number of items to remove.
+    //*************************************************************************
+    void consume(size_type n)
+    {
+      ETL_ASSERT(n <= current_size, ETL_ERROR(queue_empty));
+
+      destroy_front(n);
+    }
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -322,17 +394,85 @@ namespace etl
 
   protected:
 
+    //*************************************************************************
+    /// Make this a clone of the supplied queue
+    /// Trivially copyable types are copied with memcpy, one contiguous run at a time.
+    //*************************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_copy_constructible<U>::value, void>::type
+      clone(const iqueue& other)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(other.size() <= available(), ETL_ERROR(queue_full));
+#endif
+      size_t n     = other.size();
+      size_t index = other.out;
+
+      while (n > 0)
+      {
+        size_t length = std::min(n, std::min(other.CAPACITY - index, CAPACITY - in));
+
+        memcpy(p_buffer + in, other.p_buffer + index, length * sizeof(T));
+
+        index = (index + length == other.CAPACITY) ? 0 : index + length;
+        in    = (in + length == CAPACITY) ? 0 : in + length;
+        current_size    += length;
+        construct_count += length;
+        n               -= length;
+      }
+    }
+
     //*************************************************************************
     /// Make this a clone of the supplied queue
     //*************************************************************************
-    void clone(const iqueue& other)
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_copy_constructible<U>::value, void>::type
+      clone(const iqueue& other)
     {
       size_t index = other.out;
 
       for (size_t i = 0; i < other.size(); ++i)
       {
         push(other.p_buffer[index]);
-        index = (index == (CAPACITY - 1)) ? 0 : index + 1;
+        index = (index == (other.CAPACITY - 1)) ? 0 : index + 1;
+      }
+    }
+
+    //*************************************************************************
+    /// The length of the contiguous run of free storage at the back.
+    //*************************************************************************
+    size_type free_length() const
+    {
+      if (current_size == CAPACITY)
+      {
+        return 0;
+      }
+
+      return (in >= out) ? CAPACITY - in : out - in;
+    }
+
+    //*************************************************************************
+    /// Removes 'n' trivially destructible items from the front.
+    //*************************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_destructible<U>::value, void>::type
+      destroy_front(size_type n)
+    {
+      out = (out + n >= CAPACITY) ? out + n - CAPACITY : out + n;
+      current_size    -= n;
+      construct_count -= n;
+    }
+
+    //*************************************************************************
+    /// Removes 'n' items from the front.
+    //*************************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_destructible<U>::value, void>::type
+      destroy_front(size_type n)
+    {
+      while (n-- > 0)
+      {
+        pop();
       }
     }
 
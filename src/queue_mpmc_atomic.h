@@ -0,0 +1,399 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_QUEUE_MPMC_ATOMIC__
+#define __ETL_QUEUE_MPMC_ATOMIC__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "power.h"
+#include "static_assert.h"
+
+#if defined(ETL_ATOMIC_SUPPORTED)
+
+#include <atomic>
+
+//*****************************************************************************
+///\defgroup queue_mpmc_atomic queue_mpmc_atomic
+/// A lock-free, multiple producer, multiple consumer, First-in / first-out
+/// queue with the capacity defined at compile time.
+/// Requires C++11 atomics.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for all multiple producer, multiple consumer queues.
+  /// Producers claim a slot by advancing the enqueue position and consumers
+  /// by advancing the dequeue position. Each slot carries a sequence number
+  /// that says whether it is ready to be written or read for the current lap
+  /// of the buffer, so that a claimed slot is never accessed by two threads.
+  ///\ingroup queue_mpmc_atomic
+  //***************************************************************************
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    typedef size_t size_type; ///< The type used for determining the size of queue.
+
+    //*************************************************************************
+    /// Returns the current number of items in the queue.
+    /// The result is only exact if no other thread is accessing the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      const size_type dequeue = dequeue_position.load(std::memory_order_acquire);
+      const size_type enqueue = enqueue_position.load(std::memory_order_acquire);
+      const size_type count   = enqueue - dequeue;
+
+      // The positions are read at different times, so may appear out of range.
+      if (count > CAPACITY)
+      {
+        return (count > (~size_type(0) / 2)) ? 0 : CAPACITY;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    /// \return <b>true</b> if the queue is empty, otherwise <b>false</b>
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    /// \return <b>true</b> if the queue is full, otherwise <b>false</b>
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - size();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    queue_mpmc_atomic_base(size_type capacity_)
+      : enqueue_position(0),
+        dequeue_position(0),
+        CAPACITY(capacity_),
+        MASK(capacity_ - 1)
+    {
+    }
+
+    std::atomic<size_type> enqueue_position; ///< The next position to be written.
+    char                   producer_padding[ETL_CACHE_LINE_SIZE];
+
+    std::atomic<size_type> dequeue_position; ///< The next position to be read.
+    char                   consumer_padding[ETL_CACHE_LINE_SIZE];
+
+    const size_type CAPACITY;                ///< The maximum number of items in the queue.
+    const size_type MASK;                    ///< Converts a position to a slot index.
+
+  private:
+
+    // Disable copy construction and assignment.
+    queue_mpmc_atomic_base(const queue_mpmc_atomic_base&);
+    queue_mpmc_atomic_base& operator =(const queue_mpmc_atomic_base&);
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all multiple producer, multiple consumer
+  /// queues that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// \tparam T The type of value that the queue holds.
+  //***************************************************************************
+  template <typename T>
+  class iqueue_mpmc_atomic : public etl::queue_mpmc_atomic_base
+  {
+  public:
+
+    typedef T                                 value_type;      ///< The type stored in the queue.
+    typedef T&                                reference;       ///< A reference to the type used in the queue.
+    typedef const T&                          const_reference; ///< A const reference to the type used in the queue.
+    typedef T*                                pointer;         ///< A pointer to the type used in the queue.
+    typedef const T*                          const_pointer;   ///< A const pointer to the type used in the queue.
+    typedef queue_mpmc_atomic_base::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    //*************************************************************************
+    /// A slot in the buffer.
+    //*************************************************************************
+    struct slot_t
+    {
+      std::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+    typedef typename etl::make_signed<size_type>::type difference_t;
+
+  public:
+
+    //*************************************************************************
+    /// Adds a value to the queue, if there is room.
+    ///\param value The value to push to the queue.
+    ///\return <b>true</b> if the value was pushed, <b>false</b> if the queue was full.
+    //*************************************************************************
+    bool try_push(parameter_t value)
+    {
+      size_type position = enqueue_position.load(std::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_t& slot = p_slots[position & MASK];
+
+        const size_type    sequence   = slot.sequence.load(std::memory_order_acquire);
+        const difference_t difference = difference_t(sequence - position);
+
+        if (difference == 0)
+        {
+          // The slot is free for this lap. Try to claim it.
+          if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+          {
+            ::new (&slot.value) T(value);
+            slot.sequence.store(position + 1, std::memory_order_release);
+
+            return true;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot still holds the value from the previous lap.
+          return false;
+        }
+        else
+        {
+          // Another producer claimed the slot first.
+          position = enqueue_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue, if there is one.
+    ///\param value Receives the value removed from the queue.
+    ///\return <b>true</b> if a value was popped, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    bool try_pop(reference value)
+    {
+      size_type position = dequeue_position.load(std::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_t& slot = p_slots[position & MASK];
+
+        const size_type    sequence   = slot.sequence.load(std::memory_order_acquire);
+        const difference_t difference = difference_t(sequence - (position + 1));
+
+        if (difference == 0)
+        {
+          // The slot has been written for this lap. Try to claim it.
+          if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+          {
+            T* p_value = reinterpret_cast<T*>(&slot.value);
+            value = *p_value;
+            p_value->~T();
+            slot.sequence.store(position + CAPACITY, std::memory_order_release);
+
+            return true;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been written yet.
+          return false;
+        }
+        else
+        {
+          // Another consumer claimed the slot first.
+          position = dequeue_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue, spinning until there is room.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(parameter_t value)
+    {
+      while (!try_push(value))
+      {
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue, spinning until there is one.
+    ///\param value Receives the value removed from the queue.
+    //*************************************************************************
+    void pop(reference value)
+    {
+      while (!try_pop(value))
+      {
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    /// Must not be called while any other thread is accessing the queue.
+    //*************************************************************************
+    void clear()
+    {
+      size_type position = dequeue_position.load(std::memory_order_relaxed);
+      const size_type end = enqueue_position.load(std::memory_order_relaxed);
+
+      while (position != end)
+      {
+        slot_t& slot = p_slots[position & MASK];
+
+        reinterpret_cast<T*>(&slot.value)->~T();
+        slot.sequence.store(position + CAPACITY, std::memory_order_relaxed);
+        ++position;
+      }
+
+      dequeue_position.store(position, std::memory_order_release);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot_t* p_slots_, size_type capacity_)
+      : queue_mpmc_atomic_base(capacity_),
+        p_slots(p_slots_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the sequence of each slot.
+    /// Called from the derived class constructor, once the slots exist.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < CAPACITY; ++i)
+      {
+        p_slots[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    slot_t* p_slots; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity, multiple producer, multiple consumer queue.
+  /// \tparam T    The type this queue should support.
+  /// \tparam SIZE The maximum capacity of the queue. Must be a power of 2.
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T>
+  {
+  public:
+
+    STATIC_ASSERT(etl::is_power_of_2<SIZE>::value, "SIZE must be a power of 2");
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : etl::iqueue_mpmc_atomic<T>(slots, SIZE)
+    {
+      etl::iqueue_mpmc_atomic<T>::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      etl::iqueue_mpmc_atomic<T>::clear();
+    }
+
+  private:
+
+    /// The slots used in the queue.
+    typename etl::iqueue_mpmc_atomic<T>::slot_t slots[SIZE];
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,440 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_QUEUE_SPSC_ATOMIC__
+#define __ETL_QUEUE_SPSC_ATOMIC__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <iterator>
+
+#include "platform.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+
+#if defined(ETL_ATOMIC_SUPPORTED)
+
+#include <atomic>
+
+//*****************************************************************************
+///\defgroup queue_spsc_atomic queue_spsc_atomic
+/// A wait-free, single producer, single consumer, First-in / first-out queue
+/// with the capacity defined at compile time.
+/// Requires C++11 atomics.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for all single producer, single consumer queues.
+  /// The write index is only written by the producer and the read index is
+  /// only written by the consumer. Each is kept on its own cache line with the
+  /// owner's cached copy of the other index, so that the opposite index is
+  /// only reloaded when the queue appears to be full or empty.
+  ///\ingroup queue_spsc_atomic
+  //***************************************************************************
+  class queue_spsc_atomic_base
+  {
+  public:
+
+    typedef size_t size_type; ///< The type used for determining the size of queue.
+
+    //*************************************************************************
+    /// Returns the current number of items in the queue.
+    /// The result is only exact if neither thread is accessing the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      const size_type write = write_index.load(std::memory_order_acquire);
+      const size_type read  = read_index.load(std::memory_order_acquire);
+
+      return (write >= read) ? write - read : RESERVED - read + write;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return RESERVED - 1;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return RESERVED - 1;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    /// Exact when called by the consumer.
+    /// \return <b>true</b> if the queue is empty, otherwise <b>false</b>
+    //*************************************************************************
+    bool empty() const
+    {
+      return read_index.load(std::memory_order_acquire) == write_index.load(std::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    /// Exact when called by the producer.
+    /// \return <b>true</b> if the queue is full, otherwise <b>false</b>
+    //*************************************************************************
+    bool full() const
+    {
+      return get_next_index(write_index.load(std::memory_order_acquire)) == read_index.load(std::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return max_size() - size();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    queue_spsc_atomic_base(size_type reserved_)
+      : write_index(0),
+        cached_read_index(0),
+        read_index(0),
+        cached_write_index(0),
+        RESERVED(reserved_)
+    {
+    }
+
+    //*************************************************************************
+    /// Calculates the index following the one supplied.
+    //*************************************************************************
+    size_type get_next_index(size_type index) const
+    {
+      ++index;
+
+      return (index == RESERVED) ? 0 : index;
+    }
+
+    //*************************************************************************
+    /// The number of free slots, as seen by the producer.
+    /// Only reloads the read index if fewer than 'wanted' slots appear free.
+    //*************************************************************************
+    size_type producer_free(size_type write, size_type wanted)
+    {
+      size_type free = free_slots(write, cached_read_index);
+
+      if (free < wanted)
+      {
+        cached_read_index = read_index.load(std::memory_order_acquire);
+        free = free_slots(write, cached_read_index);
+      }
+
+      return free;
+    }
+
+    //*************************************************************************
+    /// The number of used slots, as seen by the consumer.
+    /// Only reloads the write index if fewer than 'wanted' slots appear used.
+    //*************************************************************************
+    size_type consumer_used(size_type read, size_type wanted)
+    {
+      size_type used = used_slots(cached_write_index, read);
+
+      if (used < wanted)
+      {
+        cached_write_index = write_index.load(std::memory_order_acquire);
+        used = used_slots(cached_write_index, read);
+      }
+
+      return used;
+    }
+
+    // Producer.
+    std::atomic<size_type> write_index;        ///< Where to input new data.
+    size_type              cached_read_index;  ///< The producer's copy of the read index.
+    char                   producer_padding[ETL_CACHE_LINE_SIZE];
+
+    // Consumer.
+    std::atomic<size_type> read_index;         ///< Where to get the oldest data.
+    size_type              cached_write_index; ///< The consumer's copy of the write index.
+    char                   consumer_padding[ETL_CACHE_LINE_SIZE];
+
+    const size_type RESERVED;                  ///< The number of slots in the buffer.
+
+  private:
+
+    //*************************************************************************
+    size_type used_slots(size_type write, size_type read) const
+    {
+      return (write >= read) ? write - read : RESERVED - read + write;
+    }
+
+    //*************************************************************************
+    size_type free_slots(size_type write, size_type read) const
+    {
+      return RESERVED - 1 - used_slots(write, read);
+    }
+
+    // Disable copy construction and assignment.
+    queue_spsc_atomic_base(const queue_spsc_atomic_base&);
+    queue_spsc_atomic_base& operator =(const queue_spsc_atomic_base&);
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc_atomic
+  ///\brief This is the base for all single producer, single consumer queues
+  /// that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue.
+  /// 'push' may only be called from one thread and 'pop' and 'clear' from one other.
+  ///\code
+  /// etl::queue_spsc_atomic<int, 10> myQueue;
+  /// etl::iqueue_spsc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// \tparam T The type of value that the queue holds.
+  //***************************************************************************
+  template <typename T>
+  class iqueue_spsc_atomic : public etl::queue_spsc_atomic_base
+  {
+  public:
+
+    typedef T                                 value_type;      ///< The type stored in the queue.
+    typedef T&                                reference;       ///< A reference to the type used in the queue.
+    typedef const T&                          const_reference; ///< A const reference to the type used in the queue.
+    typedef T*                                pointer;         ///< A pointer to the type used in the queue.
+    typedef const T*                          const_pointer;   ///< A const pointer to the type used in the queue.
+    typedef queue_spsc_atomic_base::size_type size_type;       ///< The type used for determining the size of the queue.
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// Producer only.
+    ///\param value The value to push to the queue.
+    ///\return <b>true</b> if the value was pushed, <b>false</b> if the queue was full.
+    //*************************************************************************
+    bool push(parameter_t value)
+    {
+      const size_type write = write_index.load(std::memory_order_relaxed);
+
+      if (producer_free(write, 1) == 0)
+      {
+        return false;
+      }
+
+      ::new (&p_buffer[write]) T(value);
+      write_index.store(get_next_index(write), std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Adds as many values from the range as will fit, publishing them to the
+    /// consumer together.
+    /// Producer only.
+    ///\param first The iterator to the first value to push.
+    ///\param last  The iterator to one past the last value to push.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      const size_type wanted = size_type(std::distance(first, last));
+      size_type       write  = write_index.load(std::memory_order_relaxed);
+      const size_type count  = std::min(wanted, producer_free(write, wanted));
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        ::new (&p_buffer[write]) T(*first);
+        ++first;
+        write = get_next_index(write);
+      }
+
+      if (count != 0)
+      {
+        write_index.store(write, std::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue.
+    /// Consumer only.
+    ///\param value Receives the value removed from the queue.
+    ///\return <b>true</b> if a value was popped, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      const size_type read = read_index.load(std::memory_order_relaxed);
+
+      if (consumer_used(read, 1) == 0)
+      {
+        return false;
+      }
+
+      value = p_buffer[read];
+      p_buffer[read].~T();
+      read_index.store(get_next_index(read), std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue, discarding it.
+    /// Consumer only.
+    ///\return <b>true</b> if a value was popped, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    bool pop()
+    {
+      const size_type read = read_index.load(std::memory_order_relaxed);
+
+      if (consumer_used(read, 1) == 0)
+      {
+        return false;
+      }
+
+      p_buffer[read].~T();
+      read_index.store(get_next_index(read), std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes up to 'n' of the oldest values from the queue, releasing their
+    /// slots to the producer together.
+    /// Consumer only.
+    ///\param destination The iterator to write the values to.
+    ///\param n           The maximum number of values to pop.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type pop(TIterator destination, size_type n)
+    {
+      size_type       read  = read_index.load(std::memory_order_relaxed);
+      const size_type count = std::min(n, consumer_used(read, n));
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        *destination = p_buffer[read];
+        ++destination;
+        p_buffer[read].~T();
+        read = get_next_index(read);
+      }
+
+      if (count != 0)
+      {
+        read_index.store(read, std::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    /// Consumer only.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_spsc_atomic(T* p_buffer_, size_type reserved_)
+      : queue_spsc_atomic_base(reserved_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+  private:
+
+    T* p_buffer; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc_atomic
+  /// A fixed capacity, single producer, single consumer queue.
+  /// \tparam T    The type this queue should support.
+  /// \tparam SIZE The maximum capacity of the queue.
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class queue_spsc_atomic : public etl::iqueue_spsc_atomic<T>
+  {
+  public:
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_spsc_atomic()
+      : etl::iqueue_spsc_atomic<T>(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_spsc_atomic()
+    {
+      etl::iqueue_spsc_atomic<T>::clear();
+    }
+
+  private:
+
+    // One slot is always left empty, to distinguish 'full' from 'empty'.
+    static const size_t RESERVED_SIZE = SIZE + 1;
+
+    /// The uninitialised buffer of T used in the queue.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[RESERVED_SIZE];
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,524 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_RADIX_HEAP__
+#define __ETL_RADIX_HEAP__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "container.h"
+#include "nullptr.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "integral_limits.h"
+#include "binary.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "static_assert.h"
+
+#undef ETL_FILE
+#define ETL_FILE "37"
+
+//*****************************************************************************
+///\defgroup radix_heap radix_heap
+/// A monotone priority queue for unsigned integral keys, with the capacity
+/// defined at compile time. The value with the smallest key is at the top.
+/// A key may not be smaller than the last key removed from the top.
+///
+/// Values are kept in buckets by the highest bit in which their key differs
+/// from the last key removed. Bucket 0 holds keys equal to it. When bucket 0
+/// is empty, the first non-empty bucket is found from a bit mask, its
+/// smallest key becomes the new last key, and its values are redistributed
+/// to lower buckets. A value only ever moves to lower buckets, so each
+/// operation is amortised O(log C), where C is the range of the keys.
+///
+/// Peeking at the top redistributes as far as the current smallest key.
+/// Pushing a key below that, but not below the last key removed, is allowed,
+/// and redistributes every value, so is O(N).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for radix_heap exceptions.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_exception : public exception
+  {
+  public:
+
+    radix_heap_exception(string_type what, string_type file_name, numeric_type line_number)
+      : exception(what, file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the heap is full.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_full : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_full(string_type file_name, numeric_type line_number)
+      : radix_heap_exception(ETL_ERROR_TEXT("radix_heap:full", ETL_FILE"A"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a key is smaller than the last key removed.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_key : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_key(string_type file_name, numeric_type line_number)
+      : radix_heap_exception(ETL_ERROR_TEXT("radix_heap:key", ETL_FILE"B"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all radix heaps.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_base
+  {
+  public:
+
+    typedef size_t size_type; ///< The type used for determining the size of the heap.
+
+    //*************************************************************************
+    /// Returns the current number of items in the heap.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be held.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is empty.
+    /// \return <b>true</b> if the heap is empty, otherwise <b>false</b>
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is full.
+    /// \return <b>true</b> if the heap is full, otherwise <b>false</b>
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    radix_heap_base(size_type max_size_)
+      : current_size(0),
+        CAPACITY(max_size_)
+    {
+    }
+
+    size_type         current_size;    ///< The number of items in the heap.
+    const size_type   CAPACITY;        ///< The maximum number of items in the heap.
+    etl::debug_count  construct_count; ///< For internal debugging purposes.
+  };
+
+  //***************************************************************************
+  ///\ingroup radix_heap
+  ///\brief This is the base for all radix heaps that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived heap.
+  ///\code
+  /// etl::radix_heap<int, 10> myHeap;
+  /// etl::iradix_heap<int>& iHeap = myHeap;
+  ///\endcode
+  /// \tparam T    The type of value that the heap holds.
+  /// \tparam TKey The unsigned integral type of the key.
+  //***************************************************************************
+  template <typename T, typename TKey = uint32_t>
+  class iradix_heap : public etl::radix_heap_base
+  {
+  public:
+
+    STATIC_ASSERT(etl::is_integral<TKey>::value && etl::is_unsigned<TKey>::value, "The key must be an unsigned integral type");
+
+    typedef T        value_type;      ///< The type stored in the heap.
+    typedef TKey     key_type;        ///< The type of the key.
+    typedef T&       reference;       ///< A reference to the type used in the heap.
+    typedef const T& const_reference; ///< A const reference to the type used in the heap.
+    typedef T*       pointer;         ///< A pointer to the type used in the heap.
+    typedef const T* const_pointer;   ///< A const pointer to the type used in the heap.
+
+    static const size_t KEY_BITS = etl::integral_limits<TKey>::bits;
+
+    /// Bucket 0, plus one for each bit of the key.
+    static const size_t BUCKETS = KEY_BITS + 1;
+
+  protected:
+
+    //*************************************************************************
+    /// The key, the value and the link to the next node in the same bucket,
+    /// kept together so that a node is fetched with a single cache miss.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t* p_next;
+      TKey    key;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+
+      T& get_value()
+      {
+        return *reinterpret_cast<T*>(&value);
+      }
+    };
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+    STATIC_ASSERT(KEY_BITS <= 64, "The key must have no more than 64 bits");
+
+  public:
+
+    //*************************************************************************
+    /// Gets a reference to the value with the smallest key.
+    /// May redistribute the values between buckets, so is not const.
+    //*************************************************************************
+    reference top()
+    {
+      refill();
+      return buckets[0]->get_value();
+    }
+
+    //*************************************************************************
+    /// Gets the smallest key.
+    /// May redistribute the values between buckets, so is not const.
+    //*************************************************************************
+    key_type top_key()
+    {
+      refill();
+      return last_key;
+    }
+
+    //*************************************************************************
+    /// Adds a value to the heap.
+    /// If asserts or exceptions are enabled, throws an etl::radix_heap_full
+    /// if the heap is already full, or an etl::radix_heap_key if the key is
+    /// smaller than the last key removed from the top.
+    /// A key smaller than the top, after the top has been read, causes every
+    /// value to be redistributed.
+    ///\param key   The key of the value.
+    ///\param value The value to push to the heap.
+    //*************************************************************************
+    void push(key_type key, parameter_t value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT(!(key < last_popped_key), ETL_ERROR(radix_heap_key));
+
+      if (key < last_key)
+      {
+        rebase(key);
+      }
+
+      node_t* p_node = p_free;
+      p_free = p_node->p_next;
+
+      ::new (&p_node->value) T(value);
+      p_node->key = key;
+      ++construct_count;
+      ++current_size;
+
+      add_to_bucket(p_node);
+    }
+
+    //*************************************************************************
+    /// Removes the value with the smallest key.
+    /// Does nothing if the heap is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (empty())
+      {
+        return;
+      }
+
+      refill();
+
+      node_t* p_node = buckets[0];
+      buckets[0] = p_node->p_next;
+      last_popped_key = last_key;
+
+      p_node->get_value().~T();
+      --construct_count;
+      --current_size;
+
+      p_node->p_next = p_free;
+      p_free = p_node;
+    }
+
+    //*************************************************************************
+    /// Clears the heap to the empty state.
+    /// The last key is reset to zero.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0; i < BUCKETS; ++i)
+      {
+        node_t* p_node = buckets[i];
+
+        while (p_node != nullptr)
+        {
+          p_node->get_value().~T();
+          --construct_count;
+          p_node = p_node->p_next;
+        }
+      }
+
+      initialise();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iradix_heap(node_t* p_nodes_, size_type max_size_)
+      : radix_heap_base(max_size_),
+        p_nodes(p_nodes_)
+    {
+      initialise();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Empties the buckets and links all of the nodes into the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0; i < BUCKETS; ++i)
+      {
+        buckets[i] = nullptr;
+      }
+
+      for (size_type i = 0; i < (CAPACITY - 1); ++i)
+      {
+        p_nodes[i].p_next = &p_nodes[i + 1];
+      }
+
+      p_nodes[CAPACITY - 1].p_next = nullptr;
+      p_free = p_nodes;
+
+      current_size    = 0;
+      last_key        = 0;
+      last_popped_key = 0;
+      occupied_mask   = 0;
+    }
+
+    //*************************************************************************
+    /// Links the node into the bucket for its key.
+    /// Bucket 0 if the key is equal to the last key, otherwise one more than
+    /// the index of the highest bit that differs.
+    //*************************************************************************
+    void add_to_bucket(node_t* p_node)
+    {
+      const key_type key   = p_node->key;
+      const size_t   index = KEY_BITS - etl::count_leading_zeros(key_type(key ^ last_key));
+
+      p_node->p_next = buckets[index];
+      buckets[index] = p_node;
+
+      if (index != 0)
+      {
+        const uint64_t bit = uint64_t(1) << (index - 1);
+
+        if (((occupied_mask & bit) == 0) || (key < minimum_keys[index]))
+        {
+          minimum_keys[index] = key;
+        }
+
+        occupied_mask |= bit;
+      }
+    }
+
+    //*************************************************************************
+    /// If bucket 0 is empty, moves the smallest key to it by redistributing
+    /// the first non-empty bucket.
+    //*************************************************************************
+    void refill()
+    {
+      if ((buckets[0] != nullptr) || (occupied_mask == 0))
+      {
+        return;
+      }
+
+      const size_t index = size_t(etl::count_trailing_zeros(occupied_mask)) + 1;
+
+      node_t* p_node = buckets[index];
+
+      buckets[index] = nullptr;
+      occupied_mask &= ~(uint64_t(1) << (index - 1));
+
+      // Every key in the bucket now differs from the last key in a lower bit.
+      last_key = minimum_keys[index];
+
+      while (p_node != nullptr)
+      {
+        node_t* p_next = p_node->p_next;
+        add_to_bucket(p_node);
+        p_node = p_next;
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a key smaller than the last key the base of the buckets, by
+    /// redistributing every value.
+    //*************************************************************************
+    void rebase(key_type key)
+    {
+      node_t* p_list = nullptr;
+
+      for (size_t i = 0; i < BUCKETS; ++i)
+      {
+        node_t* p_node = buckets[i];
+        buckets[i] = nullptr;
+
+        while (p_node != nullptr)
+        {
+          node_t* p_next = p_node->p_next;
+          p_node->p_next = p_list;
+          p_list = p_node;
+          p_node = p_next;
+        }
+      }
+
+      occupied_mask = 0;
+      last_key      = key;
+
+      while (p_list != nullptr)
+      {
+        node_t* p_next = p_list->p_next;
+        add_to_bucket(p_list);
+        p_list = p_next;
+      }
+    }
+
+    // Disable copy construction.
+    iradix_heap(const iradix_heap&);
+
+    node_t*  p_nodes;               ///< The node pool.
+    node_t*  p_free;                ///< The first node of the free list.
+    key_type last_key;              ///< The key that the buckets are based on. The last key removed, or the current top.
+    key_type last_popped_key;       ///< The last key removed from the top.
+    uint64_t occupied_mask;         ///< Bit N set if bucket N + 1 is not empty.
+    node_t*  buckets[BUCKETS];      ///< The first node of each bucket.
+    key_type minimum_keys[BUCKETS]; ///< The smallest key in each non-empty bucket.
+  };
+
+  //***************************************************************************
+  ///\ingroup radix_heap
+  /// A fixed capacity radix heap.
+  /// This heap does not support concurrent access by different threads.
+  /// \tparam T    The type this heap should support.
+  /// \tparam SIZE The maximum capacity of the heap.
+  /// \tparam TKey The unsigned integral type of the key.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, typename TKey = uint32_t>
+  class radix_heap : public etl::iradix_heap<T, TKey>
+  {
+  public:
+
+    STATIC_ASSERT(SIZE > 0, "Zero capacity not supported");
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    radix_heap()
+      : etl::iradix_heap<T, TKey>(nodes, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_heap()
+    {
+      etl::iradix_heap<T, TKey>::clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    radix_heap(const radix_heap&);
+    radix_heap& operator =(const radix_heap&);
+
+    /// The node pool.
+    typename etl::iradix_heap<T, TKey>::node_t nodes[SIZE];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
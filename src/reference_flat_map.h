@@ -41,6 +41,9 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "exception.h"
 #include "static_assert.h"
+#include "search_policy.h"
+#include "algorithm.h"
+#include "private/flat_merge.h"
 
 #undef ETL_FILE
 #define ETL_FILE "30"
@@ -50,6 +53,7 @@ SOFTWARE.
 /// An reference_flat_map with the capacity defined at compile time.
 /// Has insertion of O(N) and search of O(logN)
 /// Duplicate entries are not allowed.
+/// The search may be changed by supplying a search policy from search_policy.h.
 ///\ingroup containers
 //*****************************************************************************
 
@@ -97,12 +101,26 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  ///\ingroup reference_flat_map
+  /// Unsorted range exception.
+  //***************************************************************************
+  class flat_map_not_sorted : public etl::flat_map_exception
+  {
+  public:
+
+    flat_map_not_sorted(string_type file_name, numeric_type line_number)
+      : flat_map_exception(ETL_ERROR_TEXT("flat_map:not sorted", ETL_FILE"C"), file_name, line_number)
+    {
+    }
+  };
+
   //***************************************************************************
   /// The base class for specifically sized reference_flat_maps.
   /// Can be used as a reference type for all reference_flat_maps containing a specific type.
   ///\ingroup reference_flat_map
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey> >
+  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey>, typename TSearch = etl::binary_search_policy>
   class ireference_flat_map
   {
   public:
@@ -118,6 +136,7 @@ namespace etl
     typedef TKey              key_type;
     typedef TMapped           mapped_type;
     typedef TKeyCompare       key_compare;
+    typedef TSearch           search_policy;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
     typedef value_type*       pointer;
@@ -342,6 +361,26 @@ namespace etl
       {
         return key_compare()(key, element.first);
       }
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return key_compare()(lhs->first, rhs->first);
+      }
+
+      bool operator ()(const value_type* element, key_type key) const
+      {
+        return key_compare()(element->first, key);
+      }
+
+      bool operator ()(key_type key, const value_type* element) const
+      {
+        return key_compare()(key, element->first);
+      }
+
+      static key_type key(const value_type* element)
+      {
+        return element->first;
+      }
     };
 
   public:
@@ -531,10 +570,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -552,28 +588,44 @@ namespace etl
     //*********************************************************************
     /// Inserts a value to the reference_flat_map.
     /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map is already full.
-    ///\param position The position to insert at.
+    ///\param position The position to insert at. Used as a hint by the search policy.
     ///\param value    The value to insert.
     //*********************************************************************
     iterator insert(iterator position, reference value)
     {
-      return insert(value).first;
+      iterator i_element = lower_bound(position, value.first);
+
+      return insert_at(i_element, value).first;
     }
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_map.
+    /// The values are sorted and merged with the existing elements in a single pass.
     /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key, to the reference_flat_map.
+    /// The values are merged with the existing elements in a single pass.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_map_not_sorted if the values are not sorted,
+    /// which reads the range an extra time.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(etl::is_sorted(first, last, etl::__private_flat__::key_first_compare<key_compare>()), ETL_ERROR(flat_map_not_sorted));
+
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -690,7 +742,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return std::lower_bound(begin(), end(), key, compare());
+      return iterator(TSearch::lower_bound(lookup.begin(), lookup.end(), lookup.end(), key, compare()));
     }
 
     //*********************************************************************
@@ -700,7 +752,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return std::lower_bound(cbegin(), cend(), key, compare());
+      return const_iterator(TSearch::lower_bound(lookup.cbegin(), lookup.cend(), lookup.cend(), key, compare()));
     }
 
     //*********************************************************************
@@ -710,7 +762,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return std::upper_bound(begin(), end(), key, compare());
+      return iterator(TSearch::upper_bound(lookup.begin(), lookup.end(), lookup.end(), key, compare()));
     }
 
     //*********************************************************************
@@ -720,7 +772,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return std::upper_bound(begin(), end(), key, compare());
+      return const_iterator(TSearch::upper_bound(lookup.cbegin(), lookup.cend(), lookup.cend(), key, compare()));
     }
 
     //*********************************************************************
@@ -730,9 +782,10 @@ namespace etl
     //*********************************************************************
     std::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator i_lower = std::lower_bound(begin(), end(), key, compare());
+      iterator i_lower = lower_bound(key);
+      iterator i_upper(TSearch::upper_bound(i_lower.ilookup, lookup.end(), i_lower.ilookup, key, compare()));
 
-      return std::make_pair(i_lower, std::upper_bound(i_lower, end(), key, compare()));
+      return std::make_pair(i_lower, i_upper);
     }
 
     //*********************************************************************
@@ -742,9 +795,10 @@ namespace etl
     //*********************************************************************
     std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator i_lower = std::lower_bound(cbegin(), cend(), key, compare());
+      const_iterator i_lower = lower_bound(key);
+      const_iterator i_upper(TSearch::upper_bound(i_lower.ilookup, lookup.cend(), i_lower.ilookup, key, compare()));
 
-      return std::make_pair(i_lower, std::upper_bound(i_lower, cend(), key, compare()));
+      return std::make_pair(i_lower, i_upper);
     }
 
     //*************************************************************************
@@ -811,6 +865,17 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Finds the lower bound of a key, starting the search from a hint.
+    ///\param hint An iterator at or near the expected result.
+    ///\param key  The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(iterator hint, key_parameter_t key)
+    {
+      return iterator(TSearch::lower_bound(lookup.begin(), lookup.end(), hint.ilookup, key, compare()));
+    }
+
     //*********************************************************************
     /// Inserts a value to the reference_flat_map.
     ///\param i_element The place to insert.
@@ -847,8 +912,75 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Gets the area of the lookup in which new values may be staged.
+    ///\param n Set to the maximum number of values that may be staged.
+    ///\return A pointer to the stage.
+    //*********************************************************************
+    value_type** get_stage(size_t& n)
+    {
+      n = __private_flat__::stage_size(lookup.size(), lookup.capacity());
+
+      return __private_flat__::stage_begin(lookup.data(), lookup.size(), lookup.capacity());
+    }
+
+    //*********************************************************************
+    /// Merges staged values into the reference_flat_map.
+    /// Values with keys that already exist are moved to the end of the stage.
+    ///\param p_stage   The stage.
+    ///\param count     The number of staged values.
+    ///\param is_sorted <b>true</b> if the staged values are already sorted.
+    ///\return The number of values merged.
+    //*********************************************************************
+    size_t merge_stage(value_type** p_stage, size_t count, bool is_sorted)
+    {
+      size_t size = lookup.size();
+
+      if (!is_sorted)
+      {
+        __private_flat__::sort_stage(p_stage, count, compare());
+      }
+
+      count = __private_flat__::unique_stage(lookup.data(), size, p_stage, count, compare());
+
+      lookup.resize(size + count);
+      __private_flat__::merge_stage(lookup.data(), size, p_stage, count, compare());
+
+      return count;
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, staging as many as will fit at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      while (first != last)
+      {
+        size_t n;
+        value_type** p_stage = get_stage(n);
+
+        if (n == 0)
+        {
+          // No free space, so insert directly.
+          insert(*first++);
+        }
+        else
+        {
+          size_t count = 0;
+
+          while ((first != last) && (count < n))
+          {
+            p_stage[count++] = etl::addressof(*first++);
+          }
+
+          merge_stage(p_stage, count, is_sorted);
+        }
+      }
+    }
+
     // Disable copy construction and assignment.
     ireference_flat_map(const ireference_flat_map&);
     ireference_flat_map& operator = (const ireference_flat_map&);
@@ -863,8 +995,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup reference_flat_map
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::ireference_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ireference_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename TKeyCompare, typename TSearch>
+  bool operator ==(const etl::ireference_flat_map<TKey, TMapped, TKeyCompare, TSearch>& lhs, const etl::ireference_flat_map<TKey, TMapped, TKeyCompare, TSearch>& rhs)
   {
     return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
   }
@@ -876,8 +1008,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup reference_flat_map
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::ireference_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ireference_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename TKeyCompare, typename TSearch>
+  bool operator !=(const etl::ireference_flat_map<TKey, TMapped, TKeyCompare, TSearch>& lhs, const etl::ireference_flat_map<TKey, TMapped, TKeyCompare, TSearch>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -887,11 +1019,12 @@ namespace etl
   ///\tparam TKey     The key type.
   ///\tparam TValue   The value type.
   ///\tparam TCompare The type to compare keys. Default = std::less<TKey>
+  ///\tparam TSearch  The search policy. Default = etl::binary_search_policy
   ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
   ///\ingroup reference_flat_map
   //***************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
-  class reference_flat_map : public ireference_flat_map<TKey, TValue, TCompare>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey>, typename TSearch = etl::binary_search_policy>
+  class reference_flat_map : public ireference_flat_map<TKey, TValue, TCompare, TSearch>
   {
   public:
 
@@ -901,7 +1034,7 @@ namespace etl
     /// Constructor.
     //*************************************************************************
     reference_flat_map()
-      : ireference_flat_map<TKey, TValue, TCompare>(lookup)
+      : ireference_flat_map<TKey, TValue, TCompare, TSearch>(lookup)
     {
     }
 
@@ -913,9 +1046,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     reference_flat_map(TIterator first, TIterator last)
-      : ireference_flat_map<TKey, TValue, TCompare>(lookup)
+      : ireference_flat_map<TKey, TValue, TCompare, TSearch>(lookup)
     {
-      ireference_flat_map<TKey, TValue, TCompare>::assign(first, last);
+      ireference_flat_map<TKey, TValue, TCompare, TSearch>::assign(first, last);
     }
 
     //*************************************************************************
@@ -923,7 +1056,7 @@ namespace etl
     //*************************************************************************
     ~reference_flat_map()
     {
-      ireference_flat_map<TKey, TValue, TCompare>::clear();
+      ireference_flat_map<TKey, TValue, TCompare, TSearch>::clear();
     }
 
     //*************************************************************************
@@ -933,7 +1066,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        ireference_flat_map<TKey, TValue, TCompare>::assign(rhs.cbegin(), rhs.cend());
+        ireference_flat_map<TKey, TValue, TCompare, TSearch>::assign(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -943,7 +1076,7 @@ namespace etl
 
     reference_flat_map(const reference_flat_map&);
 
-    typedef typename ireference_flat_map<TKey, TValue, TCompare>::value_type node_t;
+    typedef typename ireference_flat_map<TKey, TValue, TCompare, TSearch>::value_type node_t;
 
     // The vector that stores pointers to the nodes.
     etl::vector<node_t*, MAX_SIZE> lookup;
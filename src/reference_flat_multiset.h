@@ -40,6 +40,8 @@ SOFTWARE.
 #include "platform.h"
 #include "type_traits.h"
 #include "vector.h"
+#include "algorithm.h"
+#include "private/flat_merge.h"
 #include "pool.h"
 #include "error_handler.h"
 #include "exception.h"
@@ -91,6 +93,20 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  ///\ingroup reference_flat_multiset
+  /// Unsorted range exception.
+  //***************************************************************************
+  class flat_multiset_not_sorted : public flat_multiset_exception
+  {
+  public:
+
+    flat_multiset_not_sorted(string_type file_name, numeric_type line_number)
+      : flat_multiset_exception(ETL_ERROR_TEXT("flat_multiset:not sorted", ETL_FILE"D"), file_name, line_number)
+    {
+    }
+  };
+
   //***************************************************************************
   /// The base class for specifically sized reference_flat_multisets.
   /// Can be used as a reference type for all reference_flat_multisets containing a specific type.
@@ -312,6 +328,21 @@ namespace etl
 
     typedef typename etl::parameter_type<T>::type parameter_t;
 
+  private:
+
+    //*********************************************************************
+    /// How to compare staged elements.
+    //*********************************************************************
+    class compare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return TKeyCompare()(*lhs, *rhs);
+      }
+    };
+
   public:
 
     typedef std::reverse_iterator<iterator>       reverse_iterator;
@@ -443,10 +474,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -493,18 +521,32 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_multiset.
+    /// The values are sorted and merged with the existing elements in a single pass.
     /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by value, to the reference_flat_multiset.
+    /// The values are merged with the existing elements in a single pass.
+    /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_multiset_not_sorted if the values are not sorted,
+    /// which reads the range an extra time.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(etl::is_sorted(first, last, key_compare()), ETL_ERROR(flat_multiset_not_sorted));
+
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -773,8 +815,73 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Gets the area of the lookup in which new values may be staged.
+    ///\param n Set to the maximum number of values that may be staged.
+    ///\return A pointer to the stage.
+    //*********************************************************************
+    value_type** get_stage(size_t& n)
+    {
+      n = __private_flat__::stage_size(lookup.size(), lookup.capacity());
+
+      return __private_flat__::stage_begin(lookup.data(), lookup.size(), lookup.capacity());
+    }
+
+    //*********************************************************************
+    /// Merges staged values into the reference_flat_multiset.
+    /// Staged values are placed after existing equivalent values.
+    ///\param p_stage   The stage.
+    ///\param count     The number of staged values.
+    ///\param is_sorted <b>true</b> if the staged values are already sorted.
+    ///\return The number of values merged.
+    //*********************************************************************
+    size_t merge_stage(value_type** p_stage, size_t count, bool is_sorted)
+    {
+      size_t size = lookup.size();
+
+      if (!is_sorted)
+      {
+        __private_flat__::sort_stage(p_stage, count, compare());
+      }
+
+      lookup.resize(size + count);
+      __private_flat__::merge_stage(lookup.data(), size, p_stage, count, compare());
+
+      return count;
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, staging as many as will fit at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      while (first != last)
+      {
+        size_t n;
+        value_type** p_stage = get_stage(n);
+
+        if (n == 0)
+        {
+          // No free space, so insert directly.
+          insert(*first++);
+        }
+        else
+        {
+          size_t count = 0;
+
+          while ((first != last) && (count < n))
+          {
+            p_stage[count++] = etl::addressof(*first++);
+          }
+
+          merge_stage(p_stage, count, is_sorted);
+        }
+      }
+    }
+
     // Disable copy construction.
     ireference_flat_multiset(const ireference_flat_multiset&);
     ireference_flat_multiset& operator =(const ireference_flat_multiset&);
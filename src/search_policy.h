@@ -0,0 +1,296 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_SEARCH_POLICY__
+#define __ETL_SEARCH_POLICY__
+
+#include <stddef.h>
+#include <algorithm>
+#include <iterator>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup search_policy search_policy
+/// Search policies for the sorted lookups of the flat containers.
+/// Each policy supplies lower_bound and upper_bound over a random access range.
+/// The comparison object must accept (element, key) and (key, element).
+/// A hint is a position at or near the expected result; the end of the
+/// range is passed when none is available.
+///\ingroup utilities
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_search_policy__
+  {
+    //*************************************************************************
+    /// Elements before the lower bound.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    class before_lower_bound
+    {
+    public:
+
+      before_lower_bound(const TKey& key_, TCompare compare_)
+        : key(key_),
+          compare(compare_)
+      {
+      }
+
+      template <typename TElement>
+      bool operator ()(const TElement& element) const
+      {
+        return compare(element, key);
+      }
+
+    private:
+
+      const TKey& key;
+      TCompare    compare;
+    };
+
+    //*************************************************************************
+    /// Elements before the upper bound.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    class before_upper_bound
+    {
+    public:
+
+      before_upper_bound(const TKey& key_, TCompare compare_)
+        : key(key_),
+          compare(compare_)
+      {
+      }
+
+      template <typename TElement>
+      bool operator ()(const TElement& element) const
+      {
+        return !compare(key, element);
+      }
+
+    private:
+
+      const TKey& key;
+      TCompare    compare;
+    };
+
+    //*************************************************************************
+    /// Narrows [first, last] to a range containing the partition point,
+    /// galloping outwards from the hint in steps of 1, 2, 4, 8...
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate>
+    void gallop(TIterator& first, TIterator& last, TIterator hint, TPredicate before)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      difference_type step = 1;
+
+      if ((hint != last) && before(*hint))
+      {
+        // The result is after the hint.
+        first = hint + 1;
+
+        while (step < (last - first))
+        {
+          TIterator probe = first + step;
+
+          if (!before(*probe))
+          {
+            last = probe;
+            return;
+          }
+
+          first = probe + 1;
+          step *= 2;
+        }
+      }
+      else
+      {
+        // The result is at or before the hint.
+        last = hint;
+
+        while (step <= (last - first))
+        {
+          TIterator probe = last - step;
+
+          if (before(*probe))
+          {
+            first = probe + 1;
+            return;
+          }
+
+          last = probe;
+          step *= 2;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Narrows [first, last] to a range containing the partition point by
+    /// probing at the position estimated from the key values at each end.
+    /// Stops as soon as a probe fails to at least halve the range.
+    //*************************************************************************
+    template <typename TIterator, typename TKey, typename TCompare, typename TPredicate>
+    void interpolate(TIterator& first, TIterator& last, const TKey& key, TCompare compare, TPredicate before)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      while ((last - first) > 2)
+      {
+        difference_type size = last - first;
+
+        double low  = double(compare.key(*first));
+        double high = double(compare.key(*(last - 1)));
+
+        if (!(low < high))
+        {
+          return;
+        }
+
+        double fraction = (double(key) - low) / (high - low);
+
+        difference_type offset;
+
+        if (fraction <= 0.0)
+        {
+          offset = 0;
+        }
+        else if (fraction >= 1.0)
+        {
+          offset = size - 1;
+        }
+        else
+        {
+          offset = difference_type(fraction * double(size - 1));
+        }
+
+        TIterator probe = first + offset;
+
+        if (before(*probe))
+        {
+          first = probe + 1;
+        }
+        else
+        {
+          last = probe;
+        }
+
+        if ((2 * (last - first)) > size)
+        {
+          return;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Binary search.
+  /// O(logN). The hint is ignored.
+  ///\ingroup search_policy
+  //***************************************************************************
+  struct binary_search_policy
+  {
+    template <typename TIterator, typename TKey, typename TCompare>
+    static TIterator lower_bound(TIterator first, TIterator last, TIterator /*hint*/, const TKey& key, TCompare compare)
+    {
+      return std::lower_bound(first, last, key, compare);
+    }
+
+    template <typename TIterator, typename TKey, typename TCompare>
+    static TIterator upper_bound(TIterator first, TIterator last, TIterator /*hint*/, const TKey& key, TCompare compare)
+    {
+      return std::upper_bound(first, last, key, compare);
+    }
+  };
+
+  //***************************************************************************
+  /// Exponential search.
+  /// Gallops outwards from the hint, then binary searches the bracketed range.
+  /// O(logD), where D is the distance from the hint to the result.
+  /// Suits keys that are found near the previous result, or near the end when
+  /// no hint is given, such as increasing timestamps.
+  ///\ingroup search_policy
+  //***************************************************************************
+  struct exponential_search_policy
+  {
+    template <typename TIterator, typename TKey, typename TCompare>
+    static TIterator lower_bound(TIterator first, TIterator last, TIterator hint, const TKey& key, TCompare compare)
+    {
+      __private_search_policy__::gallop(first, last, hint, __private_search_policy__::before_lower_bound<TKey, TCompare>(key, compare));
+
+      return std::lower_bound(first, last, key, compare);
+    }
+
+    template <typename TIterator, typename TKey, typename TCompare>
+    static TIterator upper_bound(TIterator first, TIterator last, TIterator hint, const TKey& key, TCompare compare)
+    {
+      __private_search_policy__::gallop(first, last, hint, __private_search_policy__::before_upper_bound<TKey, TCompare>(key, compare));
+
+      return std::upper_bound(first, last, key, compare);
+    }
+  };
+
+  //***************************************************************************
+  /// Interpolation search for integral keys.
+  /// Probes where the key would be if the keys were uniformly distributed.
+  /// O(log(logN)) for uniform keys. Falls back to binary search as soon as a
+  /// probe fails to halve the range, so is never worse than O(logN).
+  /// The comparison object must also supply key(element). The hint is ignored.
+  ///\ingroup search_policy
+  //***************************************************************************
+  struct interpolation_search_policy
+  {
+    template <typename TIterator, typename TKey, typename TCompare>
+    static TIterator lower_bound(TIterator first, TIterator last, TIterator /*hint*/, const TKey& key, TCompare compare)
+    {
+      STATIC_ASSERT(etl::is_integral<TKey>::value, "Interpolation search requires an integral key");
+
+      __private_search_policy__::interpolate(first, last, key, compare, __private_search_policy__::before_lower_bound<TKey, TCompare>(key, compare));
+
+      return std::lower_bound(first, last, key, compare);
+    }
+
+    template <typename TIterator, typename TKey, typename TCompare>
+    static TIterator upper_bound(TIterator first, TIterator last, TIterator /*hint*/, const TKey& key, TCompare compare)
+    {
+      STATIC_ASSERT(etl::is_integral<TKey>::value, "Interpolation search requires an integral key");
+
+      __private_search_policy__::interpolate(first, last, key, compare, __private_search_policy__::before_upper_bound<TKey, TCompare>(key, compare));
+
+      return std::upper_bound(first, last, key, compare);
+    }
+  };
+}
+
+#endif
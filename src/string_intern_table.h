@@ -0,0 +1,391 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_STRING_INTERN_TABLE__
+#define __ETL_STRING_INTERN_TABLE__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "smallest.h"
+#include "power.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "fnv_1.h"
+#include "cstring.h"
+#include "string_view.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#define ETL_FILE "41"
+
+//*****************************************************************************
+///\defgroup string_intern_table string_intern_table
+/// A table of unique strings, each identified by a small integer.
+/// The characters of every string are stored, null terminated, one after
+/// the other in a single arena. An ID resolves to its string in O(1), and a
+/// string resolves to its ID through an open addressed hash table.
+/// IDs are allocated in order from zero and never change, so they may be used
+/// as keys or indexes in place of the strings.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup string_intern_table
+  /// Exception base for string_intern_table.
+  //***************************************************************************
+  class string_intern_table_exception : public etl::exception
+  {
+  public:
+
+    string_intern_table_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_intern_table
+  /// There is no room for another string, or for its characters.
+  //***************************************************************************
+  class string_intern_table_full : public etl::string_intern_table_exception
+  {
+  public:
+
+    string_intern_table_full(string_type file_name_, numeric_type line_number_)
+      : string_intern_table_exception(ETL_ERROR_TEXT("string_intern_table:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_intern_table
+  /// The ID is not in the table.
+  //***************************************************************************
+  class string_intern_table_out_of_bounds : public etl::string_intern_table_exception
+  {
+  public:
+
+    string_intern_table_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : string_intern_table_exception(ETL_ERROR_TEXT("string_intern_table:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_intern_table
+  /// A string intern table.
+  ///\tparam MAX_STRINGS The maximum number of strings.
+  ///\tparam MAX_BYTES   The size of the arena. Each string takes its length plus one.
+  //***************************************************************************
+  template <const size_t MAX_STRINGS, const size_t MAX_BYTES>
+  class string_intern_table
+  {
+  public:
+
+    STATIC_ASSERT(MAX_STRINGS > 0, "Zero strings");
+    STATIC_ASSERT(MAX_BYTES > 0, "Zero bytes");
+
+    /// The smallest type that holds any ID.
+    typedef typename etl::smallest_uint_for_value<MAX_STRINGS>::type id_type;
+
+    static const size_t npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    string_intern_table()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Removes all of the strings.
+    /// IDs that were issued before are no longer valid.
+    //*************************************************************************
+    void clear()
+    {
+      string_count = 0;
+      offsets[0]   = 0;
+
+      for (size_t i = 0; i < SLOTS; ++i)
+      {
+        slots[i] = EMPTY;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the ID of a string, adding it if it is not already in the table.
+    /// If asserts or exceptions are enabled, emits string_intern_table_full if
+    /// the string is new and there is no room for it.
+    ///\return The ID, or npos if the string could not be added.
+    //*************************************************************************
+    size_t intern(const char* text, size_t length)
+    {
+      const uint32_t hash = hash_of(text, length);
+      size_t slot = hash & (SLOTS - 1);
+
+      while (slots[slot] != EMPTY)
+      {
+        const size_t id = slots[slot];
+
+        if ((hashes[id] == hash) && is_equal(id, text, length))
+        {
+          return id;
+        }
+
+        slot = (slot + 1) & (SLOTS - 1);
+      }
+
+      const bool is_full = (string_count == MAX_STRINGS) || ((length + 1) > (MAX_BYTES - offsets[string_count]));
+
+      ETL_ASSERT(!is_full, ETL_ERROR(string_intern_table_full));
+
+      if (is_full)
+      {
+        return npos;
+      }
+
+      // Append to the arena.
+      const size_t id    = string_count++;
+      char*        p_end = arena + offsets[id];
+
+      memcpy(p_end, text, length);
+      p_end[length] = 0;
+
+      offsets[id + 1] = offset_type(offsets[id] + length + 1);
+      hashes[id]   = hash;
+      slots[slot]  = id_type(id);
+
+      return id;
+    }
+
+    //*************************************************************************
+    /// Gets the ID of a null terminated string, adding it if required.
+    //*************************************************************************
+    size_t intern(const char* text)
+    {
+      return intern(text, strlen(text));
+    }
+
+    //*************************************************************************
+    /// Gets the ID of a string, adding it if required.
+    //*************************************************************************
+    size_t intern(const etl::istring& text)
+    {
+      return intern(text.data(), text.size());
+    }
+
+    //*************************************************************************
+    /// Gets the ID of a string view, adding it if required.
+    //*************************************************************************
+    size_t intern(const etl::string_view& text)
+    {
+      return intern(text.data(), text.size());
+    }
+
+    //*************************************************************************
+    /// Finds the ID of a string, without adding it.
+    ///\return The ID, or npos if the string is not in the table.
+    //*************************************************************************
+    size_t find(const char* text, size_t length) const
+    {
+      const uint32_t hash = hash_of(text, length);
+      size_t slot = hash & (SLOTS - 1);
+
+      while (slots[slot] != EMPTY)
+      {
+        const size_t id = slots[slot];
+
+        if ((hashes[id] == hash) && is_equal(id, text, length))
+        {
+          return id;
+        }
+
+        slot = (slot + 1) & (SLOTS - 1);
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the ID of a null terminated string, without adding it.
+    //*************************************************************************
+    size_t find(const char* text) const
+    {
+      return find(text, strlen(text));
+    }
+
+    //*************************************************************************
+    /// Finds the ID of a string, without adding it.
+    //*************************************************************************
+    size_t find(const etl::istring& text) const
+    {
+      return find(text.data(), text.size());
+    }
+
+    //*************************************************************************
+    /// Finds the ID of a string view, without adding it.
+    //*************************************************************************
+    size_t find(const etl::string_view& text) const
+    {
+      return find(text.data(), text.size());
+    }
+
+    //*************************************************************************
+    /// Checks if a string is in the table.
+    //*************************************************************************
+    bool contains(const etl::string_view& text) const
+    {
+      return find(text.data(), text.size()) != npos;
+    }
+
+    //*************************************************************************
+    /// Gets the string for an ID.
+    /// If asserts or exceptions are enabled, emits string_intern_table_out_of_bounds
+    /// if the ID is not in the table.
+    //*************************************************************************
+    etl::string_view view(size_t id) const
+    {
+      ETL_ASSERT(id < string_count, ETL_ERROR(string_intern_table_out_of_bounds));
+
+      return etl::string_view(arena + offsets[id], size_t(offsets[id + 1] - offsets[id]) - 1);
+    }
+
+    //*************************************************************************
+    /// Gets the null terminated string for an ID.
+    //*************************************************************************
+    const char* c_str(size_t id) const
+    {
+      ETL_ASSERT(id < string_count, ETL_ERROR(string_intern_table_out_of_bounds));
+
+      return arena + offsets[id];
+    }
+
+    //*************************************************************************
+    /// Gets the string for an ID.
+    //*************************************************************************
+    etl::string_view operator [](size_t id) const
+    {
+      return view(id);
+    }
+
+    //*************************************************************************
+    /// The number of strings.
+    //*************************************************************************
+    size_t size() const
+    {
+      return string_count;
+    }
+
+    //*************************************************************************
+    /// Checks if the table is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return string_count == 0;
+    }
+
+    //*************************************************************************
+    /// Checks if the table holds the maximum number of strings.
+    //*************************************************************************
+    bool full() const
+    {
+      return string_count == MAX_STRINGS;
+    }
+
+    //*************************************************************************
+    /// The maximum number of strings.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_STRINGS;
+    }
+
+    //*************************************************************************
+    /// The number of bytes used in the arena, including the terminators.
+    //*************************************************************************
+    size_t bytes_used() const
+    {
+      return offsets[string_count];
+    }
+
+    //*************************************************************************
+    /// The number of bytes free in the arena.
+    //*************************************************************************
+    size_t bytes_available() const
+    {
+      return MAX_BYTES - offsets[string_count];
+    }
+
+  private:
+
+    // Twice as many slots as strings, so that probes are short.
+    static const size_t SLOTS = etl::power_of_2_round_up<2 * MAX_STRINGS>::value;
+
+    // An empty slot. MAX_STRINGS is never an ID.
+    static const id_type EMPTY = id_type(MAX_STRINGS);
+
+    typedef typename etl::smallest_uint_for_value<MAX_BYTES>::type offset_type;
+
+    //*************************************************************************
+    /// The hash of a string.
+    //*************************************************************************
+    static uint32_t hash_of(const char* text, size_t length)
+    {
+      return etl::fnv_1a_32(text, text + length).value();
+    }
+
+    //*************************************************************************
+    /// Compares a string with the one for an ID.
+    //*************************************************************************
+    bool is_equal(size_t id, const char* text, size_t length) const
+    {
+      return (size_t(offsets[id + 1] - offsets[id]) == (length + 1)) && (memcmp(arena + offsets[id], text, length) == 0);
+    }
+
+    size_t      string_count;
+    offset_type offsets[MAX_STRINGS + 1]; ///< The start of each string, and the end of the last.
+    uint32_t    hashes[MAX_STRINGS];   ///< The hash of each string, to skip most comparisons.
+    id_type     slots[SLOTS];          ///< The open addressed hash table of IDs.
+    char        arena[MAX_BYTES];
+  };
+
+  template <const size_t MAX_STRINGS, const size_t MAX_BYTES>
+  const size_t string_intern_table<MAX_STRINGS, MAX_BYTES>::npos;
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,818 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_STRING_SEARCHER__
+#define __ETL_STRING_SEARCHER__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#define ETL_FILE "40"
+
+//*****************************************************************************
+///\defgroup string_searcher string_searcher
+/// Searchers that precompute their tables once from a pattern, or a set of
+/// patterns, and may then be applied to any number of texts.
+/// The tables are held in the searcher, with a size fixed at compile time.
+/// A text may be an etl::ibasic_string, an etl::basic_string_view or a
+/// pointer range.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup string_searcher
+  /// Exception base for string searchers.
+  //***************************************************************************
+  class string_searcher_exception : public etl::exception
+  {
+  public:
+
+    string_searcher_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_searcher
+  /// The pattern does not fit in the searcher.
+  //***************************************************************************
+  class string_searcher_full : public etl::string_searcher_exception
+  {
+  public:
+
+    string_searcher_full(string_type file_name_, numeric_type line_number_)
+      : string_searcher_exception(ETL_ERROR_TEXT("string_searcher:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_searcher
+  /// An empty pattern was added to a multiple pattern searcher.
+  //***************************************************************************
+  class string_searcher_empty : public etl::string_searcher_exception
+  {
+  public:
+
+    string_searcher_empty(string_type file_name_, numeric_type line_number_)
+      : string_searcher_exception(ETL_ERROR_TEXT("string_searcher:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_searcher
+  /// Boyer-Moore-Horspool single pattern searcher.
+  /// The pattern is copied into the searcher, and a table of 256 shifts is
+  /// built from it. Characters wider than a byte share the table entries of
+  /// their low byte, which keeps every shift safe, if sometimes shorter.
+  /// Sublinear on average. Long patterns and large alphabets, such as log
+  /// text, give the longest shifts.
+  ///\tparam TChar    The character type.
+  ///\tparam MAX_SIZE The maximum length of the pattern.
+  //***************************************************************************
+  template <typename TChar, const size_t MAX_SIZE>
+  class boyer_moore_horspool_searcher
+  {
+  public:
+
+    STATIC_ASSERT(MAX_SIZE > 0, "Zero length pattern");
+
+    typedef TChar  value_type;
+    typedef size_t size_type;
+
+    static const size_t npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// Constructor. An empty pattern matches at the start of any text.
+    //*************************************************************************
+    boyer_moore_horspool_searcher()
+      : length(0)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor from a pointer and length.
+    /// If asserts or exceptions are enabled, emits string_searcher_full if the
+    /// pattern is longer than MAX_SIZE, otherwise the pattern is truncated.
+    //*************************************************************************
+    boyer_moore_horspool_searcher(const TChar* pattern_, size_t length_)
+    {
+      assign(pattern_, length_);
+    }
+
+    //*************************************************************************
+    /// Constructor from a string.
+    //*************************************************************************
+    explicit boyer_moore_horspool_searcher(const etl::ibasic_string<TChar>& pattern_)
+    {
+      assign(pattern_.data(), pattern_.size());
+    }
+
+    //*************************************************************************
+    /// Constructor from a string view.
+    //*************************************************************************
+    explicit boyer_moore_horspool_searcher(const etl::basic_string_view<TChar>& pattern_)
+    {
+      assign(pattern_.data(), pattern_.size());
+    }
+
+    //*************************************************************************
+    /// Sets the pattern and rebuilds the shift table.
+    /// If asserts or exceptions are enabled, emits string_searcher_full if the
+    /// pattern is longer than MAX_SIZE, otherwise the pattern is truncated.
+    //*************************************************************************
+    void assign(const TChar* pattern_, size_t length_)
+    {
+      ETL_ASSERT(length_ <= MAX_SIZE, ETL_ERROR(string_searcher_full));
+
+      length = (length_ > MAX_SIZE) ? MAX_SIZE : length_;
+
+      for (size_t i = 0; i < length; ++i)
+      {
+        pattern[i] = pattern_[i];
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// The length of the pattern.
+    //*************************************************************************
+    size_t size() const
+    {
+      return length;
+    }
+
+    //*************************************************************************
+    /// The maximum length of the pattern.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The pattern.
+    //*************************************************************************
+    etl::basic_string_view<TChar> view() const
+    {
+      return etl::basic_string_view<TChar>(pattern, length);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the pattern in [first, last).
+    ///\return A pointer to the start of the match, or last if not found.
+    //*************************************************************************
+    const TChar* search(const TChar* first, const TChar* last) const
+    {
+      if (size_t(last - first) < length)
+      {
+        return last;
+      }
+
+      if (length == 0)
+      {
+        return first;
+      }
+
+      const size_t last_index = length - 1;
+      const TChar  back       = pattern[last_index];
+      const TChar* last_start = last - length;
+
+      while (first <= last_start)
+      {
+        const TChar c = first[last_index];
+
+        if ((c == back) && equal(first, last_index))
+        {
+          return first;
+        }
+
+        first += shifts[bucket(c)];
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the pattern in [first, last), in the
+    /// form used by std::search.
+    ///\return The matching range, or [last, last) if not found.
+    //*************************************************************************
+    std::pair<const TChar*, const TChar*> operator ()(const TChar* first, const TChar* last) const
+    {
+      const TChar* match = search(first, last);
+
+      return std::pair<const TChar*, const TChar*>(match, (match == last) ? last : match + length);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the pattern in a string, starting at
+    /// the position.
+    ///\return The position of the match, or npos if not found.
+    //*************************************************************************
+    size_t find(const etl::ibasic_string<TChar>& text, size_t position = 0) const
+    {
+      return find(text.data(), text.size(), position);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the pattern in a string view, starting
+    /// at the position.
+    ///\return The position of the match, or npos if not found.
+    //*************************************************************************
+    size_t find(const etl::basic_string_view<TChar>& text, size_t position = 0) const
+    {
+      return find(text.data(), text.size(), position);
+    }
+
+  private:
+
+    typedef typename etl::smallest_uint_for_value<MAX_SIZE>::type shift_t;
+
+    //*************************************************************************
+    /// The shift table entry for a character.
+    //*************************************************************************
+    static size_t bucket(TChar c)
+    {
+      return size_t(typename etl::make_unsigned<TChar>::type(c)) & 0xFF;
+    }
+
+    //*************************************************************************
+    /// Builds the shift table.
+    /// Later characters give smaller shifts, so a shared entry keeps the
+    /// smallest.
+    //*************************************************************************
+    void initialise()
+    {
+      const shift_t default_shift = shift_t((length == 0) ? 1 : length);
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        shifts[i] = default_shift;
+      }
+
+      for (size_t i = 0; (i + 1) < length; ++i)
+      {
+        shifts[bucket(pattern[i])] = shift_t(length - 1 - i);
+      }
+    }
+
+    //*************************************************************************
+    /// Compares the first n characters of the pattern.
+    //*************************************************************************
+    bool equal(const TChar* text, size_t n) const
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        if (!(text[i] == pattern[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the pattern in text[position, size).
+    //*************************************************************************
+    size_t find(const TChar* text, size_t text_size, size_t position) const
+    {
+      if (position > text_size)
+      {
+        return npos;
+      }
+
+      const TChar* last  = text + text_size;
+      const TChar* match = search(text + position, last);
+
+      return ((match == last) && (length != 0)) ? npos : size_t(match - text);
+    }
+
+    shift_t shifts[256]; ///< The shift for each character, by low byte.
+    TChar   pattern[MAX_SIZE];
+    size_t  length;
+  };
+
+  template <typename TChar, const size_t MAX_SIZE>
+  const size_t boyer_moore_horspool_searcher<TChar, MAX_SIZE>::npos;
+
+  //***************************************************************************
+  ///\ingroup string_searcher
+  /// Aho-Corasick multiple pattern searcher.
+  /// The patterns are stored as a trie of up to MAX_STATES states, including
+  /// the root, with a failure link for each state. Every occurrence of every
+  /// pattern is found in one pass over the text, in O(N + matches) time for a
+  /// fixed alphabet.
+  /// Each state stores one character and a handful of indexes, sized to fit
+  /// MAX_STATES. A set of patterns needs at most one state per character,
+  /// plus the root, and fewer where patterns share a prefix.
+  /// The failure links are built once, after the patterns are added, on the
+  /// first search or by build(). Call build() before sharing a searcher
+  /// between threads, as a const search may otherwise build them.
+  ///\tparam TChar      The character type.
+  ///\tparam MAX_STATES The maximum number of trie states.
+  //***************************************************************************
+  template <typename TChar, const size_t MAX_STATES>
+  class aho_corasick_searcher
+  {
+  public:
+
+    STATIC_ASSERT(MAX_STATES > 0, "No states");
+
+    typedef TChar  value_type;
+    typedef size_t size_type;
+
+    static const size_t npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// An occurrence of a pattern.
+    //*************************************************************************
+    struct match
+    {
+      const TChar* position; ///< The start of the match, or the end of the text if there is none.
+      size_t       pattern;  ///< The index of the pattern, as returned by add, or npos.
+      size_t       length;   ///< The length of the pattern.
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    aho_corasick_searcher()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Removes all of the patterns.
+    //*************************************************************************
+    void clear()
+    {
+      states_used   = 1;
+      pattern_count = 0;
+
+      states[ROOT].character    = TChar(0);
+      states[ROOT].first_child  = NONE;
+      states[ROOT].next_sibling = NONE;
+      states[ROOT].fail         = ROOT;
+      states[ROOT].output       = NONE;
+      states[ROOT].pattern      = NONE;
+      states[ROOT].depth        = 0;
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        start_bits[i] = 0;
+      }
+
+      is_built = true;
+    }
+
+    //*************************************************************************
+    /// Adds a pattern. The failure links are rebuilt by the next search or
+    /// build(), so adding N patterns costs one build, not N.
+    /// If asserts or exceptions are enabled, emits string_searcher_empty for an
+    /// empty pattern and string_searcher_full if there are not enough free
+    /// states. The searcher is unchanged if the pattern is not added.
+    ///\return The index of the pattern, or npos if it was not added.
+    /// Adding a pattern a second time returns its original index.
+    //*************************************************************************
+    size_t add(const TChar* pattern, size_t length)
+    {
+      ETL_ASSERT(length != 0, ETL_ERROR(string_searcher_empty));
+
+      if (length == 0)
+      {
+        return npos;
+      }
+
+      // Follow the existing prefix.
+      index_t state = ROOT;
+      size_t  i     = 0;
+
+      while (i < length)
+      {
+        const index_t next = child(state, pattern[i]);
+
+        if (next == NONE)
+        {
+          break;
+        }
+
+        state = next;
+        ++i;
+      }
+
+      const bool is_full = ((length - i) > (MAX_STATES - states_used));
+
+      ETL_ASSERT(!is_full, ETL_ERROR(string_searcher_full));
+
+      if (is_full)
+      {
+        return npos;
+      }
+
+      // Add the rest.
+      while (i < length)
+      {
+        state_t& new_state = states[states_used];
+
+        new_state.character    = pattern[i];
+        new_state.first_child  = NONE;
+        new_state.next_sibling = states[state].first_child;
+        new_state.pattern      = NONE;
+        new_state.depth        = index_t(i + 1);
+
+        states[state].first_child = index_t(states_used);
+        state = index_t(states_used);
+
+        ++states_used;
+        ++i;
+      }
+
+      if (states[state].pattern == NONE)
+      {
+        states[state].pattern = index_t(pattern_count++);
+        is_built = false;
+      }
+
+      return states[state].pattern;
+    }
+
+    //*************************************************************************
+    /// Adds a pattern from a string.
+    //*************************************************************************
+    size_t add(const etl::ibasic_string<TChar>& pattern)
+    {
+      return add(pattern.data(), pattern.size());
+    }
+
+    //*************************************************************************
+    /// Adds a pattern from a string view.
+    //*************************************************************************
+    size_t add(const etl::basic_string_view<TChar>& pattern)
+    {
+      return add(pattern.data(), pattern.size());
+    }
+
+    //*************************************************************************
+    /// Builds the failure links, if patterns have been added since they were
+    /// last built.
+    //*************************************************************************
+    void build() const
+    {
+      if (!is_built)
+      {
+        build_links();
+        is_built = true;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of patterns.
+    //*************************************************************************
+    size_t size() const
+    {
+      return pattern_count;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no patterns.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pattern_count == 0;
+    }
+
+    //*************************************************************************
+    /// The number of states in use, including the root.
+    //*************************************************************************
+    size_t states_size() const
+    {
+      return states_used;
+    }
+
+    //*************************************************************************
+    /// The maximum number of states.
+    //*************************************************************************
+    size_t max_states() const
+    {
+      return MAX_STATES;
+    }
+
+    //*************************************************************************
+    /// Finds the occurrence that ends first in [first, last).
+    /// Of the patterns that end at the same position, the longest is returned.
+    ///\return The match. If there is none, position is last and pattern is npos.
+    //*************************************************************************
+    match search(const TChar* first, const TChar* last) const
+    {
+      build();
+
+      index_t state = ROOT;
+
+      for (const TChar* p = first; p != last; ++p)
+      {
+        if (state == ROOT)
+        {
+          p = skip_to_start(p, last);
+
+          if (p == last)
+          {
+            break;
+          }
+        }
+
+        state = next_state(state, *p);
+
+        index_t found = (states[state].pattern != NONE) ? state : states[state].output;
+
+        if (found != NONE)
+        {
+          return make_match(p + 1, found);
+        }
+      }
+
+      match result = { last, npos, 0 };
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Finds the occurrence that ends first in a string.
+    //*************************************************************************
+    match search(const etl::ibasic_string<TChar>& text) const
+    {
+      return search(text.data(), text.data() + text.size());
+    }
+
+    //*************************************************************************
+    /// Finds the occurrence that ends first in a string view.
+    //*************************************************************************
+    match search(const etl::basic_string_view<TChar>& text) const
+    {
+      return search(text.data(), text.data() + text.size());
+    }
+
+    //*************************************************************************
+    /// Calls the function for every occurrence of every pattern in
+    /// [first, last), including overlapping occurrences, in order of their
+    /// end position. The function is called as function(const match&).
+    ///\return The number of occurrences.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_match(const TChar* first, const TChar* last, TFunction function) const
+    {
+      build();
+
+      size_t count = 0;
+
+      index_t state = ROOT;
+
+      for (const TChar* p = first; p != last; ++p)
+      {
+        if (state == ROOT)
+        {
+          p = skip_to_start(p, last);
+
+          if (p == last)
+          {
+            break;
+          }
+        }
+
+        state = next_state(state, *p);
+
+        index_t found = (states[state].pattern != NONE) ? state : states[state].output;
+
+        while (found != NONE)
+        {
+          function(make_match(p + 1, found));
+          ++count;
+
+          found = states[found].output;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Calls the function for every occurrence in a string.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_match(const etl::ibasic_string<TChar>& text, TFunction function) const
+    {
+      return for_each_match(text.data(), text.data() + text.size(), function);
+    }
+
+    //*************************************************************************
+    /// Calls the function for every occurrence in a string view.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_match(const etl::basic_string_view<TChar>& text, TFunction function) const
+    {
+      return for_each_match(text.data(), text.data() + text.size(), function);
+    }
+
+  private:
+
+    // Large enough for MAX_STATES, which is used as 'none'.
+    typedef typename etl::smallest_uint_for_value<MAX_STATES>::type index_t;
+
+    static const index_t ROOT = 0;
+    static const index_t NONE = index_t(MAX_STATES);
+
+    struct state_t
+    {
+      TChar   character;    ///< The character that leads to this state.
+      index_t first_child;
+      index_t next_sibling;
+      index_t fail;         ///< The state of the longest proper suffix that is in the trie.
+      index_t output;       ///< The nearest state on the failure chain that ends a pattern.
+      index_t pattern;      ///< The pattern that ends at this state.
+      index_t depth;
+      index_t queue_next;   ///< Used while building the links.
+    };
+
+    //*************************************************************************
+    /// Finds the child of a state for a character.
+    //*************************************************************************
+    index_t child(index_t state, TChar c) const
+    {
+      index_t i = states[state].first_child;
+
+      while ((i != NONE) && !(states[i].character == c))
+      {
+        i = states[i].next_sibling;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Skips characters that cannot start a pattern.
+    //*************************************************************************
+    const TChar* skip_to_start(const TChar* p, const TChar* last) const
+    {
+      while ((p != last) && !is_start(*p))
+      {
+        ++p;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Checks if a character may start a pattern.
+    /// Characters are tested by their low byte, so this may give false positives.
+    //*************************************************************************
+    bool is_start(TChar c) const
+    {
+      const size_t b = size_t(typename etl::make_unsigned<TChar>::type(c)) & 0xFF;
+
+      return ((start_bits[b >> 5] >> (b & 31)) & 1) != 0;
+    }
+
+    //*************************************************************************
+    /// The state after reading a character.
+    //*************************************************************************
+    index_t next_state(index_t state, TChar c) const
+    {
+      while (true)
+      {
+        const index_t next = child(state, c);
+
+        if (next != NONE)
+        {
+          return next;
+        }
+
+        if (state == ROOT)
+        {
+          return ROOT;
+        }
+
+        state = states[state].fail;
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a match for the pattern ending at 'end'.
+    //*************************************************************************
+    match make_match(const TChar* end, index_t state) const
+    {
+      match result = { end - states[state].depth, states[state].pattern, states[state].depth };
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Builds the failure and output links, in breadth first order.
+    /// The queue is threaded through the states.
+    //*************************************************************************
+    void build_links() const
+    {
+      for (size_t i = 0; i < 8; ++i)
+      {
+        start_bits[i] = 0;
+      }
+
+      for (index_t s = states[ROOT].first_child; s != NONE; s = states[s].next_sibling)
+      {
+        const size_t b = size_t(typename etl::make_unsigned<TChar>::type(states[s].character)) & 0xFF;
+
+        start_bits[b >> 5] |= uint32_t(1) << (b & 31);
+      }
+
+      index_t head = ROOT;
+      index_t tail = ROOT;
+
+      states[ROOT].queue_next = NONE;
+
+      while (head != NONE)
+      {
+        const index_t parent = head;
+
+        for (index_t s = states[parent].first_child; s != NONE; s = states[s].next_sibling)
+        {
+          state_t& state = states[s];
+
+          // The longest proper suffix that is in the trie.
+          index_t fail = ROOT;
+
+          if (parent != ROOT)
+          {
+            fail = next_state(states[parent].fail, state.character);
+          }
+
+          state.fail   = fail;
+          state.output = (states[fail].pattern != NONE) ? fail : states[fail].output;
+
+          state.queue_next = NONE;
+          states[tail].queue_next = s;
+          tail = s;
+        }
+
+        head = states[parent].queue_next;
+      }
+    }
+
+    // The links and start characters are built lazily by the const searches.
+    mutable state_t  states[MAX_STATES];
+    mutable uint32_t start_bits[8]; ///< The characters that start a pattern, by low byte.
+    mutable bool     is_built;      ///< Are the links up to date with the patterns?
+    size_t           states_used;
+    size_t           pattern_count;
+  };
+
+  template <typename TChar, const size_t MAX_STATES>
+  const size_t aho_corasick_searcher<TChar, MAX_STATES>::npos;
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,827 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_STRING_VIEW__
+#define __ETL_STRING_VIEW__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+#include <algorithm>
+
+#include "platform.h"
+#include "char_traits.h"
+#include "basic_string.h"
+#include "hash.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "private/string_search.h"
+
+#if defined(ETL_COMPILER_MICROSOFT)
+  #undef min
+#endif
+
+#define ETL_FILE "38"
+
+//*****************************************************************************
+///\defgroup string_view string_view
+/// A non-owning, read only view of a contiguous sequence of characters.
+/// The viewed characters must outlive the view.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup string_view
+  /// Exception base for string_view
+  //***************************************************************************
+  class string_view_exception : public etl::exception
+  {
+  public:
+
+    string_view_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_view
+  /// Index or position out of bounds.
+  //***************************************************************************
+  class string_view_bounds : public etl::string_view_exception
+  {
+  public:
+
+    string_view_bounds(string_type file_name_, numeric_type line_number_)
+      : string_view_exception(ETL_ERROR_TEXT("string_view:bounds", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_view
+  /// A view of a sequence of characters of type T.
+  /// Views of an etl::ibasic_string are invalidated by any change to its size.
+  //***************************************************************************
+  template <typename T>
+  class basic_string_view
+  {
+  public:
+
+    typedef T                                     value_type;
+    typedef const T&                              reference;
+    typedef const T&                              const_reference;
+    typedef const T*                              pointer;
+    typedef const T*                              const_pointer;
+    typedef const T*                              iterator;
+    typedef const T*                              const_iterator;
+    typedef std::reverse_iterator<const_iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                size_type;
+
+    static const size_t npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// Default constructor. An empty view.
+    //*************************************************************************
+    basic_string_view()
+      : p_begin(0),
+        view_size(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    //*************************************************************************
+    basic_string_view(const T* text)
+      : p_begin(text),
+        view_size(etl::char_traits<T>::length(text))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from text and length.
+    //*************************************************************************
+    basic_string_view(const T* text, size_t length_)
+      : p_begin(text),
+        view_size(length_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a range.
+    /// A template, so that only a pair of pointers selects it, and a literal
+    /// zero length still selects the text and length constructor.
+    //*************************************************************************
+    template <typename TChar>
+    basic_string_view(TChar* first, TChar* last)
+      : p_begin(first),
+        view_size(last - first)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a string.
+    //*************************************************************************
+    basic_string_view(const etl::ibasic_string<T>& text)
+      : p_begin(text.data()),
+        view_size(text.size())
+    {
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the view.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the view.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the view.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_begin + view_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the view.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_begin + view_size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the view.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the view.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end of the view.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end of the view.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns the number of characters in the view.
+    //*************************************************************************
+    size_t size() const
+    {
+      return view_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of characters in the view.
+    //*************************************************************************
+    size_t length() const
+    {
+      return view_size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return view_size == 0;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the indexed character.
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return p_begin[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the indexed character.
+    /// If asserts or exceptions are enabled, emits an etl::string_view_bounds
+    /// if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < size(), ETL_ERROR(string_view_bounds));
+
+      return p_begin[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first character.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return p_begin[0];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last character.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return p_begin[view_size - 1];
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the first character.
+    /// The characters are not necessarily null terminated.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    /// Moves the start of the view forward by n characters.
+    //*************************************************************************
+    void remove_prefix(size_t n)
+    {
+      n = std::min(n, view_size);
+
+      p_begin += n;
+      view_size -= n;
+    }
+
+    //*************************************************************************
+    /// Moves the end of the view back by n characters.
+    //*************************************************************************
+    void remove_suffix(size_t n)
+    {
+      view_size -= std::min(n, view_size);
+    }
+
+    //*************************************************************************
+    /// Swaps with another view.
+    //*************************************************************************
+    void swap(basic_string_view& other)
+    {
+      std::swap(p_begin, other.p_begin);
+      std::swap(view_size, other.view_size);
+    }
+
+    //*************************************************************************
+    /// Copies up to count characters, from position, to the destination.
+    /// If asserts or exceptions are enabled, emits an etl::string_view_bounds
+    /// if the position is out of range.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    size_t copy(T* destination, size_t count, size_t position = 0) const
+    {
+      ETL_ASSERT(position <= size(), ETL_ERROR(string_view_bounds));
+
+      count = std::min(count, view_size - position);
+
+      std::copy(p_begin + position, p_begin + position + count, destination);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns a view of a part of this view.
+    /// If asserts or exceptions are enabled, emits an etl::string_view_bounds
+    /// if the position is out of range.
+    //*************************************************************************
+    basic_string_view substr(size_t position = 0, size_t count = npos) const
+    {
+      ETL_ASSERT(position <= size(), ETL_ERROR(string_view_bounds));
+
+      return basic_string_view(p_begin + position, std::min(count, view_size - position));
+    }
+
+    //*************************************************************************
+    /// Compares with another view.
+    ///\return Less than zero, zero or greater than zero, as for strcmp.
+    //*************************************************************************
+    int compare(basic_string_view other) const
+    {
+      int result = etl::char_traits<T>::compare(p_begin, other.p_begin, std::min(view_size, other.view_size));
+
+      if (result == 0)
+      {
+        result = (view_size < other.view_size) ? -1 : ((view_size > other.view_size) ? 1 : 0);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Compares a part of this view with another view.
+    //*************************************************************************
+    int compare(size_t position, size_t count, basic_string_view other) const
+    {
+      return substr(position, count).compare(other);
+    }
+
+    //*************************************************************************
+    /// Compares a part of this view with a part of another view.
+    //*************************************************************************
+    int compare(size_t position, size_t count, basic_string_view other, size_t subposition, size_t subcount) const
+    {
+      return substr(position, count).compare(other.substr(subposition, subcount));
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view starts with the other view.
+    //*************************************************************************
+    bool starts_with(basic_string_view other) const
+    {
+      return (view_size >= other.view_size) && (etl::char_traits<T>::compare(p_begin, other.p_begin, other.view_size) == 0);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view starts with the character.
+    //*************************************************************************
+    bool starts_with(T c) const
+    {
+      return !empty() && (front() == c);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view ends with the other view.
+    //*************************************************************************
+    bool ends_with(basic_string_view other) const
+    {
+      return (view_size >= other.view_size) && (etl::char_traits<T>::compare(end() - other.view_size, other.p_begin, other.view_size) == 0);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view ends with the character.
+    //*************************************************************************
+    bool ends_with(T c) const
+    {
+      return !empty() && (back() == c);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the view, starting at position.
+    //*************************************************************************
+    size_t find(basic_string_view view, size_t position = 0) const
+    {
+      if ((position > view_size) || (view.view_size > (view_size - position)))
+      {
+        return npos;
+      }
+
+      if (view.empty())
+      {
+        return position;
+      }
+
+      const_pointer p_match = __private_basic_string__::search(p_begin + position, end(), view.p_begin, view.view_size);
+
+      return (p_match == end()) ? npos : size_t(p_match - p_begin);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the character, starting at position.
+    //*************************************************************************
+    size_t find(T c, size_t position = 0) const
+    {
+      return find(basic_string_view(&c, 1), position);
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the view, starting at or before position.
+    //*************************************************************************
+    size_t rfind(basic_string_view view, size_t position = npos) const
+    {
+      if (view.view_size > view_size)
+      {
+        return npos;
+      }
+
+      position = std::min(position, view_size - view.view_size);
+
+      if (view.empty())
+      {
+        return position;
+      }
+
+      const_pointer p_last  = p_begin + position + view.view_size;
+      const_pointer p_match = __private_basic_string__::search_last(p_begin, p_last, view.p_begin, view.view_size);
+
+      return (p_match == p_last) ? npos : size_t(p_match - p_begin);
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the character, starting at or before position.
+    //*************************************************************************
+    size_t rfind(T c, size_t position = npos) const
+    {
+      return rfind(basic_string_view(&c, 1), position);
+    }
+
+    //*************************************************************************
+    /// Finds the first character that is in the view, starting at position.
+    //*************************************************************************
+    size_t find_first_of(basic_string_view view, size_t position = 0) const
+    {
+      const __private_basic_string__::char_set<T> chars(view.p_begin, view.view_size);
+
+      for (size_t i = position; i < view_size; ++i)
+      {
+        if (chars.contains(p_begin[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the character, starting at position.
+    //*************************************************************************
+    size_t find_first_of(T c, size_t position = 0) const
+    {
+      return find(c, position);
+    }
+
+    //*************************************************************************
+    /// Finds the last character that is in the view, starting at or before position.
+    //*************************************************************************
+    size_t find_last_of(basic_string_view view, size_t position = npos) const
+    {
+      if (empty())
+      {
+        return npos;
+      }
+
+      const __private_basic_string__::char_set<T> chars(view.p_begin, view.view_size);
+
+      size_t i = std::min(position, view_size - 1) + 1;
+
+      while (i-- != 0)
+      {
+        if (chars.contains(p_begin[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the character, starting at or before position.
+    //*************************************************************************
+    size_t find_last_of(T c, size_t position = npos) const
+    {
+      return rfind(c, position);
+    }
+
+    //*************************************************************************
+    /// Finds the first character that is not in the view, starting at position.
+    //*************************************************************************
+    size_t find_first_not_of(basic_string_view view, size_t position = 0) const
+    {
+      const __private_basic_string__::char_set<T> chars(view.p_begin, view.view_size);
+
+      for (size_t i = position; i < view_size; ++i)
+      {
+        if (!chars.contains(p_begin[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first character that is not c, starting at position.
+    //*************************************************************************
+    size_t find_first_not_of(T c, size_t position = 0) const
+    {
+      return find_first_not_of(basic_string_view(&c, 1), position);
+    }
+
+    //*************************************************************************
+    /// Finds the last character that is not in the view, starting at or before position.
+    //*************************************************************************
+    size_t find_last_not_of(basic_string_view view, size_t position = npos) const
+    {
+      if (empty())
+      {
+        return npos;
+      }
+
+      const __private_basic_string__::char_set<T> chars(view.p_begin, view.view_size);
+
+      size_t i = std::min(position, view_size - 1) + 1;
+
+      while (i-- != 0)
+      {
+        if (!chars.contains(p_begin[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last character that is not c, starting at or before position.
+    //*************************************************************************
+    size_t find_last_not_of(T c, size_t position = npos) const
+    {
+      return find_last_not_of(basic_string_view(&c, 1), position);
+    }
+
+  private:
+
+    const_pointer p_begin;
+    size_t        view_size;
+  };
+
+  template <typename T>
+  const size_t basic_string_view<T>::npos;
+
+  typedef etl::basic_string_view<char>     string_view;
+  typedef etl::basic_string_view<wchar_t>  wstring_view;
+  typedef etl::basic_string_view<char16_t> u16string_view;
+  typedef etl::basic_string_view<char32_t> u32string_view;
+
+  //***************************************************************************
+  /// Swaps two views.
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  void swap(etl::basic_string_view<T>& lhs, etl::basic_string_view<T>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  namespace __private_string_view__
+  {
+    //*************************************************************************
+    /// Stops T being deduced from a parameter, so that strings and pointers
+    /// may be implicitly converted to views in the comparison operators.
+    //*************************************************************************
+    template <typename T>
+    struct non_deduced
+    {
+      typedef etl::basic_string_view<T> type;
+    };
+  }
+
+  //***************************************************************************
+  /// Equal operator.
+  /// Either side may also be an etl::ibasic_string or a null terminated text.
+  ///\return <b>true</b> if the views are equal, otherwise <b>false</b>
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(etl::basic_string_view<T> lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) == 0;
+  }
+
+  template <typename T>
+  bool operator ==(etl::basic_string_view<T> lhs, typename __private_string_view__::non_deduced<T>::type rhs)
+  {
+    return lhs.compare(rhs) == 0;
+  }
+
+  template <typename T>
+  bool operator ==(typename __private_string_view__::non_deduced<T>::type lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) == 0;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  /// Either side may also be an etl::ibasic_string or a null terminated text.
+  ///\return <b>true</b> if the views are not equal, otherwise <b>false</b>
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(etl::basic_string_view<T> lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) != 0;
+  }
+
+  template <typename T>
+  bool operator !=(etl::basic_string_view<T> lhs, typename __private_string_view__::non_deduced<T>::type rhs)
+  {
+    return lhs.compare(rhs) != 0;
+  }
+
+  template <typename T>
+  bool operator !=(typename __private_string_view__::non_deduced<T>::type lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) != 0;
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  /// Either side may also be an etl::ibasic_string or a null terminated text.
+  ///\return <b>true</b> if the first is lexicographically less than the second, otherwise <b>false</b>
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  bool operator <(etl::basic_string_view<T> lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  template <typename T>
+  bool operator <(etl::basic_string_view<T> lhs, typename __private_string_view__::non_deduced<T>::type rhs)
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  template <typename T>
+  bool operator <(typename __private_string_view__::non_deduced<T>::type lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  //***************************************************************************
+  /// Less than or equal operator.
+  /// Either side may also be an etl::ibasic_string or a null terminated text.
+  ///\return <b>true</b> if the first is lexicographically less than or equal to the second, otherwise <b>false</b>
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  bool operator <=(etl::basic_string_view<T> lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) <= 0;
+  }
+
+  template <typename T>
+  bool operator <=(etl::basic_string_view<T> lhs, typename __private_string_view__::non_deduced<T>::type rhs)
+  {
+    return lhs.compare(rhs) <= 0;
+  }
+
+  template <typename T>
+  bool operator <=(typename __private_string_view__::non_deduced<T>::type lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) <= 0;
+  }
+
+  //***************************************************************************
+  /// Greater than operator.
+  /// Either side may also be an etl::ibasic_string or a null terminated text.
+  ///\return <b>true</b> if the first is lexicographically greater than the second, otherwise <b>false</b>
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  bool operator >(etl::basic_string_view<T> lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) > 0;
+  }
+
+  template <typename T>
+  bool operator >(etl::basic_string_view<T> lhs, typename __private_string_view__::non_deduced<T>::type rhs)
+  {
+    return lhs.compare(rhs) > 0;
+  }
+
+  template <typename T>
+  bool operator >(typename __private_string_view__::non_deduced<T>::type lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) > 0;
+  }
+
+  //***************************************************************************
+  /// Greater than or equal operator.
+  /// Either side may also be an etl::ibasic_string or a null terminated text.
+  ///\return <b>true</b> if the first is lexicographically greater than or equal to the second, otherwise <b>false</b>
+  ///\ingroup string_view
+  //***************************************************************************
+  template <typename T>
+  bool operator >=(etl::basic_string_view<T> lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) >= 0;
+  }
+
+  template <typename T>
+  bool operator >=(etl::basic_string_view<T> lhs, typename __private_string_view__::non_deduced<T>::type rhs)
+  {
+    return lhs.compare(rhs) >= 0;
+  }
+
+  template <typename T>
+  bool operator >=(typename __private_string_view__::non_deduced<T>::type lhs, etl::basic_string_view<T> rhs)
+  {
+    return lhs.compare(rhs) >= 0;
+  }
+
+  //*************************************************************************
+  /// Hash functions.
+  /// A view hashes to the same value as a string with the same characters.
+  //*************************************************************************
+#if ETL_8BIT_SUPPORT
+  template <>
+  struct hash<etl::string_view>
+  {
+    size_t operator()(const etl::string_view& text) const
+    {
+      return etl::__private_hash__::generic_hash<>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                   reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+    }
+  };
+
+  template <>
+  struct hash<etl::wstring_view>
+  {
+    size_t operator()(const etl::wstring_view& text) const
+    {
+      return etl::__private_hash__::generic_hash<>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                   reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+    }
+  };
+
+  template <>
+  struct hash<etl::u16string_view>
+  {
+    size_t operator()(const etl::u16string_view& text) const
+    {
+      return etl::__private_hash__::generic_hash<>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                   reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+    }
+  };
+
+  template <>
+  struct hash<etl::u32string_view>
+  {
+    size_t operator()(const etl::u32string_view& text) const
+    {
+      return etl::__private_hash__::generic_hash<>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                   reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+    }
+  };
+#endif
+}
+
+#if defined(ETL_COMPILER_MICROSOFT)
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#undef ETL_FILE
+
+#endif
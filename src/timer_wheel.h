@@ -0,0 +1,467 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_TIMER_WHEEL__
+#define __ETL_TIMER_WHEEL__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "intrusive_links.h"
+#include "intrusive_list.h"
+#include "cyclic_value.h"
+#include "function.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#undef ETL_FILE
+#define ETL_FILE "36"
+
+//*****************************************************************************
+///\defgroup timer_wheel timer_wheel
+/// A hierarchical timer wheel with the number of levels and slots defined at
+/// compile time. Scheduling and cancelling a timer are O(1).
+///
+/// Each level is a ring of slots, with a cursor that follows the current
+/// time. A slot of level 0 covers one tick and a slot of level N covers
+/// SLOTS^N ticks. A timer is placed in the lowest level whose range covers
+/// its delay. When the cursor of a level wraps, the current slot of the
+/// level above is cascaded down, redistributing its timers to lower levels.
+/// The timers are intrusive and are owned by the caller.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for timer_wheel exceptions.
+  ///\ingroup timer_wheel
+  //***************************************************************************
+  class timer_wheel_exception : public exception
+  {
+  public:
+
+    timer_wheel_exception(string_type what, string_type file_name, numeric_type line_number)
+      : exception(what, file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a delay is too long for the wheel.
+  ///\ingroup timer_wheel
+  //***************************************************************************
+  class timer_wheel_range : public etl::timer_wheel_exception
+  {
+  public:
+
+    timer_wheel_range(string_type file_name, numeric_type line_number)
+      : timer_wheel_exception(ETL_ERROR_TEXT("timer_wheel:range", ETL_FILE"A"), file_name, line_number)
+    {
+    }
+  };
+
+  class timer_wheel_timer;
+
+  /// The type of the callback called when a timer expires.
+  typedef etl::ifunction<etl::timer_wheel_timer&> timer_wheel_callback;
+
+  //***************************************************************************
+  /// A timer for a timer_wheel.
+  /// May be used as a member or a base class of the object to time.
+  ///\ingroup timer_wheel
+  //***************************************************************************
+  class timer_wheel_timer : public etl::bidirectional_link<0>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param callback_ The callback to call when the timer expires.
+    //*************************************************************************
+    explicit timer_wheel_timer(etl::timer_wheel_callback& callback_)
+      : p_callback(&callback_),
+        p_slot(nullptr),
+        expiry_time(0)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Sets the callback to call when the timer expires.
+    //*************************************************************************
+    void set_callback(etl::timer_wheel_callback& callback_)
+    {
+      p_callback = &callback_;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the timer is scheduled.
+    //*************************************************************************
+    bool is_active() const
+    {
+      return p_slot != nullptr;
+    }
+
+    //*************************************************************************
+    /// Gets the time at which the timer expires, if active.
+    //*************************************************************************
+    uint32_t expiry() const
+    {
+      return expiry_time;
+    }
+
+  private:
+
+    friend class itimer_wheel;
+
+    typedef etl::intrusive_list<timer_wheel_timer, etl::bidirectional_link<0> > slot_t;
+
+    // Disable copy construction and assignment.
+    timer_wheel_timer(const timer_wheel_timer&);
+    timer_wheel_timer& operator =(const timer_wheel_timer&);
+
+    etl::timer_wheel_callback* p_callback;  ///< The callback to call when the timer expires.
+    slot_t*                    p_slot;      ///< The slot that holds the timer, or nullptr if not active.
+    uint32_t                   expiry_time; ///< The time at which the timer expires.
+  };
+
+  //***************************************************************************
+  ///\ingroup timer_wheel
+  ///\brief This is the base for all timer wheels.
+  ///\details Normally a reference to this type will be taken from a derived timer_wheel.
+  ///\code
+  /// etl::timer_wheel<6, 4> myWheel;
+  /// etl::itimer_wheel& iWheel = myWheel;
+  ///\endcode
+  /// \warning This timer wheel cannot be used for concurrent access from multiple threads.
+  //***************************************************************************
+  class itimer_wheel
+  {
+  public:
+
+    typedef etl::timer_wheel_timer timer_type;
+    typedef timer_type::slot_t     slot_t;
+    typedef etl::cyclic_value<size_t> cursor_t;
+
+    //*************************************************************************
+    /// Schedules the timer to expire after 'delay' ticks.
+    /// A delay of zero expires at the next tick.
+    /// A timer that is already active is rescheduled.
+    /// If asserts or exceptions are enabled, throws an etl::timer_wheel_range
+    /// if the delay is longer than max_delay().
+    ///\param timer The timer to schedule.
+    ///\param delay The number of ticks until the timer expires.
+    //*************************************************************************
+    void schedule(timer_type& timer, uint32_t delay)
+    {
+      ETL_ASSERT(delay <= max_delay(), ETL_ERROR(timer_wheel_range));
+
+      cancel(timer);
+
+      timer.expiry_time = current_time + ((delay == 0) ? 1 : delay);
+      insert(timer);
+      ++active_count;
+    }
+
+    //*************************************************************************
+    /// Cancels the timer. Does nothing if the timer is not active.
+    ///\param timer The timer to cancel.
+    //*************************************************************************
+    void cancel(timer_type& timer)
+    {
+      if (timer.p_slot != nullptr)
+      {
+        timer.p_slot->erase(slot_t::iterator(timer));
+        timer.p_slot = nullptr;
+        --active_count;
+      }
+    }
+
+    //*************************************************************************
+    /// Advances the time, calling the callbacks of the timers that expire.
+    /// Callbacks may schedule or cancel any timer.
+    ///\param ticks The number of ticks to advance.
+    //*************************************************************************
+    void advance(uint32_t ticks)
+    {
+      while (ticks > 0)
+      {
+        if (active_count == 0)
+        {
+          // Nothing to expire, so jump straight to the end.
+          set_time(current_time + ticks);
+          return;
+        }
+
+        tick();
+        --ticks;
+      }
+    }
+
+    //*************************************************************************
+    /// Cancels all of the timers.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0; i < (LEVELS * SLOTS); ++i)
+      {
+        slot_t& slot = p_slots[i];
+
+        while (!slot.empty())
+        {
+          timer_type& timer = slot.front();
+          slot.pop_front();
+          timer.p_slot = nullptr;
+        }
+      }
+
+      active_count = 0;
+    }
+
+    //*************************************************************************
+    /// Gets the number of ticks since the wheel was created.
+    /// Wraps at 2^32.
+    //*************************************************************************
+    uint32_t time() const
+    {
+      return current_time;
+    }
+
+    //*************************************************************************
+    /// Gets the number of active timers.
+    //*************************************************************************
+    size_t size() const
+    {
+      return active_count;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no active timers.
+    //*************************************************************************
+    bool empty() const
+    {
+      return active_count == 0;
+    }
+
+    //*************************************************************************
+    /// Gets the longest delay that may be scheduled.
+    //*************************************************************************
+    uint32_t max_delay() const
+    {
+      return MAX_DELAY;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    itimer_wheel(slot_t* p_slots_, cursor_t* p_cursors_, size_t slot_bits_, size_t levels_)
+      : p_slots(p_slots_),
+        p_cursors(p_cursors_),
+        SLOT_BITS(slot_bits_),
+        SLOTS(size_t(1) << slot_bits_),
+        LEVELS(levels_),
+        MAX_DELAY(((slot_bits_ * levels_) >= 32) ? 0xFFFFFFFFUL : uint32_t((uint32_t(1) << (slot_bits_ * levels_)) - 1)),
+        current_time(0),
+        active_count(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the range of the cursors.
+    /// Called from the derived class, once the cursors have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t level = 0; level < LEVELS; ++level)
+      {
+        p_cursors[level].set(0, SLOTS - 1);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Places the timer in the lowest level whose range covers it.
+    //*************************************************************************
+    void insert(timer_type& timer)
+    {
+      const uint32_t delta = timer.expiry_time - current_time;
+
+      size_t level = 0;
+      size_t shift = 0;
+
+      while ((level < (LEVELS - 1)) && ((uint64_t(delta) >> (shift + SLOT_BITS)) != 0))
+      {
+        ++level;
+        shift += SLOT_BITS;
+      }
+
+      slot_t& slot = p_slots[(level * SLOTS) + ((timer.expiry_time >> shift) & (SLOTS - 1))];
+
+      slot.push_back(timer);
+      timer.p_slot = &slot;
+    }
+
+    //*************************************************************************
+    /// Advances the time by one tick.
+    //*************************************************************************
+    void tick()
+    {
+      ++current_time;
+
+      // Move the cursors. When a level wraps, the level above moves on and
+      // its current slot is cascaded down.
+      if (++p_cursors[0] == 0)
+      {
+        for (size_t level = 1; level < LEVELS; ++level)
+        {
+          ++p_cursors[level];
+          cascade(p_slots[(level * SLOTS) + p_cursors[level]]);
+
+          if (p_cursors[level] != 0)
+          {
+            break;
+          }
+        }
+      }
+
+      // Expire the current slot of level 0.
+      slot_t& slot = p_slots[p_cursors[0]];
+
+      while (!slot.empty())
+      {
+        timer_type& timer = slot.front();
+        slot.pop_front();
+        timer.p_slot = nullptr;
+        --active_count;
+
+        (*timer.p_callback)(timer);
+      }
+    }
+
+    //*************************************************************************
+    /// Redistributes the timers of the slot to the lower levels.
+    //*************************************************************************
+    void cascade(slot_t& slot)
+    {
+      while (!slot.empty())
+      {
+        timer_type& timer = slot.front();
+        slot.pop_front();
+        insert(timer);
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the time and the cursors to match, when there are no timers.
+    //*************************************************************************
+    void set_time(uint32_t time_)
+    {
+      current_time = time_;
+
+      size_t shift = 0;
+
+      for (size_t level = 0; level < LEVELS; ++level)
+      {
+        p_cursors[level] = size_t((uint64_t(current_time) >> shift) & (SLOTS - 1));
+        shift += SLOT_BITS;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    itimer_wheel(const itimer_wheel&);
+    itimer_wheel& operator =(const itimer_wheel&);
+
+    slot_t*   p_slots;      ///< The slots, level by level.
+    cursor_t* p_cursors;    ///< The current slot of each level.
+
+    const size_t   SLOT_BITS;
+    const size_t   SLOTS;
+    const size_t   LEVELS;
+    const uint32_t MAX_DELAY;
+
+    uint32_t current_time;  ///< The number of ticks since creation.
+    size_t   active_count;  ///< The number of active timers.
+  };
+
+  //***************************************************************************
+  ///\ingroup timer_wheel
+  /// A hierarchical timer wheel.
+  /// The longest delay is 2^(SLOT_BITS * LEVELS) - 1 ticks.
+  ///\tparam SLOT_BITS The number of slots in each level, as a power of 2.
+  ///\tparam LEVELS    The number of levels.
+  //***************************************************************************
+  template <const size_t SLOT_BITS_ = 6, const size_t LEVELS_ = 4>
+  class timer_wheel : public etl::itimer_wheel
+  {
+  public:
+
+    STATIC_ASSERT((SLOT_BITS_ > 0) && (LEVELS_ > 0), "The wheel must have at least one level of two slots");
+    STATIC_ASSERT((SLOT_BITS_ * LEVELS_) <= 32, "The range of the wheel must be no more than 32 bits");
+
+    static const size_t SLOT_BITS = SLOT_BITS_;
+    static const size_t SLOTS     = size_t(1) << SLOT_BITS_;
+    static const size_t LEVELS    = LEVELS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    timer_wheel()
+      : itimer_wheel(slots, cursors, SLOT_BITS_, LEVELS_)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Cancels all of the timers.
+    //*************************************************************************
+    ~timer_wheel()
+    {
+      clear();
+    }
+
+  private:
+
+    slot_t   slots[SLOTS * LEVELS_];
+    cursor_t cursors[LEVELS_];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
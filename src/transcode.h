@@ -0,0 +1,625 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_TRANSCODE__
+#define __ETL_TRANSCODE__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "enum_type.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "private/algorithm_simd.h"
+
+//*****************************************************************************
+///\defgroup transcode transcode
+/// Conversion between UTF-8, UTF-16 and UTF-32 strings.
+/// The encoding follows from the size of the character type. One byte is
+/// UTF-8, two bytes is UTF-16 and four bytes is UTF-32. So etl::string,
+/// etl::u16string, etl::u32string and etl::wstring may all be converted,
+/// in any direction.
+/// The source is validated as it is converted. Overlong UTF-8 sequences,
+/// unpaired surrogates and values above U+10FFFF are rejected.
+/// The output is appended to the destination. Conversion stops at the first
+/// invalid sequence, or before the first code point that does not fit, so a
+/// code point is never split.
+/// Runs of ASCII are converted 16 bytes at a time, with SSE2 or AVX2 where
+/// available, or with 64 bit words otherwise.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The result status of transcode.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_status
+  {
+    enum enum_type
+    {
+      ok,
+      invalid_sequence,
+      truncated
+    };
+
+    ETL_DECLARE_ENUM_TYPE(transcode_status, uint_least8_t)
+    ETL_ENUM_TYPE(ok,               "ok")
+    ETL_ENUM_TYPE(invalid_sequence, "invalid_sequence")
+    ETL_ENUM_TYPE(truncated,        "truncated")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of transcode.
+  /// 'ptr' is the first source character that was not converted. It is the
+  /// end of the source if the status is 'ok'.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TChar>
+  struct transcode_result
+  {
+    transcode_result(const TChar* ptr_, etl::transcode_status status_)
+      : ptr(ptr_),
+        status(status_)
+    {
+    }
+
+    const TChar*          ptr;
+    etl::transcode_status status;
+  };
+
+  namespace __private_transcode__
+  {
+    //*************************************************************************
+    /// The unsigned code unit for a character type.
+    //*************************************************************************
+    template <typename TChar>
+    struct code_unit
+    {
+      typedef typename etl::conditional<sizeof(TChar) == 1, uint8_t,
+              typename etl::conditional<sizeof(TChar) == 2, uint16_t, uint32_t>::type>::type type;
+    };
+
+    //*************************************************************************
+    /// Selects the encoding by the size of the character.
+    //*************************************************************************
+    template <const size_t SIZE>
+    struct encoding_tag
+    {
+    };
+
+    typedef encoding_tag<1> utf8_tag;
+    typedef encoding_tag<2> utf16_tag;
+    typedef encoding_tag<4> utf32_tag;
+
+    //*************************************************************************
+    /// The maximum code units in a code point.
+    //*************************************************************************
+    template <typename TChar>
+    struct max_units
+    {
+      static const size_t value = (sizeof(TChar) == 1) ? 4 : ((sizeof(TChar) == 2) ? 2 : 1);
+    };
+
+    //*************************************************************************
+    /// Decodes a UTF-8 code point.
+    ///\return The character after the code point, or 0 if the sequence is invalid.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* decode(const TChar* p, const TChar* last, uint32_t& code_point, utf8_tag)
+    {
+      const uint32_t lead = uint8_t(*p);
+
+      if (lead < 0x80)
+      {
+        code_point = lead;
+        return p + 1;
+      }
+
+      size_t   length;
+      uint32_t minimum;
+
+      if ((lead & 0xE0) == 0xC0)
+      {
+        length     = 2;
+        minimum    = 0x80;
+        code_point = lead & 0x1F;
+      }
+      else if ((lead & 0xF0) == 0xE0)
+      {
+        length     = 3;
+        minimum    = 0x800;
+        code_point = lead & 0x0F;
+      }
+      else if ((lead & 0xF8) == 0xF0)
+      {
+        length     = 4;
+        minimum    = 0x10000;
+        code_point = lead & 0x07;
+      }
+      else
+      {
+        return 0;
+      }
+
+      if (size_t(last - p) < length)
+      {
+        return 0;
+      }
+
+      for (size_t i = 1; i < length; ++i)
+      {
+        const uint32_t trail = uint8_t(p[i]);
+
+        if ((trail & 0xC0) != 0x80)
+        {
+          return 0;
+        }
+
+        code_point = (code_point << 6) | (trail & 0x3F);
+      }
+
+      // Overlong, surrogate or out of range.
+      if ((code_point < minimum) || ((code_point >= 0xD800) && (code_point <= 0xDFFF)) || (code_point > 0x10FFFF))
+      {
+        return 0;
+      }
+
+      return p + length;
+    }
+
+    //*************************************************************************
+    /// Decodes a UTF-16 code point.
+    ///\return The character after the code point, or 0 if the sequence is invalid.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* decode(const TChar* p, const TChar* last, uint32_t& code_point, utf16_tag)
+    {
+      const uint32_t lead = uint16_t(*p);
+
+      if ((lead < 0xD800) || (lead > 0xDFFF))
+      {
+        code_point = lead;
+        return p + 1;
+      }
+
+      if ((lead > 0xDBFF) || ((last - p) < 2))
+      {
+        return 0;
+      }
+
+      const uint32_t trail = uint16_t(p[1]);
+
+      if ((trail < 0xDC00) || (trail > 0xDFFF))
+      {
+        return 0;
+      }
+
+      code_point = 0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00);
+
+      return p + 2;
+    }
+
+    //*************************************************************************
+    /// Decodes a UTF-32 code point.
+    ///\return The character after the code point, or 0 if it is invalid.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* decode(const TChar* p, const TChar* /*last*/, uint32_t& code_point, utf32_tag)
+    {
+      code_point = uint32_t(*p);
+
+      if (((code_point >= 0xD800) && (code_point <= 0xDFFF)) || (code_point > 0x10FFFF))
+      {
+        return 0;
+      }
+
+      return p + 1;
+    }
+
+    //*************************************************************************
+    /// The number of UTF-8 code units for a code point.
+    //*************************************************************************
+    inline size_t encoded_length(uint32_t code_point, utf8_tag)
+    {
+      return (code_point < 0x80) ? 1 : ((code_point < 0x800) ? 2 : ((code_point < 0x10000) ? 3 : 4));
+    }
+
+    //*************************************************************************
+    /// The number of UTF-16 code units for a code point.
+    //*************************************************************************
+    inline size_t encoded_length(uint32_t code_point, utf16_tag)
+    {
+      return (code_point < 0x10000) ? 1 : 2;
+    }
+
+    //*************************************************************************
+    /// The number of UTF-32 code units for a code point.
+    //*************************************************************************
+    inline size_t encoded_length(uint32_t /*code_point*/, utf32_tag)
+    {
+      return 1;
+    }
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-8.
+    //*************************************************************************
+    template <typename TChar>
+    TChar* encode(uint32_t code_point, TChar* p, utf8_tag)
+    {
+      if (code_point < 0x80)
+      {
+        *p++ = TChar(code_point);
+      }
+      else if (code_point < 0x800)
+      {
+        *p++ = TChar(0xC0 | (code_point >> 6));
+        *p++ = TChar(0x80 | (code_point & 0x3F));
+      }
+      else if (code_point < 0x10000)
+      {
+        *p++ = TChar(0xE0 | (code_point >> 12));
+        *p++ = TChar(0x80 | ((code_point >> 6) & 0x3F));
+        *p++ = TChar(0x80 | (code_point & 0x3F));
+      }
+      else
+      {
+        *p++ = TChar(0xF0 | (code_point >> 18));
+        *p++ = TChar(0x80 | ((code_point >> 12) & 0x3F));
+        *p++ = TChar(0x80 | ((code_point >> 6) & 0x3F));
+        *p++ = TChar(0x80 | (code_point & 0x3F));
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-16.
+    //*************************************************************************
+    template <typename TChar>
+    TChar* encode(uint32_t code_point, TChar* p, utf16_tag)
+    {
+      if (code_point < 0x10000)
+      {
+        *p++ = TChar(code_point);
+      }
+      else
+      {
+        code_point -= 0x10000;
+        *p++ = TChar(0xD800 + (code_point >> 10));
+        *p++ = TChar(0xDC00 + (code_point & 0x3FF));
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-32.
+    //*************************************************************************
+    template <typename TChar>
+    TChar* encode(uint32_t code_point, TChar* p, utf32_tag)
+    {
+      *p++ = TChar(code_point);
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Copies ASCII characters, one at a time.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    template <typename TFrom, typename TTo>
+    size_t copy_ascii_scalar(const TFrom* source, size_t n, TTo* destination)
+    {
+      typedef typename code_unit<TFrom>::type unit_t;
+
+      size_t i = 0;
+
+      while ((i < n) && (unit_t(source[i]) < 0x80))
+      {
+        destination[i] = TTo(source[i]);
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Copies ASCII characters from UTF-8, 16 bytes at a time.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    template <typename TFrom, typename TTo>
+    size_t copy_ascii(const TFrom* source, size_t n, TTo* destination, utf8_tag)
+    {
+      size_t i = 0;
+
+#if defined(ETL_SIMD)
+      const __m128i zero = _mm_setzero_si128();
+
+      while ((i + 16) <= n)
+      {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+
+        if (_mm_movemask_epi8(bytes) != 0)
+        {
+          break;
+        }
+
+        if (sizeof(TTo) == 1)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), bytes);
+        }
+        else if (sizeof(TTo) == 2)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),     _mm_unpacklo_epi8(bytes, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        }
+        else
+        {
+          const __m128i low  = _mm_unpacklo_epi8(bytes, zero);
+          const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),      _mm_unpacklo_epi16(low, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 4),  _mm_unpackhi_epi16(low, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 8),  _mm_unpacklo_epi16(high, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 12), _mm_unpackhi_epi16(high, zero));
+        }
+
+        i += 16;
+      }
+#else
+      while ((i + 16) <= n)
+      {
+        uint64_t words[2];
+        memcpy(words, source + i, 16);
+
+        if (((words[0] | words[1]) & 0x8080808080808080ULL) != 0)
+        {
+          break;
+        }
+
+        for (size_t j = 0; j < 16; ++j)
+        {
+          destination[i + j] = TTo(source[i + j]);
+        }
+
+        i += 16;
+      }
+#endif
+
+      return i + copy_ascii_scalar(source + i, n - i, destination + i);
+    }
+
+    //*************************************************************************
+    /// Copies ASCII characters from UTF-16, 16 bytes at a time.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    template <typename TFrom, typename TTo>
+    size_t copy_ascii(const TFrom* source, size_t n, TTo* destination, utf16_tag)
+    {
+      size_t i = 0;
+
+#if defined(ETL_SIMD)
+      if (sizeof(TTo) == 1)
+      {
+        const __m128i not_ascii = _mm_set1_epi16(int16_t(0xFF80));
+
+        while ((i + 16) <= n)
+        {
+          const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+          const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 8));
+
+          if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(low, high), not_ascii), _mm_setzero_si128())) != 0xFFFF)
+          {
+            break;
+          }
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+
+          i += 16;
+        }
+      }
+#endif
+
+      return i + copy_ascii_scalar(source + i, n - i, destination + i);
+    }
+
+    //*************************************************************************
+    /// Copies ASCII characters from UTF-32, 16 bytes at a time.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    template <typename TFrom, typename TTo>
+    size_t copy_ascii(const TFrom* source, size_t n, TTo* destination, utf32_tag)
+    {
+      size_t i = 0;
+
+#if defined(ETL_SIMD)
+      if (sizeof(TTo) == 1)
+      {
+        const __m128i not_ascii = _mm_set1_epi32(int32_t(0xFFFFFF80));
+
+        while ((i + 16) <= n)
+        {
+          const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+          const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 4));
+          const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 8));
+          const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 12));
+
+          const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+
+          if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, not_ascii), _mm_setzero_si128())) != 0xFFFF)
+          {
+            break;
+          }
+
+          // All values are below 0x80, so the signed packs do not saturate.
+          const __m128i low  = _mm_packs_epi32(a, b);
+          const __m128i high = _mm_packs_epi32(c, d);
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+
+          i += 16;
+        }
+      }
+#endif
+
+      return i + copy_ascii_scalar(source + i, n - i, destination + i);
+    }
+
+    //*************************************************************************
+    /// Converts [first, last) and appends it to the destination.
+    //*************************************************************************
+    template <typename TFrom, typename TTo>
+    etl::transcode_result<TFrom> transcode(etl::ibasic_string<TTo>& destination, const TFrom* first, const TFrom* last)
+    {
+      typedef encoding_tag<sizeof(TFrom)> from_tag;
+      typedef encoding_tag<sizeof(TTo)>   to_tag;
+
+      typedef typename code_unit<TFrom>::type unit_t;
+
+      // Converted in blocks, appended to the destination as each fills.
+      static const size_t BUFFER_SIZE = 64;
+
+      TTo buffer[BUFFER_SIZE];
+
+      size_t space = destination.available();
+
+      etl::transcode_status status = etl::transcode_status::ok;
+
+      while ((first != last) && (status == etl::transcode_status::ok))
+      {
+        if (space == 0)
+        {
+          status = etl::transcode_status::truncated;
+          break;
+        }
+
+        TTo*             p_out     = buffer;
+        const TTo* const p_out_end = buffer + ((space < BUFFER_SIZE) ? space : BUFFER_SIZE);
+
+        // Fill the block.
+        while ((first != last) && (p_out != p_out_end))
+        {
+          if (unit_t(*first) < 0x80)
+          {
+            const size_t copied = copy_ascii(first, std::min(size_t(last - first), size_t(p_out_end - p_out)), p_out, from_tag());
+
+            first += copied;
+            p_out += copied;
+          }
+          else
+          {
+            uint32_t code_point;
+
+            const TFrom* next = decode(first, last, code_point, from_tag());
+
+            if (next == 0)
+            {
+              status = etl::transcode_status::invalid_sequence;
+              break;
+            }
+
+            const size_t length = encoded_length(code_point, to_tag());
+
+            if (length > size_t(p_out_end - p_out))
+            {
+              // Either the destination is full, or the next block will take it.
+              if ((size_t(p_out - buffer) + length) > space)
+              {
+                status = etl::transcode_status::truncated;
+              }
+
+              break;
+            }
+
+            p_out = encode(code_point, p_out, to_tag());
+            first = next;
+          }
+        }
+
+        const size_t count = size_t(p_out - buffer);
+
+        if (count != 0)
+        {
+          destination.append(buffer, count);
+          space -= count;
+        }
+      }
+
+      return etl::transcode_result<TFrom>(first, status);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts the characters in [first, last) and appends them to the string.
+  ///\param destination The string to append to.
+  ///\param first       The first source character.
+  ///\param last        One past the last source character.
+  ///\return The first source character not converted, and the status.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TFrom, typename TTo>
+  etl::transcode_result<TFrom> transcode(etl::ibasic_string<TTo>& destination, const TFrom* first, const TFrom* last)
+  {
+    STATIC_ASSERT((sizeof(TFrom) == 1) || (sizeof(TFrom) == 2) || (sizeof(TFrom) == 4), "Unsupported source character size");
+    STATIC_ASSERT((sizeof(TTo) == 1) || (sizeof(TTo) == 2) || (sizeof(TTo) == 4), "Unsupported destination character size");
+
+    return __private_transcode__::transcode(destination, first, last);
+  }
+
+  //***************************************************************************
+  /// Converts a string and appends it to another.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TFrom, typename TTo>
+  etl::transcode_result<TFrom> transcode(etl::ibasic_string<TTo>& destination, const etl::ibasic_string<TFrom>& source)
+  {
+    return etl::transcode(destination, source.data(), source.data() + source.size());
+  }
+
+  //***************************************************************************
+  /// Converts a string view and appends it to a string.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TFrom, typename TTo>
+  etl::transcode_result<TFrom> transcode(etl::ibasic_string<TTo>& destination, const etl::basic_string_view<TFrom>& source)
+  {
+    return etl::transcode(destination, source.data(), source.data() + source.size());
+  }
+}
+
+#endif
@@ -290,6 +290,17 @@ namespace etl
   template <typename T> struct is_trivially_copy_assignable : etl::is_pod<T> {};
 #endif
 
+  /// is_trivially_relocatable
+  /// A type is trivially relocatable if moving an object to new storage with a
+  /// raw memory copy, and then abandoning the original without destroying it, is
+  /// equivalent to copy constructing the new object and destroying the original.
+  /// Defaults to types that are both trivially copy constructible and trivially destructible.
+  /// Specialise for user types that are relocatable but not trivial, such as types
+  /// that own an external resource through a pointer, but never point into themselves.
+  ///\ingroup type_traits
+  template <typename T> struct is_trivially_relocatable : etl::integral_constant<bool, etl::is_trivially_copy_constructible<T>::value &&
+                                                                                       etl::is_trivially_destructible<T>::value> {};
+
   /// conditional
   ///\ingroup type_traits
   template <bool B, typename T, typename F>  struct conditional { typedef T type; };
@@ -0,0 +1,1661 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef __ETL_UNROLLED_LIST__
+#define __ETL_UNROLLED_LIST__
+
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <stddef.h>
+#include <new>
+
+#include "platform.h"
+#include "container.h"
+#include "pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "debug_count.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "algorithm.h"
+
+#ifdef ETL_COMPILER_MICROSOFT
+#undef min
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "34"
+
+//*****************************************************************************
+///\defgroup unrolled_list unrolled_list
+/// A linked list that stores several elements in each node, with the
+/// capacity defined at compile time.
+/// Iteration touches one node per NODE_SIZE elements rather than one per
+/// element. Insertion and erasure shift at most NODE_SIZE elements.
+/// Unlike etl::list, insertion and erasure invalidate iterators to the
+/// elements of the nodes involved.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_exception : public exception
+  {
+  public:
+
+    unrolled_list_exception(string_type what, string_type file_name, numeric_type line_number)
+      : exception(what, file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_full : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_full(string_type file_name, numeric_type line_number)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:full", ETL_FILE"A"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_empty : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_empty(string_type file_name, numeric_type line_number)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:empty", ETL_FILE"B"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_iterator : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_iterator(string_type file_name, numeric_type line_number)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:iterator", ETL_FILE"C"), file_name, line_number)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all unrolled_lists.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_base
+  {
+  public:
+
+    typedef size_t size_type; ///< The type used for determining the size of unrolled_list.
+
+    //*************************************************************************
+    /// The link part of a node.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t()
+        : previous(nullptr),
+          next(nullptr)
+      {
+      }
+
+      node_t* previous;
+      node_t* next;
+    };
+
+    //*************************************************************************
+    /// The header of a node of elements.
+    //*************************************************************************
+    struct block_t : public node_t
+    {
+      block_t()
+        : count(0)
+      {
+      }
+
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unrolled_list.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the size of the unrolled_list.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unrolled_list is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unrolled_list is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Gets the number of elements stored in each node.
+    //*************************************************************************
+    size_t node_size() const
+    {
+      return NODE_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the number of nodes in use.
+    //*************************************************************************
+    size_t node_count() const
+    {
+      return p_node_pool->size();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Join two nodes.
+    //*************************************************************************
+    void join(node_t& left, node_t& right)
+    {
+      left.next = &right;
+      right.previous = &left;
+    }
+
+    //*************************************************************************
+    /// Is the node one that holds elements?
+    //*************************************************************************
+    bool is_block(const node_t* p_node) const
+    {
+      return p_node != &terminal_node;
+    }
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    unrolled_list_base(etl::ipool& node_pool, size_type max_size, size_type node_size)
+      : p_node_pool(&node_pool),
+        current_size(0),
+        MAX_SIZE(max_size),
+        NODE_SIZE(node_size)
+    {
+    }
+
+    etl::ipool*      p_node_pool;     ///< The pool of nodes used in the unrolled_list.
+    node_t           terminal_node;   ///< The node that acts as the unrolled_list start and end.
+    size_type        current_size;    ///< The number of elements in the unrolled_list.
+    const size_type  MAX_SIZE;        ///< The maximum size of the unrolled_list.
+    const size_type  NODE_SIZE;       ///< The number of elements in each node.
+    etl::debug_count construct_count; ///< Internal debugging.
+  };
+
+  //***************************************************************************
+  /// A templated base for all etl::unrolled_list types.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T>
+  class iunrolled_list : public etl::unrolled_list_base
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef size_t   size_type;
+
+  protected:
+
+    typedef typename etl::parameter_type<T, is_fundamental<T>::value || is_pointer<T>::value>::type parameter_t;
+
+    //*************************************************************************
+    /// A node of NODE_SIZE_ elements.
+    /// The offset of the elements does not depend on NODE_SIZE_.
+    //*************************************************************************
+    template <const size_t NODE_SIZE_>
+    struct data_node_t : public block_t
+    {
+      typename etl::aligned_storage<sizeof(T) * NODE_SIZE_, etl::alignment_of<T>::value>::type buffer;
+    };
+
+  private:
+
+    //*************************************************************************
+    /// Downcast a node_t to a block_t.
+    //*************************************************************************
+    static block_t& block_cast(node_t& node)
+    {
+      return static_cast<block_t&>(node);
+    }
+
+    //*************************************************************************
+    /// Downcast a const node_t to a const block_t.
+    //*************************************************************************
+    static const block_t& block_cast(const node_t& node)
+    {
+      return static_cast<const block_t&>(node);
+    }
+
+    //*************************************************************************
+    /// Gets the elements of a node.
+    //*************************************************************************
+    static T* values(block_t& block)
+    {
+      return reinterpret_cast<T*>(&static_cast<data_node_t<1>&>(block).buffer);
+    }
+
+    //*************************************************************************
+    /// Gets the elements of a const node.
+    //*************************************************************************
+    static const T* values(const block_t& block)
+    {
+      return reinterpret_cast<const T*>(&static_cast<const data_node_t<1>&>(block).buffer);
+    }
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public std::iterator<std::bidirectional_iterator_tag, T>
+    {
+    public:
+
+      friend class iunrolled_list;
+      friend class const_iterator;
+
+      iterator()
+        : p_node(nullptr),
+          index(0)
+      {
+      }
+
+      iterator(node_t& node, size_t index_)
+        : p_node(&node),
+          index(index_)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_node(other.p_node),
+          index(other.index)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == iunrolled_list::block_cast(*p_node).count)
+        {
+          p_node = p_node->next;
+          index = 0;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (index == 0)
+        {
+          p_node = p_node->previous;
+          index  = iunrolled_list::block_cast(*p_node).count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_node = other.p_node;
+        index  = other.index;
+        return *this;
+      }
+
+      reference operator *()
+      {
+        return iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index];
+      }
+
+      const_reference operator *() const
+      {
+        return iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index];
+      }
+
+      pointer operator &()
+      {
+        return &(iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index]);
+      }
+
+      const_pointer operator &() const
+      {
+        return &(iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index]);
+      }
+
+      pointer operator ->()
+      {
+        return &(iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index]);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_node == rhs.p_node) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      node_t* p_node;
+      size_t  index;
+    };
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::bidirectional_iterator_tag, const T>
+    {
+    public:
+
+      friend class iunrolled_list;
+
+      const_iterator()
+        : p_node(nullptr),
+          index(0)
+      {
+      }
+
+      const_iterator(const node_t& node, size_t index_)
+        : p_node(&node),
+          index(index_)
+      {
+      }
+
+      const_iterator(const typename iunrolled_list::iterator& other)
+        : p_node(other.p_node),
+          index(other.index)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_node(other.p_node),
+          index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == iunrolled_list::block_cast(*p_node).count)
+        {
+          p_node = p_node->next;
+          index = 0;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (index == 0)
+        {
+          p_node = p_node->previous;
+          index  = iunrolled_list::block_cast(*p_node).count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_node = other.p_node;
+        index  = other.index;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(iunrolled_list::values(iunrolled_list::block_cast(*p_node))[index]);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_node == rhs.p_node) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const node_t* p_node;
+      size_t        index;
+    };
+
+    typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the unrolled_list.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*terminal_node.next, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the unrolled_list.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*terminal_node.next, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the unrolled_list.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(terminal_node, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the unrolled_list.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(terminal_node, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the unrolled_list.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*terminal_node.next, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the unrolled_list.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(terminal_node, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the unrolled_list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the unrolled_list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return values(block_cast(*terminal_node.next))[0];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return values(block_cast(*terminal_node.next))[0];
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      block_t& block = block_cast(*terminal_node.previous);
+      return values(block)[block.count - 1];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      const block_t& block = block_cast(*terminal_node.previous);
+      return values(block)[block.count - 1];
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values to the unrolled_list.
+    /// If asserts or exceptions are enabled throws etl::unrolled_list_full if the unrolled_list does not have enough free space.
+    /// If ETL_THROW_EXCEPTIONS & _DEBUG are defined throws unrolled_list_iterator if the iterators are reversed.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type count = std::distance(first, last);
+      ETL_ASSERT(count >= 0, ETL_ERROR(unrolled_list_iterator));
+      ETL_ASSERT(size_t(count) <= MAX_SIZE, ETL_ERROR(unrolled_list_full));
+#endif
+      initialise();
+
+      while (first != last)
+      {
+        insert(end(), *first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of a value to the unrolled_list.
+    //*************************************************************************
+    void assign(size_t n, parameter_t value_)
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(n <= MAX_SIZE, ETL_ERROR(unrolled_list_full));
+#endif
+
+      // The value may refer to an element of this list.
+      const T value(value_);
+
+      initialise();
+
+      while (size() < n)
+      {
+        insert(end(), value);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds an element to the front of the unrolled_list so a new value can be assigned to front().
+    //*************************************************************************
+    void push_front()
+    {
+      push_front(T());
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the front of the unrolled_list.
+    //*************************************************************************
+    void push_front(parameter_t value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+#endif
+      insert(begin(), value);
+    }
+
+    //*************************************************************************
+    /// Removes a value from the front of the unrolled_list.
+    //*************************************************************************
+    void pop_front()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+#endif
+      erase(begin());
+    }
+
+    //*************************************************************************
+    /// Adds an element to the back of the unrolled_list so a new value can be assigned to back().
+    //*************************************************************************
+    void push_back()
+    {
+      push_back(T());
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the back of the unrolled_list.
+    //*************************************************************************
+    void push_back(parameter_t value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+#endif
+      insert(end(), value);
+    }
+
+    //*************************************************************************
+    /// Removes a value from the back of the unrolled_list.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+#endif
+      erase(--end());
+    }
+
+    //*************************************************************************
+    /// Inserts a value to the unrolled_list at the specified position.
+    /// Shifts at most NODE_SIZE elements. If the node is full, an element is
+    /// moved to a neighbouring node with space, or else the node is split.
+    //*************************************************************************
+    iterator insert(iterator position, const value_type& value_)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      // The value may refer to an element of this list, which may be moved
+      // before it is read.
+      const T value(value_);
+
+      ++current_size;
+
+      // At the end?
+      if (!is_block(position.p_node))
+      {
+        if (is_block(terminal_node.previous) && (block_cast(*terminal_node.previous).count < NODE_SIZE))
+        {
+          block_t& last = block_cast(*terminal_node.previous);
+          return insert_value(last, last.count, value);
+        }
+        else
+        {
+          return insert_value(allocate_block(terminal_node), 0, value);
+        }
+      }
+
+      block_t& block = block_cast(*position.p_node);
+      size_t   index = position.index;
+
+      if (block.count < NODE_SIZE)
+      {
+        return insert_value(block, index, value);
+      }
+
+      // The node is full.
+      node_t* p_previous = block.previous;
+      node_t* p_next     = block.next;
+
+      if (is_block(p_previous) && (block_cast(*p_previous).count < NODE_SIZE))
+      {
+        block_t& previous = block_cast(*p_previous);
+
+        if (index == 0)
+        {
+          return insert_value(previous, previous.count, value);
+        }
+
+        // Move the first element to the previous node.
+        insert_value(previous, previous.count, values(block)[0]);
+        remove_value(block, 0);
+        --index;
+      }
+      else if (is_block(p_next) && (block_cast(*p_next).count < NODE_SIZE))
+      {
+        // Move the last element to the next node.
+        insert_value(block_cast(*p_next), 0, values(block)[block.count - 1]);
+        remove_value(block, block.count - 1);
+      }
+      else
+      {
+        // Split the node.
+        block_t& upper = allocate_block(*p_next);
+        size_t   half  = block.count / 2;
+
+        move_values(block, half, upper);
+
+        if (index > half)
+        {
+          return insert_value(upper, index - half, value);
+        }
+      }
+
+      return insert_value(block, index, value);
+    }
+
+    //*************************************************************************
+    /// Inserts 'n' copies of a value to the unrolled_list at the specified position.
+    //*************************************************************************
+    void insert(iterator position, size_t n, const value_type& value_)
+    {
+      // The value may refer to an element of this list.
+      const T value(value_);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        position = insert(position, value);
+        ++position;
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values to the unrolled_list at the specified position.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(iterator position, TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        position = insert(position, *first++);
+        ++position;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    /// A node is merged with a neighbour when they would fit in one node.
+    //*************************************************************************
+    iterator erase(iterator position)
+    {
+      block_t& block = block_cast(*position.p_node);
+      size_t   index = position.index;
+
+      remove_value(block, index);
+      --current_size;
+
+      if (block.count == 0)
+      {
+        node_t& next = *block.next;
+        release_block(block);
+
+        return iterator(next, 0);
+      }
+
+      // Merge with the next node?
+      if (is_block(block.next) && ((block.count + block_cast(*block.next).count) <= NODE_SIZE))
+      {
+        block_t& next = block_cast(*block.next);
+        move_values(next, 0, block);
+        release_block(next);
+      }
+
+      // Merge with the previous node?
+      if (is_block(block.previous) && ((block_cast(*block.previous).count + block.count) <= NODE_SIZE))
+      {
+        block_t& previous = block_cast(*block.previous);
+        index += previous.count;
+        move_values(block, 0, previous);
+        release_block(block);
+
+        return make_iterator(previous, index);
+      }
+
+      return make_iterator(block, index);
+    }
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    //*************************************************************************
+    iterator erase(iterator first, iterator last)
+    {
+      difference_type n = std::distance(first, last);
+
+      while (n-- > 0)
+      {
+        first = erase(first);
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Resizes the unrolled_list.
+    //*************************************************************************
+    void resize(size_t n)
+    {
+      resize(n, T());
+    }
+
+    //*************************************************************************
+    /// Resizes the unrolled_list.
+    //*************************************************************************
+    void resize(size_t n, parameter_t value)
+    {
+      ETL_ASSERT(n <= MAX_SIZE, ETL_ERROR(unrolled_list_full));
+
+      while (n < size())
+      {
+        pop_back();
+      }
+
+      while (n > size())
+      {
+        insert(end(), value);
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the unrolled_list.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Reverses the unrolled_list.
+    //*************************************************************************
+    void reverse()
+    {
+      std::reverse(begin(), end());
+    }
+
+    //*************************************************************************
+    // Removes the values specified.
+    //*************************************************************************
+    void remove(const value_type& value)
+    {
+      iterator iValue = begin();
+
+      while (iValue != end())
+      {
+        if (value == *iValue)
+        {
+          iValue = erase(iValue);
+        }
+        else
+        {
+          ++iValue;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Removes according to a predicate.
+    //*************************************************************************
+    template <typename TPredicate>
+    void remove_if(TPredicate predicate)
+    {
+      iterator iValue = begin();
+
+      while (iValue != end())
+      {
+        if (predicate(*iValue))
+        {
+          iValue = erase(iValue);
+        }
+        else
+        {
+          ++iValue;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all but the first element from every consecutive group of equal
+    /// elements in the container.
+    //*************************************************************************
+    void unique()
+    {
+      unique(std::equal_to<T>());
+    }
+
+    //*************************************************************************
+    /// Removes all but the first element from every consecutive group of equal
+    /// elements in the container.
+    //*************************************************************************
+    template <typename TIsEqual>
+    void unique(TIsEqual isEqual)
+    {
+      if (empty())
+      {
+        return;
+      }
+
+      iterator i_item = begin();
+      ++i_item;
+
+      while (i_item != end())
+      {
+        iterator i_previous = i_item;
+        --i_previous;
+
+        if (isEqual(*i_previous, *i_item))
+        {
+          i_item = erase(i_item);
+        }
+        else
+        {
+          ++i_item;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Splices from another unrolled_list to this.
+    //*************************************************************************
+    void splice(iterator to, iunrolled_list& other)
+    {
+      if (&other != this)
+      {
+        insert(to, other.begin(), other.end());
+        other.clear();
+      }
+    }
+
+    //*************************************************************************
+    /// Splices an element from another unrolled_list to this.
+    //*************************************************************************
+    void splice(iterator to, iunrolled_list& other, iterator from)
+    {
+      iterator last = from;
+      ++last;
+
+      splice(to, other, from, last);
+    }
+
+    //*************************************************************************
+    /// Splices a range of elements from another unrolled_list to this.
+    /// An internal move rotates the elements, so no nodes are allocated.
+    //*************************************************************************
+    void splice(iterator to, iunrolled_list& other, iterator first, iterator last)
+    {
+      if (&other == this)
+      {
+        if ((to == first) || (to == last))
+        {
+          return;
+        }
+
+        // Is 'to' before the range?
+        iterator itr = to;
+
+        while ((itr != end()) && (itr != first))
+        {
+          ++itr;
+        }
+
+        if (itr == first)
+        {
+          std::rotate(to, first, last);
+        }
+        else
+        {
+          std::rotate(first, last, to);
+        }
+      }
+      else
+      {
+        insert(to, first, last);
+        other.erase(first, last);
+      }
+    }
+
+    //*************************************************************************
+    /// Merge another unrolled_list into this one. Both lists should be sorted.
+    //*************************************************************************
+    void merge(iunrolled_list& other)
+    {
+      merge(other, std::less<value_type>());
+    }
+
+    //*************************************************************************
+    /// Merge another unrolled_list into this one. Both lists should be sorted.
+    //*************************************************************************
+    template <typename TCompare>
+    void merge(iunrolled_list& other, TCompare compare)
+    {
+      if ((&other != this) && !other.empty())
+      {
+#if _DEBUG
+        ETL_ASSERT(etl::is_sorted(other.begin(), other.end(), compare), ETL_ERROR(unrolled_list_iterator));
+        ETL_ASSERT(etl::is_sorted(begin(), end(), compare), ETL_ERROR(unrolled_list_iterator));
+#endif
+
+        iterator other_begin = other.begin();
+        iterator other_end   = other.end();
+
+        iterator this_begin = begin();
+
+        while (other_begin != other_end)
+        {
+          // Find the place to insert.
+          while ((this_begin != end()) && !compare(*other_begin, *this_begin))
+          {
+            ++this_begin;
+          }
+
+          this_begin = insert(this_begin, *other_begin);
+          ++this_begin;
+          ++other_begin;
+        }
+
+        other.clear();
+      }
+    }
+
+    //*************************************************************************
+    /// Sort using a stable in-place merge sort.
+    /// Uses 'less-than operator as the predicate.
+    //*************************************************************************
+    void sort()
+    {
+      sort(std::less<T>());
+    }
+
+    //*************************************************************************
+    /// Sort using a stable in-place merge sort.
+    /// Each node is insertion sorted, then runs of nodes are merged without
+    /// a buffer, by rotation.
+    //*************************************************************************
+    template <typename TCompare>
+    void sort(TCompare compare)
+    {
+      if (size() < 2)
+      {
+        return;
+      }
+
+      node_t* p_node = terminal_node.next;
+
+      while (is_block(p_node))
+      {
+        block_t& block = block_cast(*p_node);
+        T*       p     = values(block);
+
+        for (size_t i = 1; i < block.count; ++i)
+        {
+          for (size_t j = i; (j > 0) && compare(p[j], p[j - 1]); --j)
+          {
+            std::swap(p[j], p[j - 1]);
+          }
+        }
+
+        p_node = p_node->next;
+      }
+
+      // Merge adjacent runs of nodes, doubling the run length each pass.
+      for (size_t run = 1; ; run *= 2)
+      {
+        size_t merges = 0;
+
+        p_node = terminal_node.next;
+
+        while (is_block(p_node))
+        {
+          iterator first(*p_node, 0);
+          size_t   length1 = run_length(p_node, run);
+
+          if (!is_block(p_node))
+          {
+            break;
+          }
+
+          iterator middle(*p_node, 0);
+          size_t   length2 = run_length(p_node, run);
+
+          iterator last = is_block(p_node) ? iterator(*p_node, 0) : end();
+
+          merge_without_buffer(first, middle, last, length1, length2, compare);
+          ++merges;
+        }
+
+        if (merges == 0)
+        {
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunrolled_list& operator = (const iunrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iunrolled_list(etl::ipool& node_pool, size_t max_size_, size_t node_size_)
+      : unrolled_list_base(node_pool, max_size_, node_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialise the unrolled_list.
+    //*************************************************************************
+    void initialise()
+    {
+      if (terminal_node.next != nullptr)
+      {
+        node_t* p_node = terminal_node.next;
+
+        while (is_block(p_node))
+        {
+          node_t*  p_next = p_node->next;
+          block_t& block  = block_cast(*p_node);
+          T*       p      = values(block);
+
+          for (size_t i = 0; i < block.count; ++i)
+          {
+            p[i].~T();
+            --construct_count;
+          }
+
+          p_node_pool->release(&block);
+          p_node = p_next;
+        }
+      }
+
+      current_size = 0;
+      join(terminal_node, terminal_node);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Makes an iterator, moving to the start of the next node if the index
+    /// is past the end of the node.
+    //*************************************************************************
+    iterator make_iterator(block_t& block, size_t index)
+    {
+      if (index == block.count)
+      {
+        return iterator(*block.next, 0);
+      }
+
+      return iterator(block, index);
+    }
+
+    //*************************************************************************
+    /// Allocates an empty node and links it before 'position'.
+    //*************************************************************************
+    block_t& allocate_block(node_t& position)
+    {
+      block_t* p_block = p_node_pool->allocate<block_t>();
+      ::new (p_block) block_t();
+
+      join(*position.previous, *p_block);
+      join(*p_block, position);
+
+      return *p_block;
+    }
+
+    //*************************************************************************
+    /// Unlinks and releases an empty node.
+    //*************************************************************************
+    void release_block(block_t& block)
+    {
+      join(*block.previous, *block.next);
+      p_node_pool->release(&block);
+    }
+
+    //*************************************************************************
+    /// Inserts a value into a node that is not full.
+    //*************************************************************************
+    iterator insert_value(block_t& block, size_t index, parameter_t value)
+    {
+      T* p = values(block);
+
+      if (index == block.count)
+      {
+        ::new (p + index) T(value);
+      }
+      else
+      {
+        ::new (p + block.count) T(p[block.count - 1]);
+        std::copy_backward(p + index, p + block.count - 1, p + block.count);
+        p[index] = value;
+      }
+
+      ++construct_count;
+      ++block.count;
+
+      return iterator(block, index);
+    }
+
+    //*************************************************************************
+    /// Removes a value from a node.
+    //*************************************************************************
+    void remove_value(block_t& block, size_t index)
+    {
+      T* p = values(block);
+
+      std::copy(p + index + 1, p + block.count, p + index);
+      p[block.count - 1].~T();
+      --construct_count;
+      --block.count;
+    }
+
+    //*************************************************************************
+    /// Moves the values from 'index' onwards to the end of another node.
+    //*************************************************************************
+    void move_values(block_t& from, size_t index, block_t& to)
+    {
+      T* p_from = values(from);
+      T* p_to   = values(to);
+
+      for (size_t i = index; i < from.count; ++i)
+      {
+        ::new (p_to + to.count++) T(p_from[i]);
+        p_from[i].~T();
+      }
+
+      from.count = index;
+    }
+
+    //*************************************************************************
+    /// Advances over up to 'run' nodes.
+    ///\return The number of elements passed.
+    //*************************************************************************
+    size_t run_length(node_t*& p_node, size_t run)
+    {
+      size_t length = 0;
+
+      for (size_t i = 0; (i < run) && is_block(p_node); ++i)
+      {
+        length += block_cast(*p_node).count;
+        p_node = p_node->next;
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Stable merge of two adjacent sorted ranges, without a buffer.
+    //*************************************************************************
+    template <typename TCompare>
+    static void merge_without_buffer(iterator first, iterator middle, iterator last, size_t length1, size_t length2, TCompare compare)
+    {
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          std::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      iterator cut1 = first;
+      iterator cut2 = middle;
+      size_t   length11;
+      size_t   length22;
+
+      if (length1 > length2)
+      {
+        length11 = length1 / 2;
+        std::advance(cut1, length11);
+        cut2 = std::lower_bound(middle, last, *cut1, compare);
+        length22 = std::distance(middle, cut2);
+      }
+      else
+      {
+        length22 = length2 / 2;
+        std::advance(cut2, length22);
+        cut1 = std::upper_bound(first, middle, *cut2, compare);
+        length11 = std::distance(first, cut1);
+      }
+
+      std::rotate(cut1, middle, cut2);
+
+      iterator new_middle = cut1;
+      std::advance(new_middle, length22);
+
+      merge_without_buffer(first, cut1, new_middle, length11, length22, compare);
+      merge_without_buffer(new_middle, cut2, last, length1 - length11, length2 - length22, compare);
+    }
+
+    // Disable copy construction.
+    iunrolled_list(const iunrolled_list&);
+  };
+
+  //*************************************************************************
+  /// An unrolled linked list with a fixed capacity.
+  /// Each node holds up to NODE_SIZE_ elements.
+  /// Adjacent nodes always hold more than NODE_SIZE_ elements between them,
+  /// so at most 2 * MAX_SIZE_ / (NODE_SIZE_ + 1) + 1 nodes are ever needed.
+  ///\tparam T          The element type.
+  ///\tparam MAX_SIZE_  The maximum number of elements.
+  ///\tparam NODE_SIZE_ The number of elements in each node.
+  ///\ingroup unrolled_list
+  //*************************************************************************
+  template <typename T, const size_t MAX_SIZE_, const size_t NODE_SIZE_>
+  class unrolled_list : public etl::iunrolled_list<T>
+  {
+  public:
+
+    STATIC_ASSERT(NODE_SIZE_ > 0, "Zero node size");
+
+    static const size_t MAX_SIZE   = MAX_SIZE_;
+    static const size_t NODE_SIZE  = NODE_SIZE_;
+    static const size_t NODE_COUNT = ((2 * MAX_SIZE_) / (NODE_SIZE_ + 1)) + 1;
+
+  public:
+
+    typedef T        value_type;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef size_t   size_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unrolled_list()
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, NODE_SIZE)
+    {
+      etl::iunrolled_list<T>::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unrolled_list()
+    {
+      etl::iunrolled_list<T>::initialise();
+    }
+
+    //*************************************************************************
+    /// Construct from size.
+    //*************************************************************************
+    explicit unrolled_list(size_t initial_size)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, NODE_SIZE)
+    {
+      etl::iunrolled_list<T>::assign(initial_size, T());
+    }
+
+    //*************************************************************************
+    /// Construct from size and value.
+    //*************************************************************************
+    unrolled_list(size_t initial_size, typename iunrolled_list<T>::parameter_t value)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, NODE_SIZE)
+    {
+      etl::iunrolled_list<T>::assign(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unrolled_list(const unrolled_list& other)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, NODE_SIZE)
+    {
+      etl::iunrolled_list<T>::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    template <typename TIterator>
+    unrolled_list(TIterator first, TIterator last)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, NODE_SIZE)
+    {
+      etl::iunrolled_list<T>::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unrolled_list& operator = (const unrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::iunrolled_list<T>::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The pool of nodes used in the unrolled_list.
+    etl::pool<typename etl::iunrolled_list<T>::template data_node_t<NODE_SIZE_>, NODE_COUNT> node_pool;
+  };
+}
+
+//*************************************************************************
+/// Equal operator.
+///\param lhs Reference to the first unrolled_list.
+///\param rhs Reference to the second unrolled_list.
+///\return <b>true</b> if the lists are equal, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T>
+bool operator ==(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+{
+  return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+//*************************************************************************
+/// Not equal operator.
+///\param lhs Reference to the first unrolled_list.
+///\param rhs Reference to the second unrolled_list.
+///\return <b>true</b> if the lists are not equal, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T>
+bool operator !=(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+//*************************************************************************
+/// Less than operator.
+///\param lhs Reference to the first unrolled_list.
+///\param rhs Reference to the second unrolled_list.
+///\return <b>true</b> if the first unrolled_list is lexicographically less than the
+/// second, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T>
+bool operator <(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+{
+  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+//*************************************************************************
+/// Greater than operator.
+///\param lhs Reference to the first unrolled_list.
+///\param rhs Reference to the second unrolled_list.
+///\return <b>true</b> if the first unrolled_list is lexicographically greater than the
+/// second, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T>
+bool operator >(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+{
+  return (rhs < lhs);
+}
+
+//*************************************************************************
+/// Less than or equal operator.
+///\param lhs Reference to the first unrolled_list.
+///\param rhs Reference to the second unrolled_list.
+///\return <b>true</b> if the first unrolled_list is lexicographically less than or equal
+/// to the second, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T>
+bool operator <=(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+{
+  return !(lhs > rhs);
+}
+
+//*************************************************************************
+/// Greater than or equal operator.
+///\param lhs Reference to the first unrolled_list.
+///\param rhs Reference to the second unrolled_list.
+///\return <b>true</b> if the first unrolled_list is lexicographically greater than or
+/// equal to the second, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T>
+bool operator >=(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+{
+  return !(lhs < rhs);
+}
+
+#ifdef ETL_COMPILER_MICROSOFT
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#undef ETL_FILE
+
+#endif
@@ -496,9 +496,7 @@ namespace etl
       }
       else
       {
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
-        *position = value;
+        insert_at(position, value);
       }
 
       return position;
@@ -512,15 +510,19 @@ namespace etl
     ///\param value    The value to insert.
     //*********************************************************************
     template <typename U = T>
-    typename etl::enable_if<etl::is_trivially_constructible<U>::value, void>::type
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, void>::type
       insert(iterator position, size_t n, parameter_t value)
     {
       ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
-      std::copy_backward(position, p_end, p_end + n);
-      std::fill_n(position, n, value);
+      etl::relocate(position, p_end, position + n);
+
+#if defined(ETL_DEBUG)
+      etl::uninitialized_fill_n(position, n, value, construct_count);
+#else
+      etl::uninitialized_fill_n(position, n, value);
+#endif
 
-      construct_count += n;
       p_end += n;
     }
 
@@ -532,7 +534,7 @@ namespace etl
     ///\param value    The value to insert.
     //*********************************************************************
     template <typename U = T>
-    typename etl::enable_if<!etl::is_trivially_constructible<U>::value, void>::type
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, void>::type
       insert(iterator position, size_t n, parameter_t value)
     {
       ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
@@ -567,7 +569,7 @@ namespace etl
       etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old, construct_count);
 
       // Copy old.
-      etl::copy_n(p_buffer + insert_begin, copy_old_n, p_buffer + insert_end);
+      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
 
       // Construct new.
       etl::uninitialized_fill_n(p_end, construct_new_n, value, construct_count);
@@ -579,7 +581,7 @@ namespace etl
       etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
 
       // Copy old.
-      etl::copy_n(p_buffer + insert_begin, copy_old_n, p_buffer + insert_end);
+      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
 
       // Construct new.
       etl::uninitialized_fill_n(p_end, construct_new_n, value);
@@ -594,43 +596,39 @@ namespace etl
     //*********************************************************************
     /// Inserts a range of values to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector does not have enough free space.
-    /// For fundamental and pointer types.
+    /// For trivially relocatable types.
     ///\param position The position to insert before.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator, typename U = T>
-    typename etl::enable_if<etl::is_trivially_constructible<U>::value, void>::type
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, void>::type
       insert(iterator position, TIterator first, TIterator last)
     {
       size_t count = std::distance(first, last);
 
       ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
-      construct_count += count;
+      etl::relocate(position, p_end, position + count);
 
-      if (position == end())
-      {
-        p_end = std::copy(first, last, p_end);
-      }
-      else
-      {
-        std::copy_backward(position, p_end, p_end + count);
-        std::copy(first, last, position);
-        p_end += count;
-      }
+#if defined(ETL_DEBUG)
+      etl::uninitialized_copy(first, last, position, construct_count);
+#else
+      etl::uninitialized_copy(first, last, position);
+#endif
+
+      p_end += count;
     }
 
     //*********************************************************************
     /// Inserts a range of values to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector does not have enough free space.
-    /// For fundamental and pointer types.
     ///\param position The position to insert before.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator, typename U = T>
-    typename etl::enable_if<!etl::is_trivially_constructible<U>::value, void>::type
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, void>::type
       insert(iterator position, TIterator first, TIterator last)
     {
       size_t count = std::distance(first, last);
@@ -667,7 +665,7 @@ namespace etl
       etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old, construct_count);
 
       // Copy old.
-      etl::copy_n(p_buffer + insert_begin, copy_old_n, p_buffer + insert_end);
+      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
 
       // Construct new.
       etl::uninitialized_copy_n(first + copy_new_n, construct_new_n, p_end, construct_count);
@@ -679,7 +677,7 @@ namespace etl
       etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
 
       // Copy old.
-      etl::copy_n(p_buffer + insert_begin, copy_old_n, p_buffer + insert_end);
+      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
 
       // Construct new.
       etl::uninitialized_copy_n(first + copy_new_n, construct_new_n, p_end);
@@ -698,10 +696,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
-      destroy_back();
-
-      return i_element;
+      return erase(i_element, i_element + 1);
     }
 
     //*********************************************************************
@@ -713,7 +708,7 @@ namespace etl
     ///\return An iterator pointing to the element that followed the erased element.
     //*********************************************************************
     template <typename U = T>
-    typename etl::enable_if<etl::is_trivially_constructible<U>::value, iterator>::type
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, iterator>::type
       erase(iterator first, iterator last)
     {
       if (first == begin() && last == end())
@@ -722,10 +717,12 @@ namespace etl
       }
       else
       {
-        std::copy(last, end(), first);
-        size_t n_delete = std::distance(first, last);
-        construct_count -= n_delete;
-        p_end -= n_delete;
+#if defined(ETL_DEBUG)
+        etl::destroy(first, last, construct_count);
+#else
+        etl::destroy(first, last);
+#endif
+        p_end = etl::relocate(last, p_end, first);
       }
 
       return first;
@@ -740,7 +737,7 @@ namespace etl
     ///\return An iterator pointing to the element that followed the erased element.
     //*********************************************************************
     template <typename U = T>
-    typename etl::enable_if<!etl::is_trivially_constructible<U>::value, iterator>::type
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, iterator>::type
       erase(iterator first, iterator last)
     {
       if (first == begin() && last == end())
@@ -901,6 +898,37 @@ namespace etl
 #endif
     }
 
+    //*********************************************************************
+    /// Inserts a value before an existing element.
+    /// The following elements are relocated with a single memmove.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<etl::is_trivially_relocatable<U>::value, void>::type
+      insert_at(iterator position, parameter_t value)
+    {
+      etl::relocate(position, p_end, position + 1);
+
+#if defined(ETL_DEBUG)
+      etl::create_copy_at(position, value, construct_count);
+#else
+      etl::create_copy_at(position, value);
+#endif
+
+      ++p_end;
+    }
+
+    //*********************************************************************
+    /// Inserts a value before an existing element.
+    //*********************************************************************
+    template <typename U = T>
+    typename etl::enable_if<!etl::is_trivially_relocatable<U>::value, void>::type
+      insert_at(iterator position, parameter_t value)
+    {
+      create_back(back());
+      std::copy_backward(position, p_end - 1, p_end);
+      *position = value;
+    }
+
     // Disable copy construction.
     ivector(const ivector&);
   };
@@ -1180,6 +1208,228 @@ namespace etl
 
     typename etl::aligned_storage<sizeof(T*) * MAX_SIZE, etl::alignment_of<T*>::value>::type buffer;
   };
+
+  //***************************************************************************
+  /// A vector implementation that uses a caller supplied buffer.
+  /// The capacity is set at run time, so all vector_exts of the same element
+  /// type share one instantiation of the code.
+  /// The buffer must be suitably aligned for the element type, must hold at
+  /// least max_size elements, and must outlive the vector_ext. It may be, for
+  /// example, a slot allocated from an etl::ipool or a memory mapped region.
+  ///\tparam T The element type.
+  ///\ingroup vector
+  //***************************************************************************
+  template <typename T>
+  class vector_ext : public etl::ivector<T>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer to store the elements in.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(void* buffer, size_t max_size)
+      : etl::ivector<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+      etl::ivector<T>::initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with size.
+    ///\param initial_size The initial size of the vector_ext.
+    ///\param buffer       The buffer to store the elements in.
+    ///\param max_size     The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(size_t initial_size, void* buffer, size_t max_size)
+      : etl::ivector<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+      etl::ivector<T>::initialise();
+      etl::ivector<T>::resize(initial_size);
+    }
+
+    //*************************************************************************
+    /// Constructor, from initial size and value.
+    ///\param initial_size The initial size of the vector_ext.
+    ///\param value        The value to fill the vector_ext with.
+    ///\param buffer       The buffer to store the elements in.
+    ///\param max_size     The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(size_t initial_size, typename etl::ivector<T>::parameter_t value, void* buffer, size_t max_size)
+      : etl::ivector<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+      etl::ivector<T>::initialise();
+      etl::ivector<T>::resize(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first    The iterator to the first element.
+    ///\param last     The iterator to the last element + 1.
+    ///\param buffer   The buffer to store the elements in.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    template <typename TIterator>
+    vector_ext(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : etl::ivector<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+      etl::ivector<T>::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Copy constructor, into a new buffer.
+    ///\param other    The vector to copy.
+    ///\param buffer   The buffer to store the elements in.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(const etl::ivector<T>& other, void* buffer, size_t max_size)
+      : etl::ivector<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+      etl::ivector<T>::assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~vector_ext()
+    {
+      etl::ivector<T>::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    vector_ext& operator = (const vector_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::ivector<T>::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The buffer is external, so does not move with the vector_ext.
+    //*************************************************************************
+    void repair()
+    {
+    }
+
+  private:
+
+    // Disable copy construction, as a new buffer is required.
+    vector_ext(const vector_ext&);
+  };
+
+  //***************************************************************************
+  /// A vector implementation that uses a caller supplied buffer.
+  /// The capacity is set at run time, so all vector_exts of pointers of the same element
+  /// type share one instantiation of the code.
+  /// The buffer must be suitably aligned for the element type, must hold at
+  /// least max_size elements, and must outlive the vector_ext. It may be, for
+  /// example, a slot allocated from an etl::ipool or a memory mapped region.
+  ///\tparam T The element type.
+  ///\ingroup vector
+  //***************************************************************************
+  template <typename T>
+  class vector_ext<T*> : public etl::ivector<T*>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer to store the elements in.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(void* buffer, size_t max_size)
+      : etl::ivector<T*>(reinterpret_cast<T**>(buffer), max_size)
+    {
+      etl::ivector<T*>::initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with size.
+    ///\param initial_size The initial size of the vector_ext.
+    ///\param buffer       The buffer to store the elements in.
+    ///\param max_size     The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(size_t initial_size, void* buffer, size_t max_size)
+      : etl::ivector<T*>(reinterpret_cast<T**>(buffer), max_size)
+    {
+      etl::ivector<T*>::initialise();
+      etl::ivector<T*>::resize(initial_size);
+    }
+
+    //*************************************************************************
+    /// Constructor, from initial size and value.
+    ///\param initial_size The initial size of the vector_ext.
+    ///\param value        The value to fill the vector_ext with.
+    ///\param buffer       The buffer to store the elements in.
+    ///\param max_size     The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(size_t initial_size, typename etl::ivector<T*>::parameter_t value, void* buffer, size_t max_size)
+      : etl::ivector<T*>(reinterpret_cast<T**>(buffer), max_size)
+    {
+      etl::ivector<T*>::initialise();
+      etl::ivector<T*>::resize(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first    The iterator to the first element.
+    ///\param last     The iterator to the last element + 1.
+    ///\param buffer   The buffer to store the elements in.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    template <typename TIterator>
+    vector_ext(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : etl::ivector<T*>(reinterpret_cast<T**>(buffer), max_size)
+    {
+      etl::ivector<T*>::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Copy constructor, into a new buffer.
+    ///\param other    The vector to copy.
+    ///\param buffer   The buffer to store the elements in.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(const etl::ivector<T*>& other, void* buffer, size_t max_size)
+      : etl::ivector<T*>(reinterpret_cast<T**>(buffer), max_size)
+    {
+      etl::ivector<T*>::assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    vector_ext& operator = (const vector_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::ivector<T*>::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The buffer is external, so does not move with the vector_ext.
+    //*************************************************************************
+    void repair()
+    {
+    }
+
+  private:
+
+    // Disable copy construction, as a new buffer is required.
+    vector_ext(const vector_ext&);
+  };
 }
 
 #include "private/ivectorpointer.h"
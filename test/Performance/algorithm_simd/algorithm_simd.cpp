@@ -0,0 +1,156 @@
+// algorithm_simd.cpp : Compares the vectorised algorithms with the scalar versions and std.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src algorithm_simd.cpp -o algorithm_simd
+// g++ -O2 -mavx2 -std=c++11 -I../../../src algorithm_simd.cpp -o algorithm_simd_avx2
+//
+// The scalar versions are measured through a std::deque, which is not contiguous.
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+#include "algorithm.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTSIZE = 4096;
+const size_t TESTLOOPS = 20000;
+
+//*****************************************************************************
+template <typename T>
+void Run(const char* title)
+{
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int> distribution(0, 100);
+
+  std::vector<T> data(TESTSIZE);
+
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = T(distribution(generator));
+  }
+
+  std::deque<T> scalar(data.begin(), data.end());
+
+  std::vector<T> sorted(data);
+  std::sort(sorted.begin(), sorted.end());
+
+  const T* first = data.data();
+  const T* last  = data.data() + data.size();
+
+  const T absent = T(101);
+
+  uint64_t sum;
+  uint64_t time;
+
+  std::cout << title << " (" << TESTSIZE << " elements)\n";
+
+  // find
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += std::find(first, last, absent) - first; }
+  time = StopTimer();
+  std::cout << "  find            std    = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += etl::find(scalar.begin(), scalar.end(), absent) - scalar.begin(); }
+  time = StopTimer();
+  std::cout << "  find            scalar = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += etl::find(first, last, absent) - first; }
+  time = StopTimer();
+  std::cout << "  find            etl    = " << time << "us (" << sum << ")\n";
+
+  // count
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += std::count(first, last, T(i % 100)); }
+  time = StopTimer();
+  std::cout << "  count           std    = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += etl::count(scalar.begin(), scalar.end(), T(i % 100)); }
+  time = StopTimer();
+  std::cout << "  count           scalar = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += etl::count(first, last, T(i % 100)); }
+  time = StopTimer();
+  std::cout << "  count           etl    = " << time << "us (" << sum << ")\n";
+
+  // minmax_element
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { std::pair<const T*, const T*> r = std::minmax_element(first, last); sum += *r.first + *r.second; }
+  time = StopTimer();
+  std::cout << "  minmax_element  std    = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { std::pair<typename std::deque<T>::iterator, typename std::deque<T>::iterator> r = etl::minmax_element(scalar.begin(), scalar.end()); sum += *r.first + *r.second; }
+  time = StopTimer();
+  std::cout << "  minmax_element  scalar = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { std::pair<const T*, const T*> r = etl::minmax_element(first, last); sum += *r.first + *r.second; }
+  time = StopTimer();
+  std::cout << "  minmax_element  etl    = " << time << "us (" << sum << ")\n";
+
+  // is_sorted_until
+  std::deque<T> scalar_sorted(sorted.begin(), sorted.end());
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += std::is_sorted_until(sorted.data(), sorted.data() + sorted.size()) - sorted.data(); }
+  time = StopTimer();
+  std::cout << "  is_sorted_until std    = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += etl::is_sorted_until(scalar_sorted.begin(), scalar_sorted.end()) - scalar_sorted.begin(); }
+  time = StopTimer();
+  std::cout << "  is_sorted_until scalar = " << time << "us (" << sum << ")\n";
+
+  sum = 0;
+  StartTimer();
+  for (size_t i = 0; i < TESTLOOPS; ++i) { sum += etl::is_sorted_until(sorted.data(), sorted.data() + sorted.size()) - sorted.data(); }
+  time = StopTimer();
+  std::cout << "  is_sorted_until etl    = " << time << "us (" << sum << ")\n";
+
+  std::cout << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  Run<uint8_t>("uint8_t");
+  Run<int16_t>("int16_t");
+  Run<int32_t>("int32_t");
+  Run<uint32_t>("uint32_t");
+
+  return 0;
+}
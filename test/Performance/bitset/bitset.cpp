@@ -0,0 +1,108 @@
+// bitset.cpp : Times count, find_first/find_next, any/none and shifting on a
+// 64k bit etl::bitset, with std::bitset as a reference.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src bitset.cpp -o bitset
+//
+// Add -DETL_BITSET_ELEMENT_TYPE=uint8_t to compare with byte sized elements.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <iostream>
+#include <chrono>
+#include <bitset>
+
+#include "bitset.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t BITS      = 65536;
+const size_t TESTLOOPS = 2000;
+
+etl::bitset<BITS> etl_mask;
+std::bitset<BITS> std_mask;
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function(i);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  // A sparse mask, one bit in every 1000.
+  for (size_t i = 0; i < BITS; i += 1000)
+  {
+    etl_mask.set(i);
+    std_mask.set(i);
+  }
+
+  std::cout << "Element size : " << sizeof(etl::ibitset::ALL_SET) << " bytes\n";
+
+  std::cout << "count\n";
+  Run("etl::bitset", [](size_t) { return etl_mask.count(); });
+  Run("std::bitset", [](size_t) { return std_mask.count(); });
+
+  std::cout << "find_first/find_next (set bits)\n";
+  Run("etl::bitset", [](size_t)
+  {
+    size_t n = 0;
+
+    for (size_t i = etl_mask.find_first(true); i != etl::ibitset::npos; i = etl_mask.find_next(true, i + 1))
+    {
+      ++n;
+    }
+
+    return n;
+  });
+
+  Run("std::bitset", [](size_t)
+  {
+    size_t n = 0;
+
+    for (size_t i = 0; i < BITS; ++i)
+    {
+      n += std_mask.test(i) ? 1 : 0;
+    }
+
+    return n;
+  });
+
+  std::cout << "none (empty mask)\n";
+  etl::bitset<BITS> etl_empty;
+  std::bitset<BITS> std_empty;
+  Run("etl::bitset", [&](size_t) { return size_t(etl_empty.none()); });
+  Run("std::bitset", [&](size_t) { return size_t(std_empty.none()); });
+
+  std::cout << "shift <<= 3, >>= 3\n";
+  Run("etl::bitset", [](size_t) { etl_mask <<= 3; etl_mask >>= 3; return size_t(etl_mask.test(0)); });
+  Run("std::bitset", [](size_t) { std_mask <<= 3; std_mask >>= 3; return size_t(std_mask.test(0)); });
+
+  return 0;
+}
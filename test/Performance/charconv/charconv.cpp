@@ -0,0 +1,188 @@
+// charconv.cpp : Compares etl::to_chars and etl::from_chars with snprintf,
+// strtoll and strtod.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src charconv.cpp ../../../src/charconv.cpp -o charconv
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "charconv.h"
+#include "cstring.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t COUNT = 1000000;
+
+typedef etl::string<40> Text;
+
+//*****************************************************************************
+uint64_t NextRandom(uint64_t& state)
+{
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+
+  return state;
+}
+
+//*****************************************************************************
+void Report(const char* title, uint64_t time, size_t total)
+{
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<int64_t> integers;
+  std::vector<double>  doubles;
+
+  uint64_t state = 0x0123456789ABCDEFULL;
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    integers.push_back(int64_t(NextRandom(state)) >> (i % 64));
+
+    uint64_t bits = NextRandom(state);
+    double   value;
+    memcpy(&value, &bits, sizeof(value));
+
+    if ((value != value) || ((value - value) != 0.0))
+    {
+      value = double(bits >> 11);
+    }
+
+    doubles.push_back(value);
+  }
+
+  std::vector<Text> integer_texts(COUNT);
+  std::vector<Text> double_texts(COUNT);
+
+  size_t total;
+  uint64_t time;
+
+  std::cout << "Integer to text\n";
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    char buffer[40];
+    total += size_t(snprintf(buffer, sizeof(buffer), "%lld", (long long)integers[i]));
+  }
+
+  time = StopTimer();
+  Report("snprintf       ", time, total);
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    integer_texts[i].clear();
+    total += etl::to_chars(integer_texts[i], integers[i]).size();
+  }
+
+  time = StopTimer();
+  Report("etl::to_chars  ", time, total);
+
+  std::cout << "Text to integer\n";
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    total += size_t(strtoll(integer_texts[i].c_str(), 0, 10));
+  }
+
+  time = StopTimer();
+  Report("strtoll        ", time, total);
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    int64_t value = 0;
+    etl::from_chars(integer_texts[i], value);
+    total += size_t(value);
+  }
+
+  time = StopTimer();
+  Report("etl::from_chars", time, total);
+
+  std::cout << "Double to text (shortest round trip)\n";
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    char buffer[40];
+    total += size_t(snprintf(buffer, sizeof(buffer), "%.17g", doubles[i]));
+  }
+
+  time = StopTimer();
+  Report("snprintf %.17g ", time, total);
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    double_texts[i].clear();
+    total += etl::to_chars(double_texts[i], doubles[i]).size();
+  }
+
+  time = StopTimer();
+  Report("etl::to_chars  ", time, total);
+
+  std::cout << "Text to double\n";
+
+  double sum = 0.0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    sum += strtod(double_texts[i].c_str(), 0) * 1e-300;
+  }
+
+  time = StopTimer();
+  Report("strtod         ", time, size_t(sum != 0.0));
+
+  sum = 0.0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    double value = 0.0;
+    etl::from_chars(double_texts[i], value);
+    sum += value * 1e-300;
+  }
+
+  time = StopTimer();
+  Report("etl::from_chars", time, size_t(sum != 0.0));
+
+  return 0;
+}
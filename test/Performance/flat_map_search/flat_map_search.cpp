@@ -0,0 +1,149 @@
+// flat_map_search.cpp : Compares the flat_map search policies.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src flat_map_search.cpp ../../../src/private/pvoidvector.cpp -o flat_map_search
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "flat_map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTSIZE = 100000;
+const size_t TESTLOOKUPS = 2000000;
+
+typedef etl::flat_map<uint32_t, uint32_t, TESTSIZE, std::less<uint32_t>, etl::binary_search_policy>        BinaryMap;
+typedef etl::flat_map<uint32_t, uint32_t, TESTSIZE, std::less<uint32_t>, etl::interpolation_search_policy> InterpolationMap;
+typedef etl::flat_map<uint32_t, uint32_t, TESTSIZE, std::less<uint32_t>, etl::exponential_search_policy>   ExponentialMap;
+
+BinaryMap        binary_map;
+InterpolationMap interpolation_map;
+ExponentialMap   exponential_map;
+
+std::vector<std::pair<uint32_t, uint32_t> > data;
+std::vector<uint32_t> lookups;
+
+//*****************************************************************************
+// Random lookups of keys in the map.
+//*****************************************************************************
+template <typename TMap>
+void TestFind(TMap& map, const char* name)
+{
+  map.clear();
+  map.insert_sorted(data.begin(), data.end());
+
+  uint32_t sum = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < lookups.size(); ++i)
+  {
+    typename TMap::iterator itr = map.find(lookups[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << " find   = " << time << "us (" << sum << ")\n";
+}
+
+//*****************************************************************************
+// Increasing keys, such as timestamps, inserted with a hint of end().
+//*****************************************************************************
+template <typename TMap>
+void TestAppend(TMap& map, const char* name)
+{
+  map.clear();
+
+  StartTimer();
+
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    map.insert(map.end(), data[i]);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << " append = " << time << "us (" << map.size() << ")\n";
+}
+
+//*****************************************************************************
+void Run(const char* title)
+{
+  std::sort(data.begin(), data.end());
+  data.erase(std::unique(data.begin(), data.end()), data.end());
+
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<size_t> index(0, data.size() - 1);
+
+  lookups.clear();
+
+  for (size_t i = 0; i < TESTLOOKUPS; ++i)
+  {
+    lookups.push_back(data[index(generator)].first);
+  }
+
+  std::cout << title << " (" << data.size() << " keys)\n";
+
+  TestFind(binary_map,        "Binary       ");
+  TestFind(interpolation_map, "Interpolation");
+  TestFind(exponential_map,   "Exponential  ");
+
+  TestAppend(binary_map,        "Binary       ");
+  TestAppend(interpolation_map, "Interpolation");
+  TestAppend(exponential_map,   "Exponential  ");
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 generator(0);
+
+  // Uniformly distributed IDs.
+  std::uniform_int_distribution<uint32_t> uniform(0, 0xFFFFFFFF);
+
+  data.clear();
+
+  for (size_t i = 0; i < TESTSIZE; ++i)
+  {
+    data.push_back(std::make_pair(uniform(generator), uint32_t(i)));
+  }
+
+  Run("Uniform");
+
+  // Skewed, clustered at the low end.
+  std::exponential_distribution<double> skewed(1.0 / 1000000.0);
+
+  data.clear();
+
+  for (size_t i = 0; i < TESTSIZE; ++i)
+  {
+    data.push_back(std::make_pair(uint32_t(std::min(skewed(generator), 4294967295.0)), uint32_t(i)));
+  }
+
+  Run("Skewed");
+
+  return 0;
+}
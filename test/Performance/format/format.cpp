@@ -0,0 +1,159 @@
+// format.cpp : Compares etl::format_to with snprintf into a buffer, followed
+// by an assign to an etl::string.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src format.cpp ../../../src/charconv.cpp -o format
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "format.h"
+#include "cstring.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t COUNT = 1000000;
+
+typedef etl::string<80> Text;
+
+//*****************************************************************************
+uint64_t NextRandom(uint64_t& state)
+{
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+
+  return state;
+}
+
+//*****************************************************************************
+void Report(const char* title, uint64_t time, size_t total)
+{
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<int>    integers;
+  std::vector<double> doubles;
+
+  uint64_t state = 0x0123456789ABCDEFULL;
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    integers.push_back(int(NextRandom(state) >> (32 + (i % 32))));
+    doubles.push_back(double(int64_t(NextRandom(state) >> 40)) / 1000.0);
+  }
+
+  Text text;
+  size_t total;
+  uint64_t time;
+
+  std::cout << "Integers and text\n";
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    char buffer[80];
+    snprintf(buffer, sizeof(buffer), "id=%d mask=%#010x name=%-8s", integers[i], unsigned(integers[i]), "sensor");
+    text.assign(buffer);
+    total += text.size();
+  }
+
+  time = StopTimer();
+  Report("snprintf      ", time, total);
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    text.clear();
+    etl::format_to(text, "id={} mask={:#010x} name={:<8}", integers[i], unsigned(integers[i]), "sensor");
+    total += text.size();
+  }
+
+  time = StopTimer();
+  Report("etl::format_to", time, total);
+
+  std::cout << "Fixed precision doubles\n";
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    char buffer[80];
+    snprintf(buffer, sizeof(buffer), "%.3f, %10.2e", doubles[i], doubles[i]);
+    text.assign(buffer);
+    total += text.size();
+  }
+
+  time = StopTimer();
+  Report("snprintf      ", time, total);
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    text.clear();
+    etl::format_to(text, "{:.3f}, {:10.2e}", doubles[i], doubles[i]);
+    total += text.size();
+  }
+
+  time = StopTimer();
+  Report("etl::format_to", time, total);
+
+  std::cout << "Shortest doubles\n";
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    char buffer[80];
+    snprintf(buffer, sizeof(buffer), "value=%.17g", doubles[i]);
+    text.assign(buffer);
+    total += text.size();
+  }
+
+  time = StopTimer();
+  Report("snprintf %.17g", time, total);
+
+  total = 0;
+  StartTimer();
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    text.clear();
+    etl::format_to(text, "value={}", doubles[i]);
+    total += text.size();
+  }
+
+  time = StopTimer();
+  Report("etl::format_to", time, total);
+
+  return 0;
+}
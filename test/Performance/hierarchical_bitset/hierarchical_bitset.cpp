@@ -0,0 +1,108 @@
+// hierarchical_bitset.cpp : Compares iterating the set bits of a sparse
+// 1M bit etl::hierarchical_bitset with etl::bitset::find_next.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src hierarchical_bitset.cpp -o hierarchical_bitset
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <iostream>
+#include <chrono>
+
+#include "bitset.h"
+#include "hierarchical_bitset.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t BITS      = 1000000;
+const size_t TESTLOOPS = 1000;
+
+etl::bitset<BITS>              flat;
+etl::hierarchical_bitset<BITS> hierarchical;
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function(i);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+void Fill(size_t step)
+{
+  flat.reset();
+  hierarchical.reset();
+
+  for (size_t i = step / 2; i < BITS; i += step)
+  {
+    flat.set(i);
+    hierarchical.set(i);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  const size_t steps[] = { 100000, 10000, 1000, 10 };
+
+  for (size_t s = 0; s < (sizeof(steps) / sizeof(steps[0])); ++s)
+  {
+    Fill(steps[s]);
+
+    std::cout << "Iterate " << hierarchical.count() << " set bits\n";
+
+    Run("etl::bitset             ", [](size_t)
+    {
+      size_t n = 0;
+
+      for (size_t i = flat.find_first(true); i != etl::ibitset::npos; i = flat.find_next(true, i + 1))
+      {
+        n += i;
+      }
+
+      return n;
+    });
+
+    Run("etl::hierarchical_bitset", [](size_t)
+    {
+      size_t n = 0;
+
+      for (etl::ihierarchical_bitset::const_iterator itr = hierarchical.begin(); itr != hierarchical.end(); ++itr)
+      {
+        n += *itr;
+      }
+
+      return n;
+    });
+  }
+
+  std::cout << "Memory\n";
+  std::cout << "  etl::bitset              : " << sizeof(flat) << " bytes\n";
+  std::cout << "  etl::hierarchical_bitset : " << sizeof(hierarchical) << " bytes\n";
+
+  return 0;
+}
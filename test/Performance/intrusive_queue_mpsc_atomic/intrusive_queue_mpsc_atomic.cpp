@@ -0,0 +1,216 @@
+// intrusive_queue_mpsc_atomic.cpp : Compares etl::intrusive_queue_mpsc_atomic
+// with a mutex protected etl::intrusive_queue, for 1 to N producer threads
+// posting to a single consumer.
+// The consumer either pops one value at a time, or drains the queue with pop_all.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -pthread -I../../../src intrusive_queue_mpsc_atomic.cpp -o intrusive_queue_mpsc_atomic
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+
+#include "intrusive_queue.h"
+#include "intrusive_queue_mpsc_atomic.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const uint32_t STREAMSIZE = 2000000;
+
+typedef etl::forward_link<0> Link;
+
+struct Message : public Link
+{
+  uint32_t value;
+};
+
+std::vector<Message> messages(STREAMSIZE);
+
+//*****************************************************************************
+// An etl::intrusive_queue protected by a mutex, with the same interface.
+//*****************************************************************************
+class intrusive_queue_mutex
+{
+public:
+
+  void push(Message& message)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.push(message);
+  }
+
+  Message* pop()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queue.empty())
+    {
+      return nullptr;
+    }
+
+    Message* p_message = &queue.front();
+    queue.pop();
+    return p_message;
+  }
+
+  template <typename TFunction>
+  size_t pop_all(TFunction function)
+  {
+    // Move the values to a local queue, then process them without the lock.
+    etl::intrusive_queue<Message, Link> local;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      while (!queue.empty())
+      {
+        Message& message = queue.front();
+        queue.pop();
+        local.push(message);
+      }
+    }
+
+    size_t count = 0;
+
+    while (!local.empty())
+    {
+      Message& message = local.front();
+      local.pop();
+      function(message);
+      ++count;
+    }
+
+    return count;
+  }
+
+private:
+
+  std::mutex                          mutex;
+  etl::intrusive_queue<Message, Link> queue;
+};
+
+typedef etl::intrusive_queue_mpsc_atomic<Message, Link> Mpsc;
+
+//*****************************************************************************
+struct Sum
+{
+  Sum(uint64_t& total_)
+    : total(total_)
+  {
+  }
+
+  void operator ()(Message& message)
+  {
+    total += message.value;
+  }
+
+  uint64_t& total;
+};
+
+//*****************************************************************************
+// Streams the messages from 'threads' producers to one consumer.
+//*****************************************************************************
+template <typename TQueue>
+void TestThroughput(const char* name, uint32_t threads, bool drain)
+{
+  TQueue queue;
+
+  std::vector<std::thread> producers;
+
+  const uint32_t per_producer = STREAMSIZE / threads;
+
+  StartTimer();
+
+  for (uint32_t p = 0; p < threads; ++p)
+  {
+    const uint32_t first = p * per_producer;
+    const uint32_t last  = (p == (threads - 1)) ? STREAMSIZE : first + per_producer;
+
+    producers.push_back(std::thread([&queue, first, last]()
+    {
+      for (uint32_t i = first; i < last; ++i)
+      {
+        messages[i].value = i;
+        queue.push(messages[i]);
+      }
+    }));
+  }
+
+  uint64_t total = 0;
+  uint32_t count = 0;
+
+  while (count < STREAMSIZE)
+  {
+    if (drain)
+    {
+      size_t n = queue.pop_all(Sum(total));
+
+      if (n == 0)
+      {
+        std::this_thread::yield();
+      }
+
+      count += uint32_t(n);
+    }
+    else
+    {
+      Message* p_message = queue.pop();
+
+      if (p_message == nullptr)
+      {
+        std::this_thread::yield();
+      }
+      else
+      {
+        total += p_message->value;
+        ++count;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < producers.size(); ++i)
+  {
+    producers[i].join();
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << (drain ? " pop_all " : " pop     ") << threads << "P/1C = " << (uint64_t(STREAMSIZE) * 1000) / (time + 1) << " kitems/s (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  uint32_t max_threads = std::thread::hardware_concurrency();
+
+  if (max_threads < 2)
+  {
+    max_threads = 2;
+  }
+
+  for (uint32_t threads = 1; threads <= max_threads; threads *= 2)
+  {
+    TestThroughput<Mpsc>("intrusive_queue_mpsc_atomic", threads, false);
+    TestThroughput<intrusive_queue_mutex>("intrusive_queue + mutex    ", threads, false);
+    TestThroughput<Mpsc>("intrusive_queue_mpsc_atomic", threads, true);
+    TestThroughput<intrusive_queue_mutex>("intrusive_queue + mutex    ", threads, true);
+  }
+
+  return 0;
+}
@@ -0,0 +1,160 @@
+// queue_mpmc_atomic.cpp : Compares etl::queue_mpmc_atomic with a mutex protected etl::queue,
+// for 1 to N producer and consumer threads.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -pthread -I../../../src queue_mpmc_atomic.cpp -o queue_mpmc_atomic
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <atomic>
+
+#include "queue.h"
+#include "queue_mpmc_atomic.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t   QUEUESIZE  = 1024;
+const uint32_t STREAMSIZE = 4000000;
+
+//*****************************************************************************
+// An etl::queue protected by a mutex, with the same interface.
+//*****************************************************************************
+template <typename T, const size_t SIZE>
+class queue_mutex
+{
+public:
+
+  bool try_push(const T& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queue.full())
+    {
+      return false;
+    }
+
+    queue.push(value);
+    return true;
+  }
+
+  bool try_pop(T& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queue.empty())
+    {
+      return false;
+    }
+
+    value = queue.front();
+    queue.pop();
+    return true;
+  }
+
+private:
+
+  std::mutex          mutex;
+  etl::queue<T, SIZE> queue;
+};
+
+//*****************************************************************************
+// Streams values from 'threads' producers to 'threads' consumers.
+//*****************************************************************************
+template <typename TQueue>
+void TestThroughput(const char* name, uint32_t threads)
+{
+  TQueue queue;
+
+  std::atomic<uint32_t> remaining(STREAMSIZE);
+  std::atomic<uint64_t> total(0);
+  std::vector<std::thread> workers;
+
+  const uint32_t per_producer = STREAMSIZE / threads;
+
+  StartTimer();
+
+  for (uint32_t p = 0; p < threads; ++p)
+  {
+    const uint32_t count = (p == 0) ? STREAMSIZE - (per_producer * (threads - 1)) : per_producer;
+
+    workers.push_back(std::thread([&queue, count]()
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        while (!queue.try_push(i)) { std::this_thread::yield(); }
+      }
+    }));
+  }
+
+  for (uint32_t c = 0; c < threads; ++c)
+  {
+    workers.push_back(std::thread([&]()
+    {
+      uint64_t sum = 0;
+      uint32_t value;
+
+      while (remaining.load(std::memory_order_relaxed) > 0)
+      {
+        if (queue.try_pop(value))
+        {
+          remaining.fetch_sub(1, std::memory_order_relaxed);
+          sum += value;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      total += sum;
+    }));
+  }
+
+  for (size_t i = 0; i < workers.size(); ++i)
+  {
+    workers[i].join();
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << " " << threads << "P/" << threads << "C = " << (uint64_t(STREAMSIZE) * 1000) / (time + 1) << " kitems/s (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef etl::queue_mpmc_atomic<uint32_t, QUEUESIZE> Mpmc;
+  typedef queue_mutex<uint32_t, QUEUESIZE>            Mutex;
+
+  uint32_t max_threads = std::thread::hardware_concurrency() / 2;
+
+  if (max_threads < 1)
+  {
+    max_threads = 1;
+  }
+
+  for (uint32_t threads = 1; threads <= max_threads; threads *= 2)
+  {
+    TestThroughput<Mpmc>("queue_mpmc_atomic", threads);
+    TestThroughput<Mutex>("queue + mutex    ", threads);
+  }
+
+  return 0;
+}
@@ -0,0 +1,260 @@
+// queue_spsc_atomic.cpp : Compares etl::queue_spsc_atomic with a mutex protected etl::queue.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -pthread -I../../../src queue_spsc_atomic.cpp -o queue_spsc_atomic
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <mutex>
+
+#include "queue.h"
+#include "queue_spsc_atomic.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t   QUEUESIZE  = 1024;
+const uint32_t ROUNDTRIPS = 200000;
+const uint32_t STREAMSIZE = 10000000;
+const size_t   BATCHSIZE  = 32;
+
+//*****************************************************************************
+// An etl::queue protected by a mutex, with the same interface.
+//*****************************************************************************
+template <typename T, const size_t SIZE>
+class queue_mutex
+{
+public:
+
+  bool push(const T& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queue.full())
+    {
+      return false;
+    }
+
+    queue.push(value);
+    return true;
+  }
+
+  bool pop(T& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queue.empty())
+    {
+      return false;
+    }
+
+    value = queue.front();
+    queue.pop();
+    return true;
+  }
+
+  template <typename TIterator>
+  size_t push(TIterator first, TIterator last)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    size_t count = 0;
+
+    while ((first != last) && !queue.full())
+    {
+      queue.push(*first++);
+      ++count;
+    }
+
+    return count;
+  }
+
+  template <typename TIterator>
+  size_t pop(TIterator destination, size_t n)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    size_t count = 0;
+
+    while ((count < n) && !queue.empty())
+    {
+      *destination++ = queue.front();
+      queue.pop();
+      ++count;
+    }
+
+    return count;
+  }
+
+private:
+
+  std::mutex              mutex;
+  etl::queue<T, SIZE> queue;
+};
+
+//*****************************************************************************
+// One value bounces between two threads. Measures the round trip latency.
+//*****************************************************************************
+template <typename TQueue>
+void TestPingPong(const char* name)
+{
+  TQueue ping;
+  TQueue pong;
+
+  std::thread echo([&]()
+  {
+    uint32_t value;
+
+    for (uint32_t i = 0; i < ROUNDTRIPS; ++i)
+    {
+      while (!ping.pop(value)) { std::this_thread::yield(); }
+      while (!pong.push(value)) { std::this_thread::yield(); }
+    }
+  });
+
+  StartTimer();
+
+  uint32_t value;
+
+  for (uint32_t i = 0; i < ROUNDTRIPS; ++i)
+  {
+    while (!ping.push(i)) { std::this_thread::yield(); }
+    while (!pong.pop(value)) { std::this_thread::yield(); }
+  }
+
+  uint64_t time = StopTimer();
+
+  echo.join();
+
+  std::cout << "  " << name << " round trip = " << (time * 1000) / ROUNDTRIPS << "ns\n";
+}
+
+//*****************************************************************************
+// Streams values from one thread to another, one at a time.
+//*****************************************************************************
+template <typename TQueue>
+void TestThroughput(const char* name)
+{
+  TQueue queue;
+
+  std::thread producer([&]()
+  {
+    for (uint32_t i = 0; i < STREAMSIZE; ++i)
+    {
+      while (!queue.push(i)) { std::this_thread::yield(); }
+    }
+  });
+
+  StartTimer();
+
+  uint64_t sum = 0;
+  uint32_t value;
+
+  for (uint32_t i = 0; i < STREAMSIZE; ++i)
+  {
+    while (!queue.pop(value)) { std::this_thread::yield(); }
+    sum += value;
+  }
+
+  uint64_t time = StopTimer();
+
+  producer.join();
+
+  std::cout << "  " << name << " single     = " << (uint64_t(STREAMSIZE) * 1000) / (time + 1) << " kitems/s (" << sum << ")\n";
+}
+
+//*****************************************************************************
+// Streams values from one thread to another, in batches.
+//*****************************************************************************
+template <typename TQueue>
+void TestBatchThroughput(const char* name)
+{
+  TQueue queue;
+
+  std::thread producer([&]()
+  {
+    uint32_t batch[BATCHSIZE];
+    uint32_t next = 0;
+
+    while (next < STREAMSIZE)
+    {
+      size_t n = std::min<size_t>(BATCHSIZE, STREAMSIZE - next);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        batch[i] = next + uint32_t(i);
+      }
+
+      size_t pushed = queue.push(batch, batch + n);
+
+      if (pushed == 0)
+      {
+        std::this_thread::yield();
+      }
+
+      next += uint32_t(pushed);
+    }
+  });
+
+  StartTimer();
+
+  uint64_t sum = 0;
+  uint32_t received = 0;
+  uint32_t batch[BATCHSIZE];
+
+  while (received < STREAMSIZE)
+  {
+    size_t n = queue.pop(batch, BATCHSIZE);
+
+    if (n == 0)
+    {
+      std::this_thread::yield();
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      sum += batch[i];
+    }
+
+    received += uint32_t(n);
+  }
+
+  uint64_t time = StopTimer();
+
+  producer.join();
+
+  std::cout << "  " << name << " batch      = " << (uint64_t(STREAMSIZE) * 1000) / (time + 1) << " kitems/s (" << sum << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef etl::queue_spsc_atomic<uint32_t, QUEUESIZE> Spsc;
+  typedef queue_mutex<uint32_t, QUEUESIZE>            Mutex;
+
+  std::cout << "Latency\n";
+  TestPingPong<Spsc>("queue_spsc_atomic");
+  TestPingPong<Mutex>("queue + mutex    ");
+
+  std::cout << "Throughput\n";
+  TestThroughput<Spsc>("queue_spsc_atomic");
+  TestThroughput<Mutex>("queue + mutex    ");
+  TestBatchThroughput<Spsc>("queue_spsc_atomic");
+  TestBatchThroughput<Mutex>("queue + mutex    ");
+
+  return 0;
+}
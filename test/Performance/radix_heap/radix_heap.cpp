@@ -0,0 +1,187 @@
+// radix_heap.cpp : Compares etl::radix_heap with etl::priority_queue for
+// Dijkstra's shortest path algorithm on a large random graph.
+//
+// Neither queue supports decrease-key, so a node is pushed again whenever its
+// distance improves, and stale entries are skipped when they reach the top.
+// Distances only increase as nodes are removed, so the radix heap may be used.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src radix_heap.cpp -o radix_heap
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include "radix_heap.h"
+#include "priority_queue.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const uint32_t NODES      = 200000;
+const uint32_t EDGES      = 8;
+const uint32_t MAX_WEIGHT = 10000;
+const uint32_t INFINITE   = 0xFFFFFFFF;
+
+// Every edge may push one entry, plus the source.
+const size_t   QUEUE_SIZE = (NODES * EDGES) + 1;
+
+struct Edge
+{
+  uint32_t to;
+  uint32_t weight;
+};
+
+std::vector<Edge>     edges;
+std::vector<uint32_t> distance;
+
+//*****************************************************************************
+// etl::radix_heap
+//*****************************************************************************
+etl::radix_heap<uint32_t, QUEUE_SIZE> heap;
+
+uint64_t TestRadixHeap()
+{
+  distance.assign(NODES, INFINITE);
+
+  StartTimer();
+
+  distance[0] = 0;
+  heap.push(0, 0);
+
+  while (!heap.empty())
+  {
+    uint32_t d    = heap.top_key();
+    uint32_t node = heap.top();
+    heap.pop();
+
+    if (d != distance[node])
+    {
+      continue;
+    }
+
+    const Edge* p_edge = &edges[node * EDGES];
+
+    for (uint32_t i = 0; i < EDGES; ++i, ++p_edge)
+    {
+      uint32_t nd = d + p_edge->weight;
+
+      if (nd < distance[p_edge->to])
+      {
+        distance[p_edge->to] = nd;
+        heap.push(nd, p_edge->to);
+      }
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "radix_heap     = " << time << "us\n";
+
+  uint64_t checksum = 0;
+
+  for (uint32_t i = 0; i < NODES; ++i)
+  {
+    checksum += distance[i];
+  }
+
+  return checksum;
+}
+
+//*****************************************************************************
+// etl::priority_queue
+//*****************************************************************************
+typedef std::pair<uint32_t, uint32_t> Entry;
+
+etl::priority_queue<Entry, QUEUE_SIZE, etl::vector<Entry, QUEUE_SIZE>, std::greater<Entry> > queue;
+
+uint64_t TestPriorityQueue()
+{
+  distance.assign(NODES, INFINITE);
+
+  StartTimer();
+
+  distance[0] = 0;
+  queue.push(Entry(0, 0));
+
+  while (!queue.empty())
+  {
+    uint32_t d    = queue.top().first;
+    uint32_t node = queue.top().second;
+    queue.pop();
+
+    if (d != distance[node])
+    {
+      continue;
+    }
+
+    const Edge* p_edge = &edges[node * EDGES];
+
+    for (uint32_t i = 0; i < EDGES; ++i, ++p_edge)
+    {
+      uint32_t nd = d + p_edge->weight;
+
+      if (nd < distance[p_edge->to])
+      {
+        distance[p_edge->to] = nd;
+        queue.push(Entry(nd, p_edge->to));
+      }
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "priority_queue = " << time << "us\n";
+
+  uint64_t checksum = 0;
+
+  for (uint32_t i = 0; i < NODES; ++i)
+  {
+    checksum += distance[i];
+  }
+
+  return checksum;
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<uint32_t> node(0, NODES - 1);
+  std::uniform_int_distribution<uint32_t> weight(1, MAX_WEIGHT);
+
+  for (size_t i = 0; i < (NODES * EDGES); ++i)
+  {
+    Edge edge = { node(generator), weight(generator) };
+    edges.push_back(edge);
+  }
+
+  std::cout << NODES << " nodes, " << EDGES << " edges per node\n";
+
+  uint64_t radix_checksum = TestRadixHeap();
+  uint64_t queue_checksum = TestPriorityQueue();
+
+  if (radix_checksum != queue_checksum)
+  {
+    std::cout << "Checksum mismatch\n";
+    return 1;
+  }
+
+  return 0;
+}
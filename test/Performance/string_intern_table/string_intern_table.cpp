@@ -0,0 +1,89 @@
+// string_intern_table.cpp : Compares looking up symbol names in an
+// etl::string_intern_table with an etl::flat_map keyed on etl::string<64>,
+// and the memory each uses.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src string_intern_table.cpp -o string_intern_table
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "cstring.h"
+#include "flat_map.h"
+#include "string_intern_table.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t SYMBOLS   = 2000;
+const size_t TESTLOOPS = 2000000;
+
+typedef etl::string<64>                         Symbol;
+typedef etl::flat_map<Symbol, size_t, SYMBOLS>  Map;
+typedef etl::string_intern_table<SYMBOLS, SYMBOLS * 24> Table;
+
+Map   map;
+Table table;
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function(i);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<Symbol> symbols;
+
+  char name[64];
+
+  for (size_t i = 0; i < SYMBOLS; ++i)
+  {
+    sprintf(name, "sensor.%u.reading_%u", unsigned(i % 37), unsigned(i));
+    symbols.push_back(Symbol(name));
+
+    map.insert(Map::value_type(symbols.back(), i));
+    table.intern(symbols.back());
+  }
+
+  std::cout << "Memory\n";
+  std::cout << "  etl::flat_map<etl::string<64>> : " << sizeof(Map) << " bytes\n";
+  std::cout << "  etl::string_intern_table       : " << sizeof(Table) << " bytes (" << table.bytes_used() << " arena bytes used)\n";
+
+  std::cout << "Symbol to ID (" << SYMBOLS << " symbols)\n";
+  Run("etl::flat_map           ", [&](size_t i) { return map.find(symbols[(i * 7919) % SYMBOLS])->second; });
+  Run("etl::string_intern_table", [&](size_t i) { return table.find(symbols[(i * 7919) % SYMBOLS]); });
+
+  std::cout << "ID to symbol\n";
+  Run("etl::string_intern_table", [&](size_t i) { return table.view((i * 7919) % SYMBOLS).size(); });
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+// string_search.cpp : Compares the etl::string searches with std::string and
+// with the previous implementations (std::search and nested loops).
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src string_search.cpp -o string_search
+// g++ -O2 -mavx2 -std=c++11 -I../../../src string_search.cpp -o string_search_avx2
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "cstring.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTLOOPS = 200000;
+
+// Read on every call, so that the searches cannot be hoisted out of the loop.
+volatile size_t start = 0;
+
+typedef etl::string<512> Text;
+
+//*****************************************************************************
+// The previous implementations.
+//*****************************************************************************
+size_t previous_find(const Text& text, const char* s, size_t position, size_t n)
+{
+  Text::const_iterator i = std::search(text.begin() + position, text.end(), s, s + n);
+
+  return (i == text.end()) ? Text::npos : size_t(i - text.begin());
+}
+
+size_t previous_rfind(const Text& text, const char* s, size_t position, size_t n)
+{
+  Text::const_reverse_iterator i = std::search(text.rbegin() + position, text.rend(), Text::const_reverse_iterator(s + n), Text::const_reverse_iterator(s));
+
+  return (i == text.rend()) ? Text::npos : text.size() - n - size_t(i - text.rbegin());
+}
+
+size_t previous_find_first_of(const Text& text, const char* s, size_t position, size_t n)
+{
+  for (size_t i = position; i < text.size(); ++i)
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      if (text[i] == s[j])
+      {
+        return i;
+      }
+    }
+  }
+
+  return Text::npos;
+}
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function();
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  // A text protocol message, with the field of interest at the end.
+  std::string message;
+
+  while (message.size() < 400)
+  {
+    message += "Content-Type: text/plain; charset=utf-8\r\nContent-Length: 1024\r\n";
+  }
+
+  message += "X-Request-Id: 12345\r\n\r\n";
+
+  const Text        text(message.c_str());
+  const std::string compare(message);
+
+  const char   needle[]  = "X-Request-Id";
+  const size_t length    = sizeof(needle) - 1;
+  const char   rneedle[] = "Content-Type";
+  const size_t rlength   = sizeof(rneedle) - 1;
+  const char   set[]     = "#@!$%&*[]{}<>|\\^~`";
+  const size_t slength   = sizeof(set) - 1;
+
+  std::cout << "find (" << text.size() << " characters)\n";
+  Run("etl      ", [&]() { return text.find(needle, start, length); });
+  Run("previous ", [&]() { return previous_find(text, needle, start, length); });
+  Run("std      ", [&]() { return compare.find(needle, start, length); });
+
+  std::cout << "rfind\n";
+  Run("etl      ", [&]() { return text.rfind(rneedle, Text::npos - start, rlength); });
+  Run("previous ", [&]() { return previous_rfind(text, rneedle, start, rlength); });
+  Run("std      ", [&]() { return compare.rfind(rneedle, std::string::npos - start, rlength); });
+
+  std::cout << "find_first_of (" << slength << " characters, not present)\n";
+  Run("etl      ", [&]() { return text.find_first_of(set, start, slength); });
+  Run("previous ", [&]() { return previous_find_first_of(text, set, start, slength); });
+  Run("std      ", [&]() { return compare.find_first_of(set, start, slength); });
+
+  return 0;
+}
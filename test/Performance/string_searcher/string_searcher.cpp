@@ -0,0 +1,146 @@
+// string_searcher.cpp : Compares the precomputed string searchers with
+// etl::string::find, searching log text for one pattern and for several.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src string_searcher.cpp -o string_searcher
+//
+
+#include <stdint.h>
+#include <string.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "cstring.h"
+#include "string_searcher.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTLOOPS = 20000;
+
+// Read on every call, so that the searches cannot be hoisted out of the loop.
+volatile size_t start = 0;
+
+typedef etl::string<8192> Text;
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function();
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+struct Counter
+{
+  Counter(size_t& count_)
+    : count(count_)
+  {
+  }
+
+  template <typename TMatch>
+  void operator ()(const TMatch&)
+  {
+    ++count;
+  }
+
+  size_t& count;
+};
+
+//*****************************************************************************
+int main()
+{
+  // Log text, with the line of interest at the end.
+  std::string log;
+
+  while (log.size() < 4000)
+  {
+    log += "2017-11-02 10:15:32.123 [worker-3] INFO  request completed in 12ms status=200 path=/api/v1/items\n";
+  }
+
+  log += "2017-11-02 10:15:32.456 [worker-1] ERROR connection reset by peer\n";
+
+  const Text text(log.c_str());
+
+  const char* const patterns[] = { "connection reset by peer", "out of memory", "segmentation fault", "deadline exceeded" };
+  const size_t      count      = sizeof(patterns) / sizeof(patterns[0]);
+
+  etl::boyer_moore_horspool_searcher<char, 32> searchers[count];
+  etl::aho_corasick_searcher<char, 128>        multi_searcher;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    searchers[i].assign(patterns[i], strlen(patterns[i]));
+    multi_searcher.add(patterns[i], strlen(patterns[i]));
+  }
+
+  multi_searcher.build();
+
+  std::cout << "One pattern (" << text.size() << " characters)\n";
+  Run("etl::string::find    ", [&]() { return text.find(patterns[0], start); });
+  Run("boyer_moore_horspool ", [&]() { return searchers[0].find(text, start); });
+
+  std::cout << "Four patterns, all occurrences\n";
+  Run("etl::string::find    ", [&]()
+  {
+    size_t matches = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      for (size_t position = text.find(patterns[i], start); position != Text::npos; position = text.find(patterns[i], position + 1))
+      {
+        ++matches;
+      }
+    }
+
+    return matches;
+  });
+
+  Run("boyer_moore_horspool ", [&]()
+  {
+    size_t matches = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      for (size_t position = searchers[i].find(text, start); position != Text::npos; position = searchers[i].find(text, position + 1))
+      {
+        ++matches;
+      }
+    }
+
+    return matches;
+  });
+
+  Run("aho_corasick         ", [&]()
+  {
+    size_t matches = 0;
+    multi_searcher.for_each_match(text.data() + start, text.data() + text.size(), Counter(matches));
+
+    return matches;
+  });
+
+  return 0;
+}
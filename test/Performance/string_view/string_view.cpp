@@ -0,0 +1,114 @@
+// string_view.cpp : Compares parsing header fields with etl::string_view
+// against copying them with etl::string::substr.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src string_view.cpp -o string_view
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+
+#include "cstring.h"
+#include "string_view.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTLOOPS = 200000;
+
+typedef etl::string<512> Text;
+
+//*****************************************************************************
+// Splits each "name: value\r\n" line, copying the name and value.
+//*****************************************************************************
+size_t ParseCopy(const Text& message)
+{
+  size_t total = 0;
+  size_t start = 0;
+
+  while (start < message.size())
+  {
+    size_t eol   = message.find("\r\n", start);
+    size_t colon = message.find(':', start);
+
+    Text name  = message.substr(start, colon - start);
+    Text value = message.substr(colon + 2, eol - colon - 2);
+
+    total += name.size() + value.size();
+    start  = eol + 2;
+  }
+
+  return total;
+}
+
+//*****************************************************************************
+// Splits each "name: value\r\n" line, viewing the name and value.
+//*****************************************************************************
+size_t ParseView(const Text& message)
+{
+  size_t total = 0;
+
+  etl::string_view remaining(message);
+
+  while (!remaining.empty())
+  {
+    size_t eol   = remaining.find("\r\n");
+    size_t colon = remaining.find(':');
+
+    etl::string_view name  = remaining.substr(0, colon);
+    etl::string_view value = remaining.substr(colon + 2, eol - colon - 2);
+
+    total += name.size() + value.size();
+    remaining.remove_prefix(eol + 2);
+  }
+
+  return total;
+}
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, const Text& message, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function(message);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  Text message;
+
+  message += "Host: www.example.com\r\n";
+  message += "Content-Type: text/plain; charset=utf-8\r\n";
+  message += "Content-Length: 1024\r\n";
+  message += "Accept: text/html,application/xhtml+xml\r\n";
+  message += "Cache-Control: no-cache\r\n";
+  message += "X-Request-Id: 12345\r\n";
+
+  Run("substr      ", message, ParseCopy);
+  Run("string_view ", message, ParseView);
+
+  return 0;
+}
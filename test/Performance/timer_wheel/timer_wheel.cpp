@@ -0,0 +1,266 @@
+// timer_wheel.cpp : Compares etl::timer_wheel with etl::priority_queue and
+// etl::indexed_priority_queue for a large number of connection timeouts.
+//
+// Each connection has a timeout that is re-armed whenever the connection is
+// active, and again whenever it expires.
+// With etl::priority_queue a re-armed timeout cannot be removed, so stale
+// entries are left in the queue and skipped when they reach the top.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src timer_wheel.cpp -o timer_wheel
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <functional>
+
+#include "timer_wheel.h"
+#include "priority_queue.h"
+#include "indexed_priority_queue.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t   CONNECTIONS     = 100000;
+const uint32_t TICKS           = 20000;
+const size_t   REARMS_PER_TICK = 50;
+const uint32_t MIN_DELAY       = 1000;
+const uint32_t MAX_DELAY       = 5000;
+
+// Enough for every connection, plus every stale entry that can be outstanding.
+const size_t   QUEUE_SIZE      = CONNECTIONS + (REARMS_PER_TICK * MAX_DELAY) + CONNECTIONS;
+
+std::vector<uint32_t> rearms;
+std::vector<uint32_t> delays;
+
+//*****************************************************************************
+// etl::timer_wheel
+//*****************************************************************************
+struct WheelConnection : public etl::timer_wheel_timer
+{
+  WheelConnection(etl::timer_wheel_callback& callback)
+    : etl::timer_wheel_timer(callback)
+  {
+  }
+};
+
+struct WheelExpired : public etl::timer_wheel_callback
+{
+  void operator ()(etl::timer_wheel_timer& timer)
+  {
+    ++expired;
+    p_wheel->schedule(timer, delays[next++ % delays.size()]);
+  }
+
+  etl::itimer_wheel* p_wheel;
+  size_t             expired;
+  size_t             next;
+};
+
+etl::timer_wheel<8, 3> wheel;
+
+void TestTimerWheel()
+{
+  WheelExpired callback;
+  callback.p_wheel = &wheel;
+  callback.expired = 0;
+  callback.next    = 0;
+
+  std::vector<WheelConnection*> connections;
+
+  for (size_t i = 0; i < CONNECTIONS; ++i)
+  {
+    connections.push_back(new WheelConnection(callback));
+  }
+
+  StartTimer();
+
+  size_t next = 0;
+
+  for (size_t i = 0; i < CONNECTIONS; ++i)
+  {
+    wheel.schedule(*connections[i], delays[next++ % delays.size()]);
+  }
+
+  for (uint32_t tick = 0; tick < TICKS; ++tick)
+  {
+    for (size_t i = 0; i < REARMS_PER_TICK; ++i)
+    {
+      wheel.schedule(*connections[rearms[(tick * REARMS_PER_TICK) + i]], delays[next++ % delays.size()]);
+    }
+
+    wheel.advance(1);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "timer_wheel            = " << time << "us (" << callback.expired << " expired)\n";
+
+  wheel.clear();
+
+  for (size_t i = 0; i < CONNECTIONS; ++i)
+  {
+    delete connections[i];
+  }
+}
+
+//*****************************************************************************
+// etl::priority_queue, with stale entries skipped.
+//*****************************************************************************
+struct Entry
+{
+  uint32_t expiry;
+  uint32_t connection;
+  uint32_t generation;
+
+  friend bool operator >(const Entry& lhs, const Entry& rhs)
+  {
+    return lhs.expiry > rhs.expiry;
+  }
+};
+
+etl::priority_queue<Entry, QUEUE_SIZE, etl::vector<Entry, QUEUE_SIZE>, std::greater<Entry> > queue;
+
+void TestPriorityQueue()
+{
+  std::vector<uint32_t> generations(CONNECTIONS, 0);
+  size_t   expired = 0;
+  size_t   next    = 0;
+  uint32_t now     = 0;
+
+  StartTimer();
+
+  for (uint32_t i = 0; i < CONNECTIONS; ++i)
+  {
+    Entry entry = { now + delays[next++ % delays.size()], i, 0 };
+    queue.push(entry);
+  }
+
+  for (uint32_t tick = 0; tick < TICKS; ++tick)
+  {
+    for (size_t i = 0; i < REARMS_PER_TICK; ++i)
+    {
+      uint32_t connection = rearms[(tick * REARMS_PER_TICK) + i];
+      Entry entry = { now + delays[next++ % delays.size()], connection, ++generations[connection] };
+      queue.push(entry);
+    }
+
+    ++now;
+
+    while (!queue.empty() && (queue.top().expiry <= now))
+    {
+      Entry entry = queue.top();
+      queue.pop();
+
+      if (entry.generation == generations[entry.connection])
+      {
+        ++expired;
+        Entry rearmed = { now + delays[next++ % delays.size()], entry.connection, ++generations[entry.connection] };
+        queue.push(rearmed);
+      }
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "priority_queue         = " << time << "us (" << expired << " expired)\n";
+
+  queue.clear();
+}
+
+//*****************************************************************************
+// etl::indexed_priority_queue, re-armed with update.
+//*****************************************************************************
+struct IndexedEntry
+{
+  uint32_t expiry;
+  uint32_t connection;
+
+  friend bool operator >(const IndexedEntry& lhs, const IndexedEntry& rhs)
+  {
+    return lhs.expiry > rhs.expiry;
+  }
+};
+
+etl::indexed_priority_queue<IndexedEntry, CONNECTIONS, std::greater<IndexedEntry> > indexed_queue;
+
+void TestIndexedPriorityQueue()
+{
+  std::vector<size_t> handles(CONNECTIONS);
+  size_t   expired = 0;
+  size_t   next    = 0;
+  uint32_t now     = 0;
+
+  StartTimer();
+
+  for (uint32_t i = 0; i < CONNECTIONS; ++i)
+  {
+    IndexedEntry entry = { now + delays[next++ % delays.size()], i };
+    handles[i] = indexed_queue.push(entry);
+  }
+
+  for (uint32_t tick = 0; tick < TICKS; ++tick)
+  {
+    for (size_t i = 0; i < REARMS_PER_TICK; ++i)
+    {
+      uint32_t connection = rearms[(tick * REARMS_PER_TICK) + i];
+      IndexedEntry entry = { now + delays[next++ % delays.size()], connection };
+      indexed_queue.update(handles[connection], entry);
+    }
+
+    ++now;
+
+    while (indexed_queue.top().expiry <= now)
+    {
+      ++expired;
+      IndexedEntry entry = { now + delays[next++ % delays.size()], indexed_queue.top().connection };
+      indexed_queue.update(indexed_queue.top_handle(), entry);
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "indexed_priority_queue = " << time << "us (" << expired << " expired)\n";
+
+  indexed_queue.clear();
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<uint32_t> connection(0, CONNECTIONS - 1);
+  std::uniform_int_distribution<uint32_t> delay(MIN_DELAY, MAX_DELAY);
+
+  for (size_t i = 0; i < (TICKS * REARMS_PER_TICK); ++i)
+  {
+    rearms.push_back(connection(generator));
+  }
+
+  for (size_t i = 0; i < 1000003; ++i)
+  {
+    delays.push_back(delay(generator));
+  }
+
+  std::cout << CONNECTIONS << " connections, " << TICKS << " ticks, " << REARMS_PER_TICK << " re-arms per tick\n";
+
+  TestTimerWheel();
+  TestPriorityQueue();
+  TestIndexedPriorityQueue();
+
+  return 0;
+}
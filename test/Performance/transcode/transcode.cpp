@@ -0,0 +1,164 @@
+// transcode.cpp : Compares etl::transcode with a per code point loop, for
+// UTF-8 to UTF-16 and UTF-16 to UTF-8.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src transcode.cpp -o transcode
+// g++ -O2 -std=c++11 -DETL_NO_SIMD -I../../../src transcode.cpp -o transcode_no_simd
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "cstring.h"
+#include "u16string.h"
+#include "transcode.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTLOOPS = 100000;
+
+typedef etl::string<1024>    Utf8;
+typedef etl::u16string<1024> Utf16;
+
+//*****************************************************************************
+// A typical per code point conversion, one push_back at a time.
+//*****************************************************************************
+void loop_utf8_to_utf16(Utf16& destination, const Utf8& source)
+{
+  size_t i = 0;
+
+  while (i < source.size())
+  {
+    uint32_t c = uint8_t(source[i]);
+    size_t length = (c < 0x80) ? 1 : ((c < 0xE0) ? 2 : ((c < 0xF0) ? 3 : 4));
+
+    if (length > 1)
+    {
+      c &= (0xFF >> (length + 1));
+
+      for (size_t j = 1; j < length; ++j)
+      {
+        c = (c << 6) | (uint8_t(source[i + j]) & 0x3F);
+      }
+    }
+
+    if (c < 0x10000)
+    {
+      destination.push_back(char16_t(c));
+    }
+    else
+    {
+      destination.push_back(char16_t(0xD800 + ((c - 0x10000) >> 10)));
+      destination.push_back(char16_t(0xDC00 + ((c - 0x10000) & 0x3FF)));
+    }
+
+    i += length;
+  }
+}
+
+void loop_utf16_to_utf8(Utf8& destination, const Utf16& source)
+{
+  size_t i = 0;
+
+  while (i < source.size())
+  {
+    uint32_t c = source[i++];
+
+    if ((c >= 0xD800) && (c < 0xDC00))
+    {
+      c = 0x10000 + ((c - 0xD800) << 10) + (source[i++] - 0xDC00);
+    }
+
+    if (c < 0x80)
+    {
+      destination.push_back(char(c));
+    }
+    else if (c < 0x800)
+    {
+      destination.push_back(char(0xC0 | (c >> 6)));
+      destination.push_back(char(0x80 | (c & 0x3F)));
+    }
+    else if (c < 0x10000)
+    {
+      destination.push_back(char(0xE0 | (c >> 12)));
+      destination.push_back(char(0x80 | ((c >> 6) & 0x3F)));
+      destination.push_back(char(0x80 | (c & 0x3F)));
+    }
+    else
+    {
+      destination.push_back(char(0xF0 | (c >> 18)));
+      destination.push_back(char(0x80 | ((c >> 12) & 0x3F)));
+      destination.push_back(char(0x80 | ((c >> 6) & 0x3F)));
+      destination.push_back(char(0x80 | (c & 0x3F)));
+    }
+  }
+}
+
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* title, TFunction function)
+{
+  size_t total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTLOOPS; ++i)
+  {
+    total += function();
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << title << " : " << time << "us (" << total << ")\n";
+}
+
+//*****************************************************************************
+void Compare(const char* title, const Utf8& utf8)
+{
+  Utf16 utf16;
+  etl::transcode(utf16, utf8);
+
+  Utf16 wide;
+  Utf8  narrow;
+
+  std::cout << title << " (" << utf8.size() << " bytes)\n";
+  std::cout << " UTF-8 to UTF-16\n";
+  Run("loop          ", [&]() { wide.clear(); loop_utf8_to_utf16(wide, utf8); return wide.size(); });
+  Run("etl::transcode", [&]() { wide.clear(); etl::transcode(wide, utf8); return wide.size(); });
+
+  std::cout << " UTF-16 to UTF-8\n";
+  Run("loop          ", [&]() { narrow.clear(); loop_utf16_to_utf8(narrow, utf16); return narrow.size(); });
+  Run("etl::transcode", [&]() { narrow.clear(); etl::transcode(narrow, utf16); return narrow.size(); });
+}
+
+//*****************************************************************************
+int main()
+{
+  std::string ascii;
+  std::string mixed;
+
+  while (ascii.size() < 900)
+  {
+    ascii += "{\"sensor\":\"temperature\",\"value\":21.5,\"unit\":\"C\"} ";
+    mixed += "{\"capteur\":\"temp\xC3\xA9rature\",\"valeur\":21,5,\"unit\xC3\xA9\":\"\xC2\xB0" "C\"} \xE2\x9C\x93 ";
+  }
+
+  Compare("ASCII JSON", Utf8(ascii.c_str()));
+  Compare("Mixed text", Utf8(mixed.substr(0, 900).c_str()));
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+// unrolled_list.cpp : Compares etl::unrolled_list with etl::list and etl::vector.
+//
+// Build with, for example:
+// g++ -O2 -std=c++11 -I../../../src unrolled_list.cpp -o unrolled_list
+//
+
+#include <stdint.h>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "list.h"
+#include "unrolled_list.h"
+#include "vector.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+const size_t TESTSIZE    = 100000;
+const size_t TESTLOOPS   = 100;
+const size_t TESTINSERTS = 2000;
+
+etl::list<uint32_t, TESTSIZE>              list;
+etl::unrolled_list<uint32_t, TESTSIZE, 16> unrolled_list16;
+etl::unrolled_list<uint32_t, TESTSIZE, 64> unrolled_list64;
+etl::vector<uint32_t, TESTSIZE>            vector;
+
+std::vector<size_t> positions;
+
+//*****************************************************************************
+// Fills the container with push_back.
+//*****************************************************************************
+template <typename TContainer>
+void TestPushBack(TContainer& container, const char* name)
+{
+  container.clear();
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTSIZE; ++i)
+  {
+    container.push_back(uint32_t(i));
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << " push_back = " << time << "us\n";
+}
+
+//*****************************************************************************
+// Sums the container, many times.
+//*****************************************************************************
+template <typename TContainer>
+void TestIterate(TContainer& container, const char* name)
+{
+  uint64_t sum = 0;
+
+  StartTimer();
+
+  for (size_t loop = 0; loop < TESTLOOPS; ++loop)
+  {
+    for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+    {
+      sum += *itr;
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << " iterate   = " << time << "us (" << sum << ")\n";
+}
+
+//*****************************************************************************
+// Inserts at random positions, after erasing enough space.
+// Includes the walk to the position for the lists.
+//*****************************************************************************
+template <typename TContainer>
+void TestInsert(TContainer& container, const char* name)
+{
+  container.resize(TESTSIZE - TESTINSERTS);
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTINSERTS; ++i)
+  {
+    typename TContainer::iterator itr = container.begin();
+    std::advance(itr, positions[i] % container.size());
+    container.insert(itr, uint32_t(i));
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << "  " << name << " insert    = " << time << "us (" << container.size() << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<size_t> distribution(0, TESTSIZE);
+
+  for (size_t i = 0; i < TESTINSERTS; ++i)
+  {
+    positions.push_back(distribution(generator));
+  }
+
+  std::cout << TESTSIZE << " uint32_t elements\n";
+
+  TestPushBack(list,            "list            ");
+  TestPushBack(unrolled_list16, "unrolled_list 16");
+  TestPushBack(unrolled_list64, "unrolled_list 64");
+  TestPushBack(vector,          "vector          ");
+
+  TestIterate(list,            "list            ");
+  TestIterate(unrolled_list16, "unrolled_list 16");
+  TestIterate(unrolled_list64, "unrolled_list 64");
+  TestIterate(vector,          "vector          ");
+
+  TestInsert(list,            "list            ");
+  TestInsert(unrolled_list16, "unrolled_list 16");
+  TestInsert(unrolled_list64, "unrolled_list 64");
+  TestInsert(vector,          "vector          ");
+
+  return 0;
+}
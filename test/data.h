@@ -31,6 +31,8 @@ SOFTWARE.
 
 #include <ostream>
 
+#include "type_traits.h"
+
 //*****************************************************************************
 // Default constructor.
 //*****************************************************************************
@@ -130,4 +132,59 @@ std::ostream& operator << (std::ostream& s, const TestDataNDC<T>& rhs)
   return s;
 }
 
+//*****************************************************************************
+// Owns a heap allocated value, so is not trivial, but may be relocated.
+//*****************************************************************************
+class TestDataRelocatable
+{
+public:
+
+  TestDataRelocatable(int value)
+    : p_value(new int(value))
+  {
+  }
+
+  TestDataRelocatable(const TestDataRelocatable& other)
+    : p_value(new int(*other.p_value))
+  {
+  }
+
+  TestDataRelocatable& operator = (const TestDataRelocatable& other)
+  {
+    *p_value = *other.p_value;
+    return *this;
+  }
+
+  ~TestDataRelocatable()
+  {
+    delete p_value;
+  }
+
+  int* p_value;
+};
+
+inline bool operator == (const TestDataRelocatable& lhs, const TestDataRelocatable& rhs)
+{
+  return *lhs.p_value == *rhs.p_value;
+}
+
+inline bool operator != (const TestDataRelocatable& lhs, const TestDataRelocatable& rhs)
+{
+  return *lhs.p_value != *rhs.p_value;
+}
+
+inline std::ostream& operator << (std::ostream& s, const TestDataRelocatable& rhs)
+{
+  s << *rhs.p_value;
+  return s;
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<TestDataRelocatable> : etl::true_type
+  {
+  };
+}
+
 #endif
\ No newline at end of file
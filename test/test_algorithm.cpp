@@ -36,12 +36,93 @@ SOFTWARE.
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <random>
+#include <limits>
 
 namespace
 {
   typedef std::vector<int> Data;
   Data data = { 2, 1, 4, 3, 6, 5, 8, 7, 10, 9 };
 
+  //***************************************************************************
+  // Compares the contiguous range algorithms with std, for all range lengths
+  // and offsets up to 100 elements.
+  //***************************************************************************
+  template <typename T>
+  bool check_contiguous()
+  {
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> small(0, 7);
+
+    std::vector<T> values(100);
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      switch (small(generator))
+      {
+        case 0:  values[i] = std::numeric_limits<T>::min(); break;
+        case 1:  values[i] = std::numeric_limits<T>::max(); break;
+        default: values[i] = T(small(generator)); break;
+      }
+    }
+
+    std::vector<T> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+
+    for (size_t first = 0; first < 8; ++first)
+    {
+      for (size_t last = first; last <= values.size(); ++last)
+      {
+        const T* begin = values.data() + first;
+        const T* end   = values.data() + last;
+
+        std::pair<const T*, const T*> expected = std::minmax_element(begin, end);
+        std::pair<const T*, const T*> result   = etl::minmax_element(begin, end);
+
+        // std returns the last maximum, etl the first.
+        if ((result.first != expected.first) || ((begin != end) && (result.second != std::find(begin, end, *expected.second))))
+        {
+          return false;
+        }
+
+        for (T value = 0; value < 8; ++value)
+        {
+          if ((etl::find(begin, end, value) != std::find(begin, end, value)) ||
+              (etl::count(begin, end, value) != std::count(begin, end, value)))
+          {
+            return false;
+          }
+        }
+
+        if (etl::is_sorted_until(begin, end) != std::is_sorted_until(begin, end))
+        {
+          return false;
+        }
+
+        // Sorted, with one element out of place.
+        std::vector<T> unsorted(sorted.begin() + first, sorted.begin() + last);
+
+        if (etl::is_sorted_until(unsorted.data(), unsorted.data() + unsorted.size()) != unsorted.data() + unsorted.size())
+        {
+          return false;
+        }
+
+        if (unsorted.size() > 1)
+        {
+          size_t position = last % unsorted.size();
+          unsorted[position] = (position == 0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+
+          if (etl::is_sorted_until(unsorted.data(), unsorted.data() + unsorted.size()) != std::is_sorted_until(unsorted.data(), unsorted.data() + unsorted.size()))
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_algorithm)
   {
     //=========================================================================
@@ -442,6 +523,41 @@ namespace
       CHECK_EQUAL(expected, result);
     }
 
+    //=========================================================================
+    TEST(find)
+    {
+      int data1[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+      std::list<int> data2(std::begin(data1), std::end(data1));
+
+      CHECK(etl::find(std::begin(data1), std::end(data1), 7) == std::begin(data1) + 6);
+      CHECK(etl::find(std::begin(data1), std::end(data1), 11) == std::end(data1));
+      CHECK(etl::find(data2.begin(), data2.end(), 7) == std::find(data2.begin(), data2.end(), 7));
+    }
+
+    //=========================================================================
+    TEST(count)
+    {
+      int data1[] = { 1, 2, 3, 1, 5, 6, 1, 8, 9, 1 };
+      std::list<int> data2(std::begin(data1), std::end(data1));
+
+      CHECK_EQUAL(4, etl::count(std::begin(data1), std::end(data1), 1));
+      CHECK_EQUAL(0, etl::count(std::begin(data1), std::end(data1), 4));
+      CHECK_EQUAL(4, etl::count(data2.begin(), data2.end(), 1));
+    }
+
+    //=========================================================================
+    TEST(contiguous_integral_ranges)
+    {
+      CHECK(check_contiguous<char>());
+      CHECK(check_contiguous<int8_t>());
+      CHECK(check_contiguous<uint8_t>());
+      CHECK(check_contiguous<int16_t>());
+      CHECK(check_contiguous<uint16_t>());
+      CHECK(check_contiguous<int32_t>());
+      CHECK(check_contiguous<uint32_t>());
+      CHECK(check_contiguous<int64_t>());
+    }
+
     struct Compare : public std::binary_function < int, int, bool >
     {
       bool operator()(int a, int b) const
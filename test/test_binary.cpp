@@ -64,6 +64,44 @@ size_t test_parity(T value)
   return count & 1;
 }
 
+// Count leading zeros the easy way.
+template <typename T>
+size_t test_leading_zeros(T value)
+{
+  size_t count = 0;
+
+  for (int i = etl::integral_limits<T>::bits - 1; i >= 0; --i)
+  {
+    if ((value & (T(1) << i)) != 0)
+    {
+      break;
+    }
+
+    ++count;
+  }
+
+  return count;
+}
+
+// Count trailing zeros the easy way.
+template <typename T>
+size_t test_trailing_zeros(T value)
+{
+  size_t count = 0;
+
+  for (int i = 0; i < etl::integral_limits<T>::bits; ++i)
+  {
+    if ((value & (T(1) << i)) != 0)
+    {
+      break;
+    }
+
+    ++count;
+  }
+
+  return count;
+}
+
 // Power of 2.
 uint64_t test_power_of_2(int power)
 {
@@ -735,6 +773,136 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros_8)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint8_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_leading_zeros(uint8_t(i)), etl::count_leading_zeros(uint8_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_leading_zeros_16)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint16_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_leading_zeros(uint16_t(i)), etl::count_leading_zeros(uint16_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_leading_zeros_32)
+    {
+      CHECK_EQUAL(32, etl::count_leading_zeros(uint32_t(0)));
+
+      for (int shift = 0; shift < 32; ++shift)
+      {
+        uint32_t value = uint32_t(1) << shift;
+
+        CHECK_EQUAL(test_leading_zeros(value), etl::count_leading_zeros(value));
+        CHECK_EQUAL(test_leading_zeros(value | 1), etl::count_leading_zeros(value | 1));
+      }
+
+      etl::fnv_1a_32 hash;
+
+      for (size_t i = 0; i < 100000; ++i)
+      {
+        hash.add(1);
+
+        uint32_t value = hash.value() >> (i % 32);
+
+        CHECK_EQUAL(test_leading_zeros(value), etl::count_leading_zeros(value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_leading_zeros_64)
+    {
+      CHECK_EQUAL(64, etl::count_leading_zeros(uint64_t(0)));
+
+      for (int shift = 0; shift < 64; ++shift)
+      {
+        uint64_t value = uint64_t(1) << shift;
+
+        CHECK_EQUAL(test_leading_zeros(value), etl::count_leading_zeros(value));
+        CHECK_EQUAL(test_leading_zeros(value | 1), etl::count_leading_zeros(value | 1));
+      }
+
+      etl::fnv_1a_64 hash;
+
+      for (size_t i = 0; i < 100000; ++i)
+      {
+        hash.add(1);
+
+        uint64_t value = hash.value() >> (i % 64);
+
+        CHECK_EQUAL(test_leading_zeros(value), etl::count_leading_zeros(value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_8)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint8_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_trailing_zeros(uint8_t(i)), etl::count_trailing_zeros(uint8_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_16)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint16_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_trailing_zeros(uint16_t(i)), etl::count_trailing_zeros(uint16_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_32)
+    {
+      CHECK_EQUAL(32, etl::count_trailing_zeros(uint32_t(0)));
+
+      etl::fnv_1a_32 hash;
+
+      for (size_t i = 0; i < 100000; ++i)
+      {
+        hash.add(1);
+
+        uint32_t value = hash.value() << (i % 32);
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_64)
+    {
+      CHECK_EQUAL(64, etl::count_trailing_zeros(uint64_t(0)));
+
+      for (int shift = 0; shift < 64; ++shift)
+      {
+        uint64_t value = uint64_t(1) << shift;
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+        value |= uint64_t(0x8000000000000000ULL);
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+      }
+
+      etl::fnv_1a_64 hash;
+
+      for (size_t i = 0; i < 100000; ++i)
+      {
+        hash.add(1);
+
+        uint64_t value = hash.value() << (i % 64);
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+      }
+    }
+
     //*************************************************************************
     TEST(test_parity_8)
     {
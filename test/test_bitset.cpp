@@ -777,6 +777,121 @@ namespace
       CHECK_EQUAL(4U, data.find_next(true,  1));
     }
 
+    //*************************************************************************
+    TEST(test_find_next_big_bitset)
+    {
+      std::bitset<1000> compare;
+      etl::bitset<1000> data;
+
+      const size_t positions[] = { 0, 1, 63, 64, 65, 127, 128, 500, 998, 999 };
+
+      for (size_t i = 0; i < (sizeof(positions) / sizeof(positions[0])); ++i)
+      {
+        compare.set(positions[i]);
+        data.set(positions[i]);
+      }
+
+      for (int state = 0; state < 2; ++state)
+      {
+        for (size_t position = 0; position <= data.size(); ++position)
+        {
+          size_t expected = size_t(etl::ibitset::npos);
+
+          for (size_t i = position; i < compare.size(); ++i)
+          {
+            if (compare.test(i) == (state != 0))
+            {
+              expected = i;
+              break;
+            }
+          }
+
+          CHECK_EQUAL(expected, data.find_next(state != 0, position));
+        }
+      }
+
+      data.reset();
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(true));
+      CHECK_EQUAL(0U, data.find_first(false));
+
+      data.set();
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(false));
+      CHECK_EQUAL(999U, data.find_next(true, 999));
+    }
+
+    //*************************************************************************
+    TEST(test_shift_big_bitset)
+    {
+      const size_t shifts[] = { 0, 1, 7, 8, 31, 32, 63, 64, 65, 128, 200, 999, 1000, 2000 };
+
+      for (size_t s = 0; s < (sizeof(shifts) / sizeof(shifts[0])); ++s)
+      {
+        std::bitset<1000> compare;
+        etl::bitset<1000> data;
+
+        for (size_t i = 0; i < data.size(); i += 3)
+        {
+          compare.set(i);
+          data.set(i);
+        }
+
+        compare.set(999);
+        data.set(999);
+
+        std::bitset<1000> compare_left  = compare << shifts[s];
+        std::bitset<1000> compare_right = compare >> shifts[s];
+        etl::bitset<1000> data_left     = data << shifts[s];
+        etl::bitset<1000> data_right    = data >> shifts[s];
+
+        CHECK_EQUAL(compare_left.count(),  data_left.count());
+        CHECK_EQUAL(compare_right.count(), data_right.count());
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          CHECK_EQUAL(compare_left.test(i),  data_left.test(i));
+          CHECK_EQUAL(compare_right.test(i), data_right.test(i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_shift_small_bitset_clears_unused_bits)
+    {
+      etl::bitset<6> data("111111");
+
+      data <<= 2;
+
+      CHECK_EQUAL(4U, data.count());
+      CHECK(data == etl::bitset<6>("111100"));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next(true, 6));
+    }
+
+    //*************************************************************************
+    TEST(test_count_big_bitset)
+    {
+      std::bitset<65536> compare;
+      etl::bitset<65536> data;
+
+      for (size_t i = 0; i < data.size(); i += 7)
+      {
+        compare.set(i);
+        data.set(i);
+      }
+
+      CHECK_EQUAL(compare.count(), data.count());
+      CHECK(data.any());
+      CHECK(!data.none());
+
+      data.reset();
+      CHECK_EQUAL(0U, data.count());
+      CHECK(!data.any());
+      CHECK(data.none());
+
+      data.set();
+      CHECK_EQUAL(65536U, data.count());
+      CHECK(data.all());
+    }
+
 
     //*************************************************************************
     TEST(test_swap)
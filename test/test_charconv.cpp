@@ -0,0 +1,836 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <limits>
+#include <cmath>
+
+#include "charconv.h"
+#include "cstring.h"
+#include "wstring.h"
+#include "u16string.h"
+#include "u32string.h"
+#include "string_view.h"
+
+namespace
+{
+  typedef etl::string<80> Text;
+
+  //***************************************************************************
+  // A pseudo random 64 bit sequence.
+  //***************************************************************************
+  uint64_t next_random(uint64_t& state)
+  {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+  }
+
+  double random_double(uint64_t& state)
+  {
+    double value;
+
+    do
+    {
+      uint64_t bits = next_random(state);
+      memcpy(&value, &bits, sizeof(value));
+    } while (value != value || (value - value) != 0.0); // Not NaN or infinity.
+
+    return value;
+  }
+
+  //***************************************************************************
+  // The shortest "%.*g" output that reads back as the value, for comparison.
+  //***************************************************************************
+  size_t shortest_digits(double value)
+  {
+    char buffer[40];
+
+    for (int precision = 1; precision <= 17; ++precision)
+    {
+      snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, value);
+
+      if (strtod(buffer, 0) == value)
+      {
+        return size_t(precision);
+      }
+    }
+
+    return 17;
+  }
+
+  size_t count_digits(const Text& text)
+  {
+    // Significant digits, before any exponent.
+    size_t count = 0;
+    bool leading = true;
+
+    for (size_t i = 0; (i < text.size()) && (text[i] != 'e'); ++i)
+    {
+      if ((text[i] >= '0') && (text[i] <= '9'))
+      {
+        if ((text[i] != '0') || !leading)
+        {
+          leading = false;
+          ++count;
+        }
+      }
+    }
+
+    // Trailing zeros of an integer are not significant.
+    if (text.find('.') == Text::npos && text.find('e') == Text::npos)
+    {
+      size_t i = text.size();
+
+      while ((i > 0) && (text[i - 1] == '0') && (count > 1))
+      {
+        --i;
+        --count;
+      }
+    }
+
+    return count;
+  }
+
+  SUITE(test_charconv)
+  {
+    //*************************************************************************
+    TEST(test_to_chars_integral_decimal)
+    {
+      Text text;
+
+      CHECK(Text("0") == etl::to_chars(text, 0));
+
+      text.clear();
+      CHECK(Text("7") == etl::to_chars(text, 7));
+
+      text.clear();
+      CHECK(Text("42") == etl::to_chars(text, 42));
+
+      text.clear();
+      CHECK(Text("-123") == etl::to_chars(text, -123));
+
+      text.clear();
+      CHECK(Text("1234567890") == etl::to_chars(text, 1234567890));
+
+      text.clear();
+      CHECK(Text("-128") == etl::to_chars(text, int8_t(-128)));
+
+      text.clear();
+      CHECK(Text("255") == etl::to_chars(text, uint8_t(255)));
+
+      text.clear();
+      CHECK(Text("-32768") == etl::to_chars(text, int16_t(-32768)));
+
+      text.clear();
+      CHECK(Text("-2147483648") == etl::to_chars(text, std::numeric_limits<int32_t>::min()));
+
+      text.clear();
+      CHECK(Text("18446744073709551615") == etl::to_chars(text, std::numeric_limits<uint64_t>::max()));
+
+      text.clear();
+      CHECK(Text("-9223372036854775808") == etl::to_chars(text, std::numeric_limits<int64_t>::min()));
+
+      // Appends.
+      text.assign("x=");
+      CHECK(Text("x=100") == etl::to_chars(text, 100));
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_integral_matches_snprintf)
+    {
+      uint64_t state = 0x123456789ABCDEFULL;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        const uint64_t u = next_random(state) >> (i % 64);
+        const int64_t  s = int64_t(next_random(state)) >> (i % 64);
+
+        char expected[32];
+        Text text;
+
+        snprintf(expected, sizeof(expected), "%llu", (unsigned long long)u);
+        CHECK(Text(expected) == etl::to_chars(text, u));
+
+        text.clear();
+        snprintf(expected, sizeof(expected), "%lld", (long long)s);
+        CHECK(Text(expected) == etl::to_chars(text, s));
+
+        text.clear();
+        snprintf(expected, sizeof(expected), "%llx", (unsigned long long)u);
+        CHECK(Text(expected) == etl::to_chars(text, u, etl::radix::hex));
+
+        text.clear();
+        snprintf(expected, sizeof(expected), "%llo", (unsigned long long)u);
+        CHECK(Text(expected) == etl::to_chars(text, u, etl::radix::octal));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_integral_radix)
+    {
+      Text text;
+
+      CHECK(Text("101010") == etl::to_chars(text, 42, etl::radix::binary));
+
+      text.clear();
+      CHECK(Text("52") == etl::to_chars(text, 42, etl::radix::octal));
+
+      text.clear();
+      CHECK(Text("2a") == etl::to_chars(text, 42, etl::radix::hex));
+
+      text.clear();
+      CHECK(Text("-ff") == etl::to_chars(text, -255, etl::radix::hex));
+
+      text.clear();
+      CHECK(Text("11111111") == etl::to_chars(text, uint8_t(255), etl::radix::binary));
+
+      text.clear();
+      CHECK(Text("-10000000") == etl::to_chars(text, int8_t(-128), etl::radix::binary));
+
+      text.clear();
+      CHECK(Text("0") == etl::to_chars(text, 0, etl::radix::binary));
+
+      text.clear();
+      CHECK(Text("42") == etl::to_chars(text, 42, etl::radix::undefined));
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_truncates)
+    {
+      etl::string<4> text;
+
+      etl::to_chars(text, 123456);
+
+      CHECK(etl::string<4>("1234") == text);
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_character_widths)
+    {
+      etl::wstring<20>   wtext;
+      etl::u16string<20> u16text;
+      etl::u32string<20> u32text;
+
+      CHECK(etl::wstring<20>(L"-1234") == etl::to_chars(wtext, -1234));
+      CHECK(etl::u16string<20>(u"ff") == etl::to_chars(u16text, 255, etl::radix::hex));
+      CHECK(etl::u32string<20>(U"0.5") == etl::to_chars(u32text, 0.5));
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_integral)
+    {
+      const char* text = "12345xyz";
+      int value = 0;
+
+      etl::from_chars_result<char> result = etl::from_chars(text, text + strlen(text), value);
+
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(12345, value);
+      CHECK(result.ptr == text + 5);
+
+      Text number("-2147483648");
+      result = etl::from_chars(number, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<int32_t>::min(), value);
+      CHECK(result.ptr == number.data() + number.size());
+
+      etl::string_view view("ff7f");
+      uint16_t u16 = 0;
+      result = etl::from_chars(view, u16, etl::radix::hex);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(0xFF7F, u16);
+
+      view = "FF7F";
+      result = etl::from_chars(view, u16, etl::radix::hex);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(0xFF7F, u16);
+
+      view = "1012";
+      uint8_t u8 = 0;
+      result = etl::from_chars(view, u8, etl::radix::binary);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(5, u8);
+      CHECK(result.ptr == view.data() + 3);
+
+      view = "777";
+      result = etl::from_chars(view, u16, etl::radix::octal);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(511, u16);
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_integral_errors)
+    {
+      int8_t   value = 1;
+      uint32_t u32   = 1;
+
+      etl::string_view view("");
+      etl::from_chars_result<char> result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+      CHECK(result.ptr == view.data());
+
+      view = "+1";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+
+      view = "-";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+      CHECK(result.ptr == view.data());
+
+      // No sign for unsigned types.
+      view = "-1";
+      result = etl::from_chars(view, u32);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+
+      // Out of range consumes all of the digits.
+      view = "128,";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+      CHECK(result.ptr == view.data() + 3);
+
+      view = "-129";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+
+      view = "4294967296";
+      result = etl::from_chars(view, u32);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+
+      CHECK_EQUAL(1, value);
+      CHECK_EQUAL(1U, u32);
+
+      // Limits.
+      view = "127";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(127, value);
+
+      view = "-128";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(-128, value);
+
+      view = "4294967295";
+      result = etl::from_chars(view, u32);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(4294967295U, u32);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_round_trip_wide)
+    {
+      uint64_t state = 0xFEDCBA9876543210ULL;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        const int64_t expected = int64_t(next_random(state)) >> (i % 64);
+        int64_t value = 0;
+
+        etl::u32string<80> text;
+        etl::to_chars(text, expected, etl::radix::binary);
+
+        etl::from_chars_result<char32_t> result = etl::from_chars(text, value, etl::radix::binary);
+
+        CHECK(result.status == etl::chars_status::ok);
+        CHECK_EQUAL(expected, value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_double)
+    {
+      struct Case
+      {
+        double      value;
+        const char* text;
+      };
+
+      const Case cases[] =
+      {
+        { 0.0,                     "0" },
+        { -0.0,                    "-0" },
+        { 1.0,                     "1" },
+        { -1.5,                    "-1.5" },
+        { 0.1,                     "0.1" },
+        { 0.3,                     "0.3" },
+        { 0.1 + 0.2,               "0.30000000000000004" },
+        { 100.0,                   "100" },
+        { 1234.5678,               "1234.5678" },
+        { 1e15,                    "1e+15" },
+        { 123456789012345680.0,    "123456789012345680" },
+        { 302860997928776576.0,    "302860997928776576" },
+        { 9007199254740992.0,      "9007199254740992" },
+        { 1e22,                    "1e+22" },
+        { 1e23,                    "1e+23" },
+        { 1e21,                    "1e+21" },
+        { 0.001,                   "0.001" },
+        { 1e-7,                    "1e-07" },
+        { 1.5e-7,                  "1.5e-07" },
+        { 5e-324,                  "5e-324" },
+        { 2.2250738585072014e-308, "2.2250738585072014e-308" },
+        { 1.7976931348623157e308,  "1.7976931348623157e+308" },
+        { 9007199254740993.0,      "9007199254740992" },
+        { 5e-324 * 3,              "1.5e-323" },
+        { 9.5367431640625e-07,     "9.5367431640625e-07" },
+        { std::numeric_limits<double>::infinity(),  "inf" },
+        { -std::numeric_limits<double>::infinity(), "-inf" },
+        { std::numeric_limits<double>::quiet_NaN(), "nan" }
+      };
+
+      for (size_t i = 0; i < (sizeof(cases) / sizeof(cases[0])); ++i)
+      {
+        Text text;
+        etl::to_chars(text, cases[i].value);
+
+        CHECK_EQUAL(std::string(cases[i].text), std::string(text.c_str()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_float)
+    {
+      Text text;
+
+      CHECK(Text("0.1") == etl::to_chars(text, 0.1f));
+
+      text.clear();
+      CHECK(Text("3.4028235e+38") == etl::to_chars(text, std::numeric_limits<float>::max()));
+
+      text.clear();
+      CHECK(Text("1e-45") == etl::to_chars(text, std::numeric_limits<float>::denorm_min()));
+
+      text.clear();
+      CHECK(Text("16777216") == etl::to_chars(text, 16777216.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_double_round_trip)
+    {
+      uint64_t state = 0x0123456789ABCDEFULL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const double value = random_double(state);
+
+        Text text;
+        etl::to_chars(text, value);
+
+        CHECK_EQUAL(value, strtod(text.c_str(), 0));
+
+        // Large integers in fixed notation are written in full.
+        const bool is_full_integer = (text.find('.') == Text::npos) && (text.find('e') == Text::npos) && (fabs(value) >= 9007199254740992.0);
+
+        if (!is_full_integer)
+        {
+          CHECK_EQUAL(shortest_digits(value), count_digits(text));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_double_precision)
+    {
+      Text text;
+
+      CHECK(Text("3.142") == etl::to_chars(text, 3.14159, etl::chars_format::fixed, 3));
+      text.clear();
+      CHECK(Text("3.14e+00") == etl::to_chars(text, 3.14159, etl::chars_format::scientific, 2));
+      text.clear();
+      CHECK(Text("0.0001") == etl::to_chars(text, 0.0001, etl::chars_format::general, 6));
+      text.clear();
+      CHECK(Text("1e-05") == etl::to_chars(text, 0.00001, etl::chars_format::general, 6));
+      text.clear();
+      CHECK(Text("2") == etl::to_chars(text, 2.5, etl::chars_format::fixed, 0));
+      text.clear();
+      CHECK(Text("-0.125000") == etl::to_chars(text, -0.125, etl::chars_format::fixed, 6));
+      text.clear();
+      CHECK(Text("inf") == etl::to_chars(text, std::numeric_limits<double>::infinity(), etl::chars_format::fixed, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_double_precision_matches_snprintf)
+    {
+      static const char* const formats[] = { "", "%.*e", "%.*f", "%.*g" };
+
+      uint64_t state = 0x5555AAAA5555AAAAULL;
+      char expected[400];
+
+      for (int i = 0; i < 30000; ++i)
+      {
+        const double value = random_double(state);
+        const int format    = 1 + int(next_random(state) % 3);
+        const int precision = int(next_random(state) % 20);
+
+        if ((format == etl::chars_format::fixed) && (fabs(value) >= 1e100))
+        {
+          continue;
+        }
+
+        etl::string<400> text;
+        etl::to_chars(text, value, etl::chars_format(etl::chars_format::value_type(format)), precision);
+
+        snprintf(expected, sizeof(expected), formats[format], precision, value);
+
+        CHECK_EQUAL(static_cast<const char*>(expected), text.c_str());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_double_large_precision_matches_snprintf)
+    {
+      static const char* const formats[] = { "", "%.*e", "%.*f", "%.*g" };
+
+      uint64_t state = 0xA5A5A5A55A5A5A5AULL;
+      char expected[1500];
+
+      for (int i = 0; i < 3000; ++i)
+      {
+        const double value = random_double(state);
+        const int format    = 1 + int(next_random(state) % 3);
+        const int precision = 41 + int(next_random(state) % 800);
+
+        etl::string<1500> text;
+        etl::to_chars(text, value, etl::chars_format(etl::chars_format::value_type(format)), precision);
+
+        snprintf(expected, sizeof(expected), formats[format], precision, value);
+
+        CHECK_EQUAL(static_cast<const char*>(expected), text.c_str());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_chars_double_large_precision_edge_cases)
+    {
+      struct Case
+      {
+        double      value;
+        const char* format;
+        int         precision;
+      };
+
+      const Case cases[] =
+      {
+        { 0.0,                     "%.*f", 60   },
+        { -0.0,                    "%.*e", 60   },
+        { 0.0,                     "%.*g", 60   },
+        { 0.1,                     "%.*f", 60   },
+        { 0.1,                     "%.*g", 60   },
+        { 1.0 / 3.0,               "%.*e", 100  },
+        { 5e-324,                  "%.*f", 1100 },
+        { 5e-324,                  "%.*e", 800  },
+        { 2.2250738585072014e-308, "%.*g", 1000 },
+        { 1e300,                   "%.*f", 50   },
+        { 1.7976931348623157e308,  "%.*e", 400  },
+        { 1.7976931348623157e308,  "%.*g", 400  },
+        { 9.5,                     "%.*g", 41   },
+        { 0.5,                     "%.*f", 41   },
+        { 123456789.0,             "%.*g", 45   },
+        { 1e-5,                    "%.*g", 45   },
+      };
+
+      char expected[1500];
+
+      for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+      {
+        const Case& c = cases[i];
+
+        const int format = (c.format[3] == 'e') ? etl::chars_format::scientific : ((c.format[3] == 'f') ? etl::chars_format::fixed : etl::chars_format::general);
+
+        etl::string<1500> text;
+        etl::to_chars(text, c.value, etl::chars_format(etl::chars_format::value_type(format)), c.precision);
+
+        snprintf(expected, sizeof(expected), c.format, c.precision, c.value);
+
+        CHECK_EQUAL(static_cast<const char*>(expected), text.c_str());
+      }
+
+      // Wide strings and float.
+      etl::wstring<80> wtext;
+      etl::to_chars(wtext, 0.375f, etl::chars_format::scientific, 45);
+      CHECK(etl::wstring<80>(L"3.750000000000000000000000000000000000000000000e-01") == wtext);
+
+      // Infinity, NaN and truncation.
+      etl::string<80> text;
+      etl::to_chars(text, -HUGE_VAL, etl::chars_format::fixed, 100);
+      CHECK_EQUAL(std::string("-inf"), std::string(text.c_str()));
+
+      text.clear();
+      etl::to_chars(text, 0.1, etl::chars_format::fixed, 100);
+      CHECK(text.truncated());
+      CHECK_EQUAL(80U, text.size());
+      CHECK_EQUAL(std::string("0.100000000000000005551115123125782702118158340454101562500000000000000000000000"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_double)
+    {
+      struct Case
+      {
+        const char* text;
+        double      value;
+        size_t      length;
+      };
+
+      const Case cases[] =
+      {
+        { "0",                         0.0,                      1 },
+        { "-0",                        -0.0,                     2 },
+        { "1",                         1.0,                      1 },
+        { "-1.5",                      -1.5,                     4 },
+        { ".5",                        0.5,                      2 },
+        { "5.",                        5.0,                      2 },
+        { "0.1",                       0.1,                      3 },
+        { "1e10",                      1e10,                     4 },
+        { "1E+10",                     1e10,                     5 },
+        { "1e-10",                     1e-10,                    5 },
+        { "1e",                        1.0,                      1 },
+        { "1e+",                       1.0,                      1 },
+        { "2.5x",                      2.5,                      3 },
+        { "000123.4500",               123.45,                   11 },
+        { "9007199254740993",          9007199254740992.0,       16 },
+        { "9007199254740995",          9007199254740996.0,       16 },
+        { "9007199254740993.0000001",  9007199254740994.0,       24 },
+        { "1.7976931348623157e308",    1.7976931348623157e308,   22 },
+        { "2.2250738585072011e-308",   2.2250738585072011e-308,  23 },
+        { "4.9406564584124654e-324",   4.9406564584124654e-324,  23 },
+        { "2.4703282292062328e-324",   4.9406564584124654e-324,  23 },
+        { "0.000000000000000000000000000000000000000000000000000000000001", 1e-60, 62 },
+        { "123456789012345678901234567890", 1.2345678901234568e29, 30 }
+      };
+
+      for (size_t i = 0; i < (sizeof(cases) / sizeof(cases[0])); ++i)
+      {
+        double value = 99.0;
+        etl::from_chars_result<char> result = etl::from_chars(cases[i].text, cases[i].text + strlen(cases[i].text), value);
+
+        CHECK(result.status == etl::chars_status::ok);
+        CHECK_EQUAL(cases[i].value, value);
+        CHECK_EQUAL(std::signbit(cases[i].value), std::signbit(value));
+        CHECK_EQUAL(cases[i].length, size_t(result.ptr - cases[i].text));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_double_halfway)
+    {
+      // Exactly halfway between 1 and the next double up.
+      const std::string halfway = "1.00000000000000011102230246251565404236316680908203125";
+      const double      next    = 1.0000000000000002;
+
+      double value = 0.0;
+
+      etl::from_chars_result<char> result = etl::from_chars(halfway.data(), halfway.data() + halfway.size(), value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(1.0, value);
+
+      // Ties to even, unless any later digit is non-zero.
+      std::string above = halfway + "1";
+      result = etl::from_chars(above.data(), above.data() + above.size(), value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(next, value);
+
+      // A non-zero digit beyond the digits that are held exactly.
+      above = halfway + std::string(1000, '0') + "1";
+      result = etl::from_chars(above.data(), above.data() + above.size(), value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(next, value);
+      CHECK(result.ptr == above.data() + above.size());
+
+      std::string below = "1.00000000000000011102230246251565404236316680908203124" + std::string(1000, '9');
+      result = etl::from_chars(below.data(), below.data() + below.size(), value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(1.0, value);
+
+      // Many leading zeros.
+      std::string small = "0." + std::string(400, '0') + "1e400";
+      result = etl::from_chars(small.data(), small.data() + small.size(), value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(0.1, value);
+      CHECK(result.ptr == small.data() + small.size());
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_double_special)
+    {
+      double value = 0.0;
+      etl::string_view view("inf");
+
+      etl::from_chars_result<char> result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<double>::infinity(), value);
+      CHECK(result.ptr == view.data() + 3);
+
+      view = "-Infinity";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(-std::numeric_limits<double>::infinity(), value);
+      CHECK(result.ptr == view.data() + 9);
+
+      view = "NaN(123)";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK(value != value);
+      CHECK(result.ptr == view.data() + 8);
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_double_errors)
+    {
+      double value = 99.0;
+
+      etl::string_view view("");
+      etl::from_chars_result<char> result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+
+      view = ".";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+      CHECK(result.ptr == view.data());
+
+      view = "-e5";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+
+      view = "+1";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::invalid_argument);
+
+      view = "1e309";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+      CHECK(result.ptr == view.data() + 5);
+
+      view = "1.8e308";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+
+      view = "1e-400";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+
+      view = "2e-324";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+
+      CHECK_EQUAL(99.0, value);
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_float)
+    {
+      float value = 0.0f;
+
+      etl::string_view view("0.1");
+      etl::from_chars_result<char> result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(0.1f, value);
+
+      view = "3.4028235e38";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<float>::max(), value);
+
+      view = "1e-45";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<float>::denorm_min(), value);
+
+      view = "3.5e38";
+      result = etl::from_chars(view, value);
+      CHECK(result.status == etl::chars_status::result_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_double_matches_strtod)
+    {
+      uint64_t state = 0x0F1E2D3C4B5A6978ULL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        // Random digits and exponents, including values close to halfway.
+        char text[64];
+
+        if ((i % 2) == 0)
+        {
+          const double value = random_double(state);
+          snprintf(text, sizeof(text), "%.*e", int(next_random(state) % 25), value);
+        }
+        else
+        {
+          const int exponent = int(next_random(state) % 640) - 340;
+          snprintf(text, sizeof(text), "%llu%llue%d",
+                   (unsigned long long)(next_random(state) % 10000000000ULL),
+                   (unsigned long long)(next_random(state) % 10000000000ULL),
+                   exponent);
+        }
+
+        const double expected = strtod(text, 0);
+        double value = 0.0;
+
+        etl::from_chars_result<char> result = etl::from_chars(text, text + strlen(text), value);
+
+        if ((expected != 0.0) && (expected != std::numeric_limits<double>::infinity()) && (expected != -std::numeric_limits<double>::infinity()))
+        {
+          CHECK(result.status == etl::chars_status::ok);
+          CHECK_EQUAL(expected, value);
+          CHECK(result.ptr == text + strlen(text));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_double_round_trip_wide)
+    {
+      uint64_t state = 0x1122334455667788ULL;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        const double expected = random_double(state);
+        double value = 0.0;
+
+        etl::wstring<40> text;
+        etl::to_chars(text, expected);
+
+        etl::from_chars_result<wchar_t> result = etl::from_chars(text, value);
+
+        CHECK(result.status == etl::chars_status::ok);
+        CHECK_EQUAL(expected, value);
+      }
+    }
+  };
+}
@@ -1596,5 +1596,212 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST(test_relocatable_insert_erase_wrapped)
+    {
+      typedef etl::deque<TestDataRelocatable, SIZE> DataRelocatable;
+
+      const TestDataRelocatable insert[] = { 20, 21, 22 };
+
+      // Start the deque at every position in the buffer, so that the shifted
+      // elements wrap around the end of the buffer at every point.
+      for (size_t start = 0; start <= SIZE; ++start)
+      {
+        for (size_t offset = 1; offset < 8; ++offset)
+        {
+          DataRelocatable data;
+          std::deque<int> compare_data;
+
+          for (size_t i = 0; i < start; ++i)
+          {
+            data.push_back(TestDataRelocatable(0));
+            data.pop_front();
+          }
+
+          for (int i = 0; i < 8; ++i)
+          {
+            data.push_back(TestDataRelocatable(i));
+            compare_data.push_back(i);
+          }
+
+          data.insert(data.begin() + offset, TestDataRelocatable(9));
+          compare_data.insert(compare_data.begin() + offset, 9);
+
+          data.insert(data.begin() + offset, 2, TestDataRelocatable(10));
+          compare_data.insert(compare_data.begin() + offset, 2, 10);
+
+          data.erase(data.begin() + offset);
+          compare_data.erase(compare_data.begin() + offset);
+
+          data.insert(data.begin() + offset, std::begin(insert), std::end(insert));
+          compare_data.insert(compare_data.begin() + offset, 20);
+          compare_data.insert(compare_data.begin() + offset + 1, 21);
+          compare_data.insert(compare_data.begin() + offset + 2, 22);
+
+          data.erase(data.begin() + offset, data.begin() + offset + 3);
+          compare_data.erase(compare_data.begin() + offset, compare_data.begin() + offset + 3);
+
+          data.erase(data.begin() + 1, data.end() - 1);
+          compare_data.erase(compare_data.begin() + 1, compare_data.end() - 1);
+
+          CHECK_EQUAL(compare_data.size(), data.size());
+
+          for (size_t i = 0; i < data.size(); ++i)
+          {
+            CHECK_EQUAL(compare_data[i], *data[i].p_value);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_segments)
+    {
+      for (size_t start = 0; start <= SIZE; ++start)
+      {
+        DataInt data;
+
+        // Rotate the start of the deque through the buffer.
+        for (size_t i = 0; i < start; ++i)
+        {
+          data.push_back(0);
+          data.pop_front();
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+          data.push_back(i);
+        }
+
+        std::pair<int*, size_t> first  = data.first_segment();
+        std::pair<int*, size_t> second = data.second_segment();
+
+        CHECK_EQUAL(data.size(), first.second + second.second);
+        CHECK(first.first == &data.front());
+        CHECK(std::equal(first.first, first.first + first.second, data.begin()));
+        CHECK(std::equal(second.first, second.first + second.second, data.begin() + first.second));
+
+        const DataInt& cdata = data;
+        CHECK(cdata.first_segment().first == first.first);
+        CHECK_EQUAL(cdata.second_segment().second, second.second);
+      }
+
+      DataInt empty;
+      CHECK_EQUAL(0U, empty.first_segment().second);
+      CHECK_EQUAL(0U, empty.second_segment().second);
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_range_pop_front_n_copy_out)
+    {
+      const int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      for (size_t start = 0; start <= SIZE; ++start)
+      {
+        DataInt data;
+        std::deque<int> compare_data;
+
+        for (size_t i = 0; i < start; ++i)
+        {
+          data.push_back(0);
+          data.pop_front();
+        }
+
+        data.push_back(99);
+        compare_data.push_back(99);
+
+        data.push_back(std::begin(values), std::end(values));
+        compare_data.insert(compare_data.end(), std::begin(values), std::end(values));
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        CHECK_THROW(data.push_back(std::begin(values), std::end(values)), etl::deque_full);
+
+        int output[SIZE] = { 0 };
+        int* p_end = data.copy_out(output);
+        CHECK_EQUAL(data.size(), size_t(p_end - output));
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), output));
+
+        std::vector<int> partial;
+        data.copy_out(std::back_inserter(partial), 4);
+        CHECK(std::equal(partial.begin(), partial.end(), compare_data.begin()));
+        CHECK_THROW(data.copy_out(output, SIZE), etl::deque_out_of_bounds);
+
+        data.pop_front(3);
+        compare_data.erase(compare_data.begin(), compare_data.begin() + 3);
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        CHECK_THROW(data.pop_front(data.size() + 1), etl::deque_empty);
+        data.pop_front(data.size());
+        CHECK(data.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_range_pop_front_n_non_trivial)
+    {
+      std::vector<NDC> values = { N0, N1, N2, N3, N4, N5, N6, N7, N8, N9 };
+
+      DataNDC data;
+
+      for (size_t i = 0; i < 10; ++i)
+      {
+        data.push_back(N999);
+        data.pop_front();
+      }
+
+      data.push_back(values.begin(), values.end());
+      CHECK(std::equal(values.begin(), values.end(), data.begin()));
+
+      data.pop_front(4);
+      CHECK_EQUAL(6U, data.size());
+      CHECK(std::equal(values.begin() + 4, values.end(), data.begin()));
+
+      std::vector<NDC> output;
+      data.copy_out(std::back_inserter(output));
+      CHECK(std::equal(values.begin() + 4, values.end(), output.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_back)
+    {
+      etl::deque<char, 8> data;
+      const char* text = "abcdefghijkl";
+
+      // Empty, so the run starts at the beginning of the storage.
+      data.push_back('x');
+      data.pop_front();
+
+      std::pair<char*, size_t> region = data.reserve_back();
+      CHECK(region.first == &data[0]);
+      CHECK_EQUAL(8U, region.second);
+
+      memcpy(region.first, text, 5);
+      data.commit_back(5);
+      CHECK_EQUAL(5U, data.size());
+      CHECK(std::equal(text, text + 5, data.begin()));
+
+      data.pop_front(3);
+
+      // The free storage wraps, so is returned as two runs.
+      region = data.reserve_back();
+      CHECK_EQUAL(4U, region.second);
+      memcpy(region.first, text + 5, region.second);
+      data.commit_back(region.second);
+
+      region = data.reserve_back();
+      CHECK_EQUAL(2U, region.second);
+      memcpy(region.first, text + 9, region.second);
+      data.commit_back(region.second);
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.reserve_back().second);
+      CHECK(std::equal(text + 3, text + 11, data.begin()));
+
+      CHECK_THROW(data.commit_back(1), etl::deque_full);
+    }
   };
 }
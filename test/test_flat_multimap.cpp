@@ -410,6 +410,64 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merge)
+    {
+      ElementNDC initial[] = { ElementNDC(1, N1), ElementNDC(5, N5) };
+
+      ElementNDC n[] =
+      {
+        ElementNDC(7, N7), ElementNDC(1, N11), ElementNDC(9, N9), ElementNDC(1, N12),
+        ElementNDC(0, N0), ElementNDC(5, N15), ElementNDC(4, N4), ElementNDC(1, N13)
+      };
+
+      Compare_DataNDC compare_data(std::begin(initial), std::end(initial));
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(n), std::end(n));
+      compare_data.insert(std::begin(n), std::end(n));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      ElementNDC initial[] = { ElementNDC(1, N1), ElementNDC(5, N5) };
+
+      Compare_DataNDC compare_data(std::begin(initial), std::end(initial));
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      data.insert_sorted(initial_data.begin(), initial_data.begin() + 8);
+      compare_data.insert(initial_data.begin(), initial_data.begin() + 8);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_not_sorted)
+    {
+      ElementNDC initial[] = { ElementNDC(1, N1), ElementNDC(5, N5) };
+      ElementNDC unsorted[] = { ElementNDC(0, N0), ElementNDC(3, N3), ElementNDC(2, N2) };
+
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      CHECK_THROW(data.insert_sorted(std::begin(unsorted), std::end(unsorted)), etl::flat_multimap_not_sorted);
+      CHECK_EQUAL(2U, data.size());
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
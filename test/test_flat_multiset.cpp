@@ -370,6 +370,64 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merge)
+    {
+      NDC initial[] = { N1, N5 };
+      NDC n[] = { N7, N1, N9, N1, N0, N5, N4, N1 };
+
+      Compare_DataNDC compare_data(std::begin(initial), std::end(initial));
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(n), std::end(n));
+      compare_data.insert(std::begin(n), std::end(n));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                compare_data.begin());
+
+      CHECK(isEqual);
+
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      NDC initial[] = { N1, N5 };
+      NDC n[] = { N0, N1, N1, N2, N3, N4, N5, N6 };
+
+      Compare_DataNDC compare_data(std::begin(initial), std::end(initial));
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      data.insert_sorted(std::begin(n), std::end(n));
+      compare_data.insert(std::begin(n), std::end(n));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                compare_data.begin());
+
+      CHECK(isEqual);
+
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_not_sorted)
+    {
+      NDC initial[] = { N1, N5 };
+      NDC unsorted[] = { N0, N3, N2 };
+
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      CHECK_THROW(data.insert_sorted(std::begin(unsorted), std::end(unsorted)), etl::flat_multiset_not_sorted);
+      CHECK_EQUAL(2U, data.size());
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -0,0 +1,308 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <limits>
+
+#include "format.h"
+#include "cstring.h"
+#include "wstring.h"
+#include "string_view.h"
+
+namespace
+{
+  typedef etl::string<80> Text;
+
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_literal_text)
+    {
+      Text text;
+
+      CHECK(Text("Hello") == etl::format_to(text, "Hello"));
+
+      text.clear();
+      CHECK(Text("{braces}") == etl::format_to(text, "{{braces}}"));
+    }
+
+    //*************************************************************************
+    TEST(test_appends)
+    {
+      Text text("x = ");
+
+      etl::format_to(text, "{}", 42);
+
+      CHECK(Text("x = 42") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      Text text;
+
+      etl::format_to(text, "{} {} {} {}", 0, -123, 456U, std::numeric_limits<long long>::min());
+      CHECK(Text("0 -123 456 -9223372036854775808") == text);
+
+      text.clear();
+      etl::format_to(text, "{:x} {:X} {:#x} {:o} {:#o} {:b} {:#B}", 255, 255, 255, 8, 8, 5, 5);
+      CHECK(Text("ff FF 0xff 10 010 101 0B101") == text);
+
+      // Unlike printf, the prefix is written for zero.
+      text.clear();
+      etl::format_to(text, "{:#x} {:#o} {:#b}", 0, 0, 0);
+      CHECK(Text("0x0 0 0b0") == text);
+
+      text.clear();
+      etl::format_to(text, "{:+} {:+} {: } {:c}", 1, -1, 1, 65);
+      CHECK(Text("+1 -1  1 A") == text);
+
+      text.clear();
+      etl::format_to(text, "{} {}", (unsigned char)(200), (signed char)(-5));
+      CHECK(Text("200 -5") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_integers_match_snprintf)
+    {
+      char expected[200];
+      etl::string<200> text;
+
+      const int values[] = { 1, -1, 42, -42, 12345, -98765, 0x7FFFFFFF, int(0x80000000U) };
+
+      for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        const int value = values[i];
+
+        snprintf(expected, sizeof(expected), "[%d|%8d|%-8d|%08d|%+d|%x|%#x|%o|%#o]", value, value, value, value, value, unsigned(value), unsigned(value), unsigned(value), unsigned(value));
+
+        text.clear();
+        etl::format_to(text, "[{0}|{0:8}|{0:<8}|{0:08}|{0:+}|{1:x}|{1:#x}|{1:o}|{1:#o}]", value, unsigned(value));
+
+        CHECK_EQUAL(static_cast<const char*>(expected), text.c_str());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_padding)
+    {
+      Text text;
+
+      etl::format_to(text, "[{:6}][{:<6}][{:^6}][{:>6}]", 42, 42, 42, 42);
+      CHECK(Text("[    42][42    ][  42  ][    42]") == text);
+
+      text.clear();
+      etl::format_to(text, "[{:6}][{:>6}][{:^7}]", "ab", "ab", "ab");
+      CHECK(Text("[ab    ][    ab][  ab   ]") == text);
+
+      text.clear();
+      etl::format_to(text, "[{:*^7}][{:-<5}][{:06}][{:#010x}][{:+06}]", "ab", 1, -42, 255, 7);
+      CHECK(Text("[**ab***][1----][-00042][0x000000ff][+00007]") == text);
+
+      text.clear();
+      etl::format_to(text, "[{:2}]", 12345);
+      CHECK(Text("[12345]") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      Text text;
+
+      etl::format_to(text, "{} {} {} {}", 0.5, 0.1f, 1e100, -2.0);
+      CHECK(Text("0.5 0.1 1e+100 -2") == text);
+
+      text.clear();
+      etl::format_to(text, "{:.3f} {:.2e} {:E} {:g} {:.3}", 3.14159, 31415.9, 1.5, 0.0001, 3.14159);
+      CHECK(Text("3.142 3.14e+04 1.500000E+00 0.0001 3.14") == text);
+
+      text.clear();
+      etl::format_to(text, "[{:8.2f}][{:<8.2f}][{:08.2f}][{:+.1f}][{:#.0f}]", 3.14159, 3.14159, -3.14159, 2.0, 2.0);
+      CHECK(Text("[    3.14][3.14    ][-0003.14][+2.0][2.]") == text);
+
+      text.clear();
+      etl::format_to(text, "{} {:F} {:06}", std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+      CHECK(Text("inf -INF    inf") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_matches_snprintf)
+    {
+      char expected[200];
+      etl::string<200> text;
+
+      const double values[] = { 0.0, 1.0, -1.5, 0.1, 123.456, -0.000123456, 1e21, 6.02214076e23, 2.5, 0.125 };
+
+      for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        const double value = values[i];
+
+        snprintf(expected, sizeof(expected), "[%f|%.2f|%12.3e|%-12.3E|%g|%#g|%+.4G|%012.4f]", value, value, value, value, value, value, value, value);
+
+        text.clear();
+        etl::format_to(text, "[{0:f}|{0:.2f}|{0:12.3e}|{0:<12.3E}|{0:g}|{0:#g}|{0:+.4G}|{0:012.4f}]", value);
+
+        CHECK_EQUAL(static_cast<const char*>(expected), text.c_str());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_large_precision_matches_snprintf)
+    {
+      char expected[600];
+      etl::string<600> text;
+
+      const double values[] = { 0.0, 1.0, -1.5, 0.1, -0.000123456, 1e21, 6.02214076e23, 5e-324, HUGE_VAL, -HUGE_VAL };
+
+      for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        const double value = values[i];
+
+        snprintf(expected, sizeof(expected), "[%.60f|%+80.45e|%-80.50E|%#.41g|%0100.50f|%.50G]", value, value, value, value, value, value);
+
+        text.clear();
+        etl::format_to(text, "[{0:.60f}|{0:+80.45e}|{0:<80.50E}|{0:#.41g}|{0:0100.50f}|{0:.50G}]", value);
+
+        CHECK_EQUAL(static_cast<const char*>(expected), text.c_str());
+      }
+
+      text.clear();
+      etl::format_to(text, "{:*^70.50}", 0.1);
+      CHECK_EQUAL(std::string("*********0.1000000000000000055511151231257827021181583404541**********"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      Text text;
+
+      const char* p_text = "pointer";
+      etl::string<10> etl_text("etl");
+      etl::string_view view("view");
+
+      etl::format_to(text, "{} {} {} {:s} {:.3}", p_text, etl_text, view, "literal", "truncated");
+      CHECK(Text("pointer etl view literal tru") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_characters_and_bool)
+    {
+      Text text;
+
+      etl::format_to(text, "{} {:3} {:d} {:x} {} {} {:d} {:>6}", 'a', 'b', 'A', 'A', true, false, true, false);
+      CHECK(Text("a b   65 41 true false 1  false") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_pointer)
+    {
+      Text text;
+
+      const void* p = reinterpret_cast<const void*>(uintptr_t(0x1234));
+
+      etl::format_to(text, "{} {:p}", p, p);
+      CHECK(Text("0x1234 0x1234") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_positional_arguments)
+    {
+      Text text;
+
+      etl::format_to(text, "{1} {0} {1} {2:>4}", "a", "b", 7);
+      CHECK(Text("b a b    7") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_eight_arguments)
+    {
+      Text text;
+
+      etl::format_to(text, "{}{}{}{}{}{}{}{}", 1, 2, 3, 4, 5, 6, 7, 8);
+      CHECK(Text("12345678") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<10> text;
+
+      etl::format_to(text, "{} and {:>10}", "first", "second");
+      CHECK(etl::string<10>("first and ") == text);
+      CHECK(text.truncated());
+
+      text.clear();
+      etl::format_to(text, "{:.6f}", 3.14159265);
+      CHECK(etl::string<10>("3.141593") == text);
+      CHECK(!text.truncated());
+
+      text.assign("0123456");
+      etl::format_to(text, "{:x}", 0xABCDEF);
+      CHECK(etl::string<10>("0123456abc") == text);
+      CHECK(text.truncated());
+
+      text.assign("0123456789");
+      etl::format_to(text, "{}", "");
+      CHECK(etl::string<10>("0123456789") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_wide_strings)
+    {
+      etl::wstring<40> text;
+
+      etl::format_to(text, L"{:>5}|{:x}|{:.2f}|{}|{:^5}", 42, 255, 1.5, L"wide", L'c');
+      CHECK(etl::wstring<40>(L"   42|ff|1.50|wide|  c  ") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_formats)
+    {
+      Text text;
+
+      CHECK_THROW(etl::format_to(text, "{"), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "}"), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{}"), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{} {}", 1), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{0} {}", 1, 2), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{2}", 1, 2), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{:q}", 1), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{:.2}", 1), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{:d}", "text"), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{:x}", 1.0), etl::format_invalid);
+      CHECK_THROW(etl::format_to(text, "{:5", 1), etl::format_invalid);
+    }
+  };
+}
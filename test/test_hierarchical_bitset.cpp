@@ -0,0 +1,303 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <set>
+#include <vector>
+
+#include "hierarchical_bitset.h"
+#include "fnv_1.h"
+
+namespace
+{
+  //***************************************************************************
+  // Checks every bit, the count and the iterated positions against a reference.
+  //***************************************************************************
+  bool is_equal(const std::set<size_t>& compare, const etl::ihierarchical_bitset& data)
+  {
+    if (compare.size() != data.count())
+    {
+      return false;
+    }
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      if (data.test(i) != (compare.count(i) != 0))
+      {
+        return false;
+      }
+    }
+
+    return std::equal(compare.begin(), compare.end(), data.begin());
+  }
+
+  //***************************************************************************
+  // The reference find_next.
+  //***************************************************************************
+  size_t compare_find_next(const std::set<size_t>& compare, size_t position)
+  {
+    std::set<size_t>::const_iterator itr = compare.lower_bound(position);
+
+    return (itr == compare.end()) ? size_t(etl::ihierarchical_bitset::npos) : *itr;
+  }
+
+  SUITE(test_hierarchical_bitset)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::hierarchical_bitset<1000000> data;
+
+      CHECK_EQUAL(1000000U, data.size());
+      CHECK_EQUAL(0U, data.count());
+      CHECK(data.none());
+      CHECK(!data.any());
+      CHECK(!data.all());
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_first());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_allocated_words)
+    {
+      CHECK_EQUAL(1U, etl::hierarchical_bitset<1>::ALLOCATED_WORDS);
+      CHECK_EQUAL(1U, etl::hierarchical_bitset<64>::ALLOCATED_WORDS);
+      CHECK_EQUAL(3U, etl::hierarchical_bitset<65>::ALLOCATED_WORDS);
+      CHECK_EQUAL(65U, etl::hierarchical_bitset<4096>::ALLOCATED_WORDS);
+      CHECK_EQUAL(68U, etl::hierarchical_bitset<4097>::ALLOCATED_WORDS);
+      CHECK_EQUAL(15625U + 245U + 4U + 1U, etl::hierarchical_bitset<1000000>::ALLOCATED_WORDS);
+    }
+
+    //*************************************************************************
+    TEST(test_set_reset_single_bits)
+    {
+      const size_t positions[] = { 0, 1, 63, 64, 4095, 4096, 262143, 262144, 999999 };
+
+      etl::hierarchical_bitset<1000000> data;
+      std::set<size_t> compare;
+
+      for (size_t i = 0; i < (sizeof(positions) / sizeof(positions[0])); ++i)
+      {
+        data.set(positions[i]);
+        compare.insert(positions[i]);
+
+        CHECK(data.test(positions[i]));
+        CHECK(data[positions[i]]);
+        CHECK_EQUAL(*compare.begin(), data.find_first());
+      }
+
+      CHECK(is_equal(compare, data));
+
+      // Setting a set bit changes nothing.
+      data.set(64);
+      CHECK_EQUAL(compare.size(), data.count());
+
+      for (size_t i = 0; i < (sizeof(positions) / sizeof(positions[0])); ++i)
+      {
+        data.reset(positions[i]);
+        compare.erase(positions[i]);
+
+        CHECK(!data.test(positions[i]));
+        CHECK_EQUAL(compare_find_next(compare, 0), data.find_first());
+      }
+
+      CHECK(data.none());
+      CHECK(is_equal(compare, data));
+
+      // Resetting a clear bit changes nothing.
+      data.reset(64);
+      CHECK_EQUAL(0U, data.count());
+    }
+
+    //*************************************************************************
+    TEST(test_set_value_and_flip)
+    {
+      etl::hierarchical_bitset<200> data;
+
+      data.set(10, true);
+      data.set(150, true);
+      data.set(10, false);
+      CHECK(!data.test(10));
+      CHECK(data.test(150));
+
+      data.flip(150);
+      data.flip(199);
+      CHECK(!data.test(150));
+      CHECK(data.test(199));
+      CHECK_EQUAL(1U, data.count());
+      CHECK_EQUAL(199U, data.find_first());
+    }
+
+    //*************************************************************************
+    TEST(test_find_next)
+    {
+      etl::hierarchical_bitset<1000000> data;
+      std::set<size_t> compare;
+
+      etl::fnv_1a_32 hash;
+
+      for (size_t i = 0; i < 500; ++i)
+      {
+        hash.add(1);
+        size_t position = hash.value() % data.size();
+
+        data.set(position);
+        compare.insert(position);
+      }
+
+      CHECK(is_equal(compare, data));
+
+      hash.reset();
+
+      for (size_t i = 0; i < 20000; ++i)
+      {
+        hash.add(2);
+        size_t position = hash.value() % (data.size() + 10);
+
+        CHECK_EQUAL(compare_find_next(compare, position), data.find_next(position));
+      }
+
+      // Every set bit, and the position after each.
+      for (std::set<size_t>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK_EQUAL(*itr, data.find_next(*itr));
+        CHECK_EQUAL(compare_find_next(compare, *itr + 1), data.find_next(*itr + 1));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      etl::hierarchical_bitset<300000> data;
+      std::vector<size_t> compare;
+
+      for (size_t i = 7; i < data.size(); i += 4099)
+      {
+        data.set(i);
+        compare.push_back(i);
+      }
+
+      std::vector<size_t> result;
+
+      for (etl::ihierarchical_bitset::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        result.push_back(*itr);
+      }
+
+      CHECK(compare == result);
+
+      etl::ihierarchical_bitset::const_iterator itr = data.cbegin();
+      CHECK_EQUAL(7U, *itr++);
+      CHECK_EQUAL(4106U, *itr);
+    }
+
+    //*************************************************************************
+    TEST(test_set_all_reset_all)
+    {
+      etl::hierarchical_bitset<4100> data;
+
+      data.set();
+      CHECK_EQUAL(4100U, data.count());
+      CHECK(data.all());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(i, data.find_next(i));
+      }
+
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_next(4100));
+
+      data.reset(4099);
+      data.reset(0);
+      CHECK_EQUAL(1U, data.find_first());
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_next(4099));
+
+      data.reset();
+      CHECK(data.none());
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_first());
+    }
+
+    //*************************************************************************
+    TEST(test_random_set_and_reset)
+    {
+      etl::hierarchical_bitset<70000> data;
+      std::set<size_t> compare;
+
+      etl::fnv_1a_32 hash;
+
+      for (size_t i = 0; i < 20000; ++i)
+      {
+        hash.add(3);
+        size_t position = (hash.value() >> 4) % 2000;
+
+        // Cluster the bits, so that words and summaries empty and refill.
+        position = (position / 20) * 700 + (position % 20);
+
+        if ((hash.value() & 1) != 0)
+        {
+          data.set(position);
+          compare.insert(position);
+        }
+        else
+        {
+          data.reset(position);
+          compare.erase(position);
+        }
+
+        CHECK_EQUAL(compare_find_next(compare, 0), data.find_first());
+      }
+
+      CHECK(is_equal(compare, data));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_assign)
+    {
+      etl::hierarchical_bitset<5000> data1;
+      data1.set(3);
+      data1.set(4500);
+
+      etl::hierarchical_bitset<5000> data2(data1);
+      CHECK(data1 == data2);
+      CHECK_EQUAL(2U, data2.count());
+      CHECK_EQUAL(4500U, data2.find_next(4));
+
+      etl::hierarchical_bitset<5000> data3;
+      data3.set(10);
+      CHECK(data1 != data3);
+
+      data3 = data1;
+      CHECK(data1 == data3);
+      CHECK(!data3.test(10));
+      CHECK_EQUAL(3U, data3.find_first());
+    }
+  };
+}
@@ -0,0 +1,253 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+
+#include "indexed_priority_queue.h"
+
+namespace
+{
+  //***************************************************************************
+  // Random operations, checked against a brute force search.
+  //***************************************************************************
+  template <typename TQueue, typename TCompare>
+  bool check_random(TQueue& queue, TCompare compare)
+  {
+    std::vector<int>  values(queue.max_size(), 0);
+    std::vector<bool> queued(queue.max_size(), false);
+
+    uint32_t seed = 1;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      const int value = int((seed >> 8) % 1000);
+      const int op    = int((seed >> 4) % 4);
+
+      seed = (seed * 1103515245U) + 12345U;
+      size_t handle = (seed >> 8) % queue.max_size();
+
+      if ((op == 0) && !queue.full())
+      {
+        handle = queue.push(value);
+
+        if (queued[handle])
+        {
+          return false;
+        }
+
+        values[handle] = value;
+        queued[handle] = true;
+      }
+      else if ((op == 1) && queue.contains(handle))
+      {
+        queue.update(handle, value);
+        values[handle] = value;
+      }
+      else if ((op == 2) && queue.contains(handle))
+      {
+        queue.erase(handle);
+        queued[handle] = false;
+      }
+      else if (!queue.empty())
+      {
+        handle = queue.top_handle();
+        queued[handle] = false;
+        queue.pop();
+      }
+
+      // Check the contents and the top.
+      size_t count = 0;
+
+      for (size_t h = 0; h < queue.max_size(); ++h)
+      {
+        if (queued[h] != queue.contains(h))
+        {
+          return false;
+        }
+
+        if (queued[h])
+        {
+          ++count;
+
+          if ((queue[h] != values[h]) || compare(queue.top(), values[h]))
+          {
+            return false;
+          }
+        }
+      }
+
+      if (count != queue.size())
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_indexed_priority_queue)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::indexed_priority_queue<int, 4> queue;
+
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.available());
+      CHECK(!queue.contains(0));
+      CHECK(!queue.contains(4));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      etl::indexed_priority_queue<int, 8> queue;
+      etl::iindexed_priority_queue<int>& iqueue = queue;
+
+      const int input[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        size_t handle = iqueue.push(input[i]);
+        CHECK(iqueue.contains(handle));
+        CHECK_EQUAL(input[i], iqueue[handle]);
+      }
+
+      CHECK(iqueue.full());
+      CHECK_THROW(iqueue.push(0), etl::indexed_priority_queue_full);
+
+      std::vector<int> expected(input, input + 8);
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(expected[i], iqueue.top());
+        iqueue.pop();
+      }
+
+      CHECK(iqueue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      etl::indexed_priority_queue<int, 8, std::greater<int>, 2> queue;
+
+      size_t a = queue.push(10);
+      size_t b = queue.push(20);
+      size_t c = queue.push(30);
+
+      CHECK_EQUAL(a, queue.top_handle());
+
+      // Decrease key.
+      queue.update(c, 5);
+      CHECK_EQUAL(c, queue.top_handle());
+      CHECK_EQUAL(5, queue.top());
+
+      // Increase key.
+      queue.update(c, 25);
+      CHECK_EQUAL(a, queue.top_handle());
+
+      queue.update(a, 21);
+      CHECK_EQUAL(b, queue.top_handle());
+
+      CHECK_EQUAL(21, queue[a]);
+      CHECK_EQUAL(20, queue[b]);
+      CHECK_EQUAL(25, queue[c]);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      etl::indexed_priority_queue<int, 8> queue;
+
+      size_t a = queue.push(10);
+      size_t b = queue.push(20);
+      size_t c = queue.push(30);
+
+      queue.erase(b);
+      CHECK(!queue.contains(b));
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_THROW(queue.erase(b), etl::indexed_priority_queue_handle);
+      CHECK_THROW(queue.update(b, 1), etl::indexed_priority_queue_handle);
+
+      queue.erase(c);
+      CHECK_EQUAL(a, queue.top_handle());
+
+      // The handle is reused.
+      size_t d = queue.push(40);
+      CHECK(queue.contains(d));
+      CHECK_EQUAL(d, queue.top_handle());
+
+      queue.clear();
+      CHECK(queue.empty());
+      CHECK(!queue.contains(a));
+      CHECK(!queue.contains(d));
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_type)
+    {
+      etl::indexed_priority_queue<std::string, 4, std::greater<std::string> > queue;
+
+      size_t b = queue.push("B");
+      queue.push("C");
+      size_t a = queue.push("A");
+
+      CHECK_EQUAL("A", queue.top());
+      queue.update(b, "0");
+      CHECK_EQUAL("0", queue.top());
+      queue.erase(a);
+      queue.pop();
+      CHECK_EQUAL("C", queue.top());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      etl::indexed_priority_queue<int, 64, std::less<int>, 2>    queue2;
+      etl::indexed_priority_queue<int, 64, std::less<int>, 3>    queue3;
+      etl::indexed_priority_queue<int, 64, std::greater<int>, 4> queue4;
+      etl::indexed_priority_queue<int, 64, std::greater<int>, 8> queue8;
+
+      CHECK(check_random(queue2, std::less<int>()));
+      CHECK(check_random(queue3, std::less<int>()));
+      CHECK(check_random(queue4, std::greater<int>()));
+      CHECK(check_random(queue8, std::greater<int>()));
+    }
+  };
+}
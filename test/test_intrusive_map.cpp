@@ -0,0 +1,188 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <string>
+#include <map>
+#include <stdint.h>
+
+#include "intrusive_map.h"
+
+namespace
+{
+  typedef etl::tree_link<0> IdLink;
+  typedef etl::tree_link<1> NameLink;
+
+  //***************************************************************************
+  struct Item : public IdLink, public NameLink
+  {
+    Item()
+      : id(0)
+    {
+    }
+
+    Item(uint32_t id_, const std::string& name_)
+      : id(id_),
+        name(name_)
+    {
+    }
+
+    uint32_t    id;
+    std::string name;
+  };
+
+  struct ItemId
+  {
+    const uint32_t& operator ()(const Item& item) const
+    {
+      return item.id;
+    }
+  };
+
+  struct ItemName
+  {
+    const std::string& operator ()(const Item& item) const
+    {
+      return item.name;
+    }
+  };
+
+  typedef etl::intrusive_map<uint32_t, Item, ItemId>              IdMap;
+  typedef etl::intrusive_map<std::string, Item, ItemName, NameLink> NameMap;
+
+  SUITE(test_intrusive_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      IdMap map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.size());
+      CHECK(map.begin() == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Item items[] = { Item(30, "thirty"), Item(10, "ten"), Item(20, "twenty"), Item(40, "forty") };
+
+      IdMap map(items, items + 4);
+
+      CHECK_EQUAL(4U, map.size());
+
+      IdMap::iterator itr = map.begin();
+      CHECK_EQUAL(10U, itr->id); ++itr;
+      CHECK_EQUAL(20U, itr->id); ++itr;
+      CHECK_EQUAL(30U, itr->id); ++itr;
+      CHECK_EQUAL(40U, itr->id); ++itr;
+      CHECK(itr == map.end());
+
+      CHECK_EQUAL(std::string("twenty"), map.find(20)->name);
+      CHECK(map.find(25) == map.end());
+      CHECK_EQUAL(30U, map.lower_bound(25)->id);
+      CHECK_EQUAL(40U, map.upper_bound(30)->id);
+
+      Item duplicate(20, "another twenty");
+      std::pair<IdMap::iterator, bool> result = map.insert(duplicate);
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("twenty"), result.first->name);
+
+      CHECK_EQUAL(1U, map.erase(20));
+      CHECK(map.find(20) == map.end());
+      CHECK_EQUAL(3U, map.size());
+    }
+
+    //*************************************************************************
+    TEST(test_in_two_maps)
+    {
+      Item items[] = { Item(3, "c"), Item(1, "b"), Item(2, "a") };
+
+      IdMap   by_id(items, items + 3);
+      NameMap by_name(items, items + 3);
+
+      CHECK_EQUAL(1U, by_id.begin()->id);
+      CHECK_EQUAL(std::string("a"), by_name.begin()->name);
+      CHECK(&*by_id.find(2) == &*by_name.find("a"));
+
+      by_name.erase(by_name.find("a"));
+
+      CHECK_EQUAL(3U, by_id.size());
+      CHECK_EQUAL(2U, by_name.size());
+      CHECK(by_id.find(2) != by_id.end());
+      CHECK(by_name.find("a") == by_name.end());
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_std_map)
+    {
+      const size_t COUNT = 300;
+
+      std::vector<Item> items(COUNT);
+
+      for (size_t i = 0; i < COUNT; ++i)
+      {
+        items[i].id = uint32_t(i * 7919);
+      }
+
+      IdMap map;
+      std::map<uint32_t, Item*> compare;
+
+      uint32_t seed = 1;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        Item& item = items[(seed >> 8) % COUNT];
+
+        if (compare.find(item.id) == compare.end())
+        {
+          CHECK(map.insert(item).second);
+          compare[item.id] = &item;
+        }
+        else
+        {
+          CHECK_EQUAL(1U, map.erase(item.id));
+          compare.erase(item.id);
+        }
+
+        CHECK_EQUAL(compare.size(), map.size());
+      }
+
+      std::map<uint32_t, Item*>::const_iterator icompare = compare.begin();
+
+      for (IdMap::iterator itr = map.begin(); itr != map.end(); ++itr, ++icompare)
+      {
+        CHECK_EQUAL(icompare->first, itr->id);
+        CHECK(icompare->second == &*itr);
+      }
+    }
+  };
+}
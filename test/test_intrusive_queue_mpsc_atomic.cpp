@@ -0,0 +1,267 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "platform.h"
+
+#if defined(ETL_ATOMIC_SUPPORTED)
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "intrusive_queue_mpsc_atomic.h"
+
+namespace
+{
+  typedef etl::forward_link<0> FirstLink;
+  typedef etl::forward_link<1> SecondLink;
+
+  //***************************************************************************
+  struct Item : public FirstLink, public SecondLink
+  {
+    Item(uint32_t value_ = 0)
+      : value(value_)
+    {
+    }
+
+    uint32_t value;
+  };
+
+  typedef etl::intrusive_queue_mpsc_atomic<Item>             Queue;
+  typedef etl::intrusive_queue_mpsc_atomic<Item, SecondLink> Queue2;
+
+  //***************************************************************************
+  struct Collect
+  {
+    Collect(std::vector<uint32_t>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator ()(Item& item)
+    {
+      values.push_back(item.value);
+    }
+
+    std::vector<uint32_t>& values;
+  };
+
+  SUITE(test_intrusive_queue_mpsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      std::vector<Item> items;
+
+      for (uint32_t i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Queue queue;
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        queue.push(items[i]);
+      }
+
+      CHECK(!queue.empty());
+
+      CHECK(queue.pop() == &items[0]);
+      CHECK(queue.pop() == &items[1]);
+      CHECK(!items[0].FirstLink::is_linked());
+
+      // Pushes after the shared list was taken come after the values already taken.
+      for (size_t i = 5; i < 10; ++i)
+      {
+        queue.push(items[i]);
+      }
+
+      for (size_t i = 2; i < 10; ++i)
+      {
+        CHECK(queue.pop() == &items[i]);
+      }
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_all)
+    {
+      std::vector<Item> items;
+
+      for (uint32_t i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Queue queue;
+
+      for (size_t i = 0; i < 6; ++i)
+      {
+        queue.push(items[i]);
+      }
+
+      CHECK(queue.pop() == &items[0]);
+
+      for (size_t i = 6; i < 10; ++i)
+      {
+        queue.push(items[i]);
+      }
+
+      std::vector<uint32_t> values;
+      CHECK_EQUAL(9U, queue.pop_all(Collect(values)));
+
+      CHECK_EQUAL(9U, values.size());
+
+      for (uint32_t i = 0; i < values.size(); ++i)
+      {
+        CHECK_EQUAL(i + 1, values[i]);
+      }
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop_all(Collect(values)));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Item a(1);
+      Item b(2);
+
+      Queue queue;
+
+      queue.push(a);
+      queue.push(b);
+      queue.clear();
+
+      CHECK(queue.empty());
+
+      queue.push(b);
+      CHECK(queue.pop() == &b);
+    }
+
+    //*************************************************************************
+    TEST(test_two_queues_different_links)
+    {
+      Item a(1);
+      Item b(2);
+
+      Queue  queue1;
+      Queue2 queue2;
+
+      queue1.push(a);
+      queue1.push(b);
+      queue2.push(b);
+      queue2.push(a);
+
+      CHECK(queue1.pop() == &a);
+      CHECK(queue2.pop() == &b);
+      CHECK(queue1.pop() == &b);
+      CHECK(queue2.pop() == &a);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      const uint32_t PRODUCERS = 4;
+      const uint32_t COUNT     = 50000;
+
+      std::vector<Item> items(PRODUCERS * COUNT);
+
+      Queue queue;
+
+      std::vector<std::thread> threads;
+
+      for (uint32_t p = 0; p < PRODUCERS; ++p)
+      {
+        threads.push_back(std::thread([&items, &queue, p, COUNT]()
+        {
+          for (uint32_t i = 0; i < COUNT; ++i)
+          {
+            Item& item = items[(p * COUNT) + i];
+            item.value = (p << 24) | i;
+            queue.push(item);
+          }
+        }));
+      }
+
+      // The consumer sees the values from each producer in order.
+      std::vector<int32_t> last(PRODUCERS, -1);
+      bool     in_order = true;
+      uint32_t count    = 0;
+      uint64_t sum      = 0;
+
+      while (count < (PRODUCERS * COUNT))
+      {
+        Item* p_item = queue.pop();
+
+        if (p_item == nullptr)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        uint32_t producer = p_item->value >> 24;
+        int32_t  sequence = int32_t(p_item->value & 0xFFFFFF);
+
+        if (sequence <= last[producer])
+        {
+          in_order = false;
+        }
+
+        last[producer] = sequence;
+        sum += sequence;
+        ++count;
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(in_order);
+      CHECK_EQUAL(uint64_t(PRODUCERS) * (uint64_t(COUNT) * (COUNT - 1) / 2), sum);
+      CHECK(queue.empty());
+    }
+  };
+}
+
+#endif
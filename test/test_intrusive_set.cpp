@@ -0,0 +1,394 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <functional>
+
+#include "intrusive_set.h"
+
+namespace
+{
+  typedef etl::tree_link<0> FirstLink;
+  typedef etl::tree_link<1> SecondLink;
+
+  //***************************************************************************
+  struct Item : public FirstLink, public SecondLink
+  {
+    Item(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  bool operator <(const Item& lhs, const Item& rhs)
+  {
+    return lhs.value < rhs.value;
+  }
+
+  bool operator >(const Item& lhs, const Item& rhs)
+  {
+    return lhs.value > rhs.value;
+  }
+
+  typedef etl::intrusive_set<Item>                                     Set;
+  typedef etl::intrusive_set<Item, SecondLink, std::greater<Item> >    ReverseSet;
+
+  //***************************************************************************
+  /// Checks the links and balance factors, and returns the height.
+  //***************************************************************************
+  template <typename TLink>
+  int CheckSubtree(const TLink* p_link, const TLink* p_parent, bool& valid)
+  {
+    if (p_link == nullptr)
+    {
+      return 0;
+    }
+
+    if (p_link->etl_parent != p_parent)
+    {
+      valid = false;
+    }
+
+    int left  = CheckSubtree<TLink>(static_cast<const TLink*>(p_link->etl_left), p_link, valid);
+    int right = CheckSubtree<TLink>(static_cast<const TLink*>(p_link->etl_right), p_link, valid);
+
+    if (((right - left) != p_link->etl_balance) || (p_link->etl_balance < -1) || (p_link->etl_balance > 1))
+    {
+      valid = false;
+    }
+
+    return 1 + std::max(left, right);
+  }
+
+  //***************************************************************************
+  /// Checks the whole tree, found by climbing from the first value.
+  //***************************************************************************
+  template <typename TLink, typename TSet>
+  bool IsValidTree(const TSet& set, int& height)
+  {
+    height = 0;
+
+    if (set.empty())
+    {
+      return true;
+    }
+
+    const TLink* p_root = &static_cast<const TLink&>(*set.begin());
+
+    while (p_root->etl_parent != nullptr)
+    {
+      p_root = static_cast<const TLink*>(p_root->etl_parent);
+    }
+
+    bool valid = true;
+    height = CheckSubtree<TLink>(p_root, static_cast<const TLink*>(nullptr), valid);
+
+    return valid;
+  }
+
+  //***************************************************************************
+  std::vector<int> Contents(const Set& set)
+  {
+    std::vector<int> result;
+
+    for (Set::const_iterator itr = set.begin(); itr != set.end(); ++itr)
+    {
+      result.push_back(itr->value);
+    }
+
+    return result;
+  }
+
+  SUITE(test_intrusive_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK(set.begin() == set.end());
+      CHECK(set.rbegin() == set.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_ordered)
+    {
+      const int values[] = { 5, 3, 8, 1, 4, 7, 9, 2, 6, 0 };
+
+      std::vector<Item> items(values, values + 10);
+
+      Set set;
+
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        std::pair<Set::iterator, bool> result = set.insert(items[i]);
+        CHECK(result.second);
+        CHECK(&*result.first == &items[i]);
+      }
+
+      Item duplicate(4);
+      std::pair<Set::iterator, bool> result = set.insert(duplicate);
+      CHECK(!result.second);
+      CHECK(&*result.first == &items[4]);
+
+      CHECK_EQUAL(10U, set.size());
+
+      std::vector<int> expected;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        expected.push_back(i);
+      }
+
+      CHECK(expected == Contents(set));
+
+      int height;
+      CHECK(IsValidTree<FirstLink>(set, height));
+    }
+
+    //*************************************************************************
+    TEST(test_sequential_insert_is_balanced)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 1023; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      int height;
+      CHECK(IsValidTree<FirstLink>(set, height));
+      CHECK(height <= 11);
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        items.push_back(Item(i * 2));
+      }
+
+      Set set(items.begin(), items.end());
+      const Set& cset = set;
+
+      CHECK(&*set.find(Item(10)) == &items[5]);
+      CHECK(set.find(Item(11)) == set.end());
+      CHECK(cset.find(Item(38)) != cset.end());
+      CHECK_EQUAL(1U, set.count(Item(0)));
+      CHECK_EQUAL(0U, set.count(Item(1)));
+
+      CHECK_EQUAL(10, set.lower_bound(Item(10))->value);
+      CHECK_EQUAL(12, set.lower_bound(Item(11))->value);
+      CHECK_EQUAL(12, set.upper_bound(Item(10))->value);
+      CHECK(set.lower_bound(Item(39)) == set.end());
+      CHECK(cset.upper_bound(Item(38)) == cset.end());
+      CHECK_EQUAL(0, set.lower_bound(Item(-5))->value);
+
+      std::pair<Set::iterator, Set::iterator> range = set.equal_range(Item(10));
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+
+      range = set.equal_range(Item(11));
+      CHECK(range.first == range.second);
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_iterate)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      int expected = 9;
+
+      for (Set::reverse_iterator itr = set.rbegin(); itr != set.rend(); ++itr)
+      {
+        CHECK_EQUAL(expected--, itr->value);
+      }
+
+      Set::iterator last = set.end();
+      --last;
+      CHECK_EQUAL(9, last->value);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      CHECK_EQUAL(1U, set.erase(Item(7)));
+      CHECK_EQUAL(0U, set.erase(Item(7)));
+      CHECK(!items[7].FirstLink::is_linked());
+
+      Set::iterator next = set.erase(set.find(Item(8)));
+      CHECK_EQUAL(9, next->value);
+
+      Set::iterator first = set.find(Item(10));
+      Set::iterator last  = set.find(Item(15));
+
+      next = set.erase(first, last);
+      CHECK_EQUAL(15, next->value);
+
+      const int remaining[] = { 0, 1, 2, 3, 4, 5, 6, 9, 15, 16, 17, 18, 19 };
+      CHECK(std::vector<int>(remaining, remaining + 13) == Contents(set));
+
+      int height;
+      CHECK(IsValidTree<FirstLink>(set, height));
+
+      // The erased value may be linked again.
+      CHECK(set.insert(items[7]).second);
+      CHECK_EQUAL(14U, set.size());
+
+      set.erase(set.begin(), set.end());
+      CHECK(set.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      set.clear();
+
+      CHECK(set.empty());
+      CHECK(set.begin() == set.end());
+
+      set.insert(items[3]);
+      CHECK_EQUAL(3, set.begin()->value);
+    }
+
+    //*************************************************************************
+    TEST(test_two_sets_different_links)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set        set(items.begin(), items.end());
+      ReverseSet reverse(items.begin(), items.end());
+
+      CHECK_EQUAL(0, set.begin()->value);
+      CHECK_EQUAL(9, reverse.begin()->value);
+
+      set.erase(Item(9));
+
+      CHECK_EQUAL(9U, set.size());
+      CHECK_EQUAL(10U, reverse.size());
+      CHECK(&*reverse.begin() == &items[9]);
+
+      int height;
+      CHECK(IsValidTree<SecondLink>(reverse, height));
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_std_set)
+    {
+      const int COUNT = 500;
+
+      std::vector<Item> items;
+
+      for (int i = 0; i < COUNT; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set;
+      std::set<int> compare;
+
+      uint32_t seed = 1;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        int value = int((seed >> 8) % COUNT);
+
+        if (compare.find(value) == compare.end())
+        {
+          CHECK(set.insert(items[value]).second);
+          compare.insert(value);
+        }
+        else if (((seed >> 4) & 1) == 0)
+        {
+          CHECK_EQUAL(1U, set.erase(items[value]));
+          compare.erase(value);
+        }
+        else
+        {
+          set.erase(set.find(items[value]));
+          compare.erase(value);
+        }
+
+        CHECK_EQUAL(compare.size(), set.size());
+
+        if ((i % 1000) == 0)
+        {
+          int height;
+          CHECK(IsValidTree<FirstLink>(set, height));
+        }
+      }
+
+      int height;
+      CHECK(IsValidTree<FirstLink>(set, height));
+      CHECK(std::vector<int>(compare.begin(), compare.end()) == Contents(set));
+    }
+  };
+}
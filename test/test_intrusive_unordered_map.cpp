@@ -0,0 +1,208 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <string>
+#include <map>
+#include <stdint.h>
+
+#include "intrusive_unordered_map.h"
+
+namespace
+{
+  typedef etl::forward_link<0> FirstLink;
+  typedef etl::forward_link<1> SecondLink;
+
+  //***************************************************************************
+  struct Item : public FirstLink, public SecondLink
+  {
+    Item()
+      : id(0)
+    {
+    }
+
+    Item(uint32_t id_, const std::string& name_)
+      : id(id_),
+        name(name_)
+    {
+    }
+
+    uint32_t    id;
+    std::string name;
+  };
+
+  struct ItemId
+  {
+    const uint32_t& operator ()(const Item& item) const
+    {
+      return item.id;
+    }
+  };
+
+  struct ItemName
+  {
+    const std::string& operator ()(const Item& item) const
+    {
+      return item.name;
+    }
+  };
+
+  struct StringHash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      size_t hash = 0;
+
+      for (size_t i = 0; i < text.size(); ++i)
+      {
+        hash = (hash * 31) + size_t(text[i]);
+      }
+
+      return hash;
+    }
+  };
+
+  typedef etl::intrusive_unordered_map<uint32_t, Item, ItemId, 16>                              IdMap;
+  typedef etl::iintrusive_unordered_map<uint32_t, Item, ItemId>                                 IIdMap;
+  typedef etl::intrusive_unordered_map<std::string, Item, ItemName, 8, SecondLink, StringHash>  NameMap;
+
+  SUITE(test_intrusive_unordered_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      IdMap map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(16U, map.bucket_count());
+      CHECK(map.begin() == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Item items[] = { Item(1, "one"), Item(2, "two"), Item(17, "seventeen"), Item(33, "thirty three") };
+
+      IdMap map(items, items + 4);
+      IIdMap& imap = map;
+
+      CHECK_EQUAL(4U, imap.size());
+
+      // 1, 17 and 33 share a bucket.
+      CHECK_EQUAL(3U, imap.bucket_size(1));
+
+      CHECK_EQUAL(std::string("seventeen"), imap.find(17)->name);
+      CHECK(imap.find(18) == imap.end());
+
+      Item duplicate(2, "another two");
+      std::pair<IIdMap::iterator, bool> result = imap.insert(duplicate);
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("two"), result.first->name);
+
+      CHECK_EQUAL(1U, imap.erase(17));
+      CHECK(imap.find(17) == imap.end());
+      CHECK_EQUAL(std::string("thirty three"), imap.find(33)->name);
+      CHECK_EQUAL(std::string("one"), imap.find(1)->name);
+
+      std::pair<IIdMap::iterator, IIdMap::iterator> range = imap.equal_range(33);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(33U, range.first->id);
+    }
+
+    //*************************************************************************
+    TEST(test_in_two_maps)
+    {
+      Item items[] = { Item(1, "one"), Item(2, "two"), Item(3, "three") };
+
+      IdMap   by_id(items, items + 3);
+      NameMap by_name(items, items + 3);
+
+      CHECK(&*by_id.find(2) == &*by_name.find("two"));
+
+      by_name.erase(by_name.find("two"));
+
+      CHECK_EQUAL(3U, by_id.size());
+      CHECK_EQUAL(2U, by_name.size());
+      CHECK(by_name.find("two") == by_name.end());
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_std_map)
+    {
+      const size_t COUNT = 200;
+
+      std::vector<Item> items(COUNT);
+
+      for (size_t i = 0; i < COUNT; ++i)
+      {
+        items[i].id = uint32_t(i * 7919);
+      }
+
+      IdMap map;
+      std::map<uint32_t, Item*> compare;
+
+      uint32_t seed = 1;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        Item& item = items[(seed >> 8) % COUNT];
+
+        if (compare.find(item.id) == compare.end())
+        {
+          CHECK(map.insert(item).second);
+          compare[item.id] = &item;
+        }
+        else if (((seed >> 4) & 1) == 0)
+        {
+          CHECK_EQUAL(1U, map.erase(item.id));
+          compare.erase(item.id);
+        }
+        else
+        {
+          map.erase(map.find(item.id));
+          compare.erase(item.id);
+        }
+
+        CHECK_EQUAL(compare.size(), map.size());
+      }
+
+      std::map<uint32_t, Item*> contents;
+
+      for (IdMap::iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        contents[itr->id] = &*itr;
+      }
+
+      CHECK(compare == contents);
+    }
+  };
+}
@@ -0,0 +1,317 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <set>
+#include <algorithm>
+
+#include "intrusive_unordered_set.h"
+
+namespace
+{
+  typedef etl::forward_link<0> FirstLink;
+  typedef etl::forward_link<1> SecondLink;
+
+  //***************************************************************************
+  struct Item : public FirstLink, public SecondLink
+  {
+    Item(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  bool operator ==(const Item& lhs, const Item& rhs)
+  {
+    return lhs.value == rhs.value;
+  }
+
+  struct ItemHash
+  {
+    size_t operator ()(const Item& item) const
+    {
+      return size_t(item.value);
+    }
+  };
+
+  typedef etl::intrusive_unordered_set<Item, 7, FirstLink, ItemHash>  Set;
+  typedef etl::intrusive_unordered_set<Item, 3, SecondLink, ItemHash> Set2;
+  typedef etl::iintrusive_unordered_set<Item, FirstLink, ItemHash>    ISet;
+
+  //***************************************************************************
+  std::multiset<int> Contents(const ISet& set)
+  {
+    std::multiset<int> result;
+
+    for (ISet::const_iterator itr = set.begin(); itr != set.end(); ++itr)
+    {
+      result.insert(itr->value);
+    }
+
+    return result;
+  }
+
+  SUITE(test_intrusive_unordered_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK_EQUAL(7U, set.bucket_count());
+      CHECK_EQUAL(7U, set.max_bucket_count());
+      CHECK(set.begin() == set.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        items.push_back(Item(i * 3));
+      }
+
+      Set set;
+      ISet& iset = set;
+
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        std::pair<ISet::iterator, bool> result = iset.insert(items[i]);
+        CHECK(result.second);
+        CHECK(&*result.first == &items[i]);
+      }
+
+      CHECK_EQUAL(items.size(), iset.size());
+
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        ISet::iterator itr = iset.find(Item(int(i * 3)));
+        CHECK(itr != iset.end());
+        CHECK(&*itr == &items[i]);
+        CHECK_EQUAL(1U, iset.count(Item(int(i * 3))));
+      }
+
+      CHECK(iset.find(Item(1)) == iset.end());
+      CHECK_EQUAL(0U, iset.count(Item(1)));
+
+      const ISet& ciset = iset;
+      CHECK(ciset.find(Item(3)) != ciset.end());
+      CHECK(ciset.find(Item(4)) == ciset.end());
+
+      CHECK_CLOSE(20.0f / 7.0f, iset.load_factor(), 0.001f);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate)
+    {
+      Item a(5);
+      Item b(5);
+
+      Set set;
+
+      CHECK(set.insert(a).second);
+
+      std::pair<Set::iterator, bool> result = set.insert(b);
+      CHECK(!result.second);
+      CHECK(&*result.first == &a);
+      CHECK_EQUAL(1U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      std::vector<Item> items;
+      std::multiset<int> expected;
+
+      for (int i = 0; i < 30; ++i)
+      {
+        items.push_back(Item(i * 5));
+        expected.insert(i * 5);
+      }
+
+      Set set(items.begin(), items.end());
+
+      CHECK_EQUAL(items.size(), size_t(std::distance(set.begin(), set.end())));
+      CHECK(expected == Contents(set));
+
+      // The local iterators cover all of the values.
+      size_t count = 0;
+
+      for (size_t i = 0; i < set.bucket_count(); ++i)
+      {
+        for (Set::local_iterator itr = set.begin(i); itr != set.end(i); ++itr)
+        {
+          CHECK_EQUAL(i, set.bucket(*itr));
+          ++count;
+        }
+      }
+
+      CHECK_EQUAL(items.size(), count);
+      CHECK_EQUAL(5U, set.bucket_size(Item(0)));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      CHECK_EQUAL(1U, set.erase(Item(4)));
+      CHECK_EQUAL(0U, set.erase(Item(4)));
+      CHECK_EQUAL(9U, set.size());
+      CHECK(set.find(Item(4)) == set.end());
+
+      // The erased value may be linked again.
+      CHECK(set.insert(items[4]).second);
+      CHECK_EQUAL(10U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 25; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      // Erase the odd values while iterating.
+      Set::iterator itr = set.begin();
+
+      while (itr != set.end())
+      {
+        if ((itr->value % 2) == 1)
+        {
+          itr = set.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      std::multiset<int> expected;
+
+      for (int i = 0; i < 25; i += 2)
+      {
+        expected.insert(i);
+      }
+
+      CHECK_EQUAL(expected.size(), set.size());
+      CHECK(expected == Contents(set));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 25; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      Set::iterator first = set.begin();
+      std::advance(first, 5);
+      Set::iterator last = first;
+      std::advance(last, 10);
+
+      int last_value = last->value;
+
+      Set::iterator result = set.erase(first, last);
+
+      CHECK_EQUAL(15U, set.size());
+      CHECK_EQUAL(last_value, result->value);
+
+      result = set.erase(set.begin(), set.end());
+
+      CHECK(result == set.end());
+      CHECK(set.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      set.clear();
+
+      CHECK(set.empty());
+      CHECK(set.begin() == set.end());
+
+      set.insert(items[6]);
+      CHECK_EQUAL(6, set.begin()->value);
+    }
+
+    //*************************************************************************
+    TEST(test_two_sets_different_links)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set  set1(items.begin(), items.end());
+      Set2 set2(items.begin(), items.end());
+
+      set1.erase(Item(3));
+
+      CHECK_EQUAL(9U, set1.size());
+      CHECK_EQUAL(10U, set2.size());
+      CHECK(&*set2.find(Item(3)) == &items[3]);
+    }
+  };
+}
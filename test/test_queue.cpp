@@ -29,6 +29,8 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <queue>
+#include <string>
+#include <string.h>
 
 #include "queue.h"
 
@@ -337,6 +339,37 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_assignment_wrapped)
+    {
+      etl::queue<int, 4> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.pop();
+      queue.pop();
+      queue.push(4);
+      queue.push(5);
+      queue.push(6);
+
+      etl::queue<int, 4> queue2;
+
+      queue2.push(0);
+      queue2.pop();
+
+      queue2 = queue;
+
+      CHECK(queue.size() == queue2.size());
+
+      while (!queue.empty())
+      {
+        CHECK_EQUAL(queue.front(), queue2.front());
+        queue.pop();
+        queue2.pop();
+      }
+    }
+
     //*************************************************************************
     TEST(test_assignment_interface)
     {
@@ -390,5 +423,77 @@ namespace
       CHECK_EQUAL(4, queue.front());
       queue.pop();
     }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_peek_consume)
+    {
+      etl::queue<uint8_t, 8> queue;
+      const uint8_t data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+      std::pair<uint8_t*, size_t> region = queue.reserve();
+      CHECK_EQUAL(8U, region.second);
+
+      // As if from 'read'.
+      memcpy(region.first, data, 6);
+      queue.commit(6);
+      CHECK_EQUAL(6U, queue.size());
+
+      std::pair<uint8_t*, size_t> items = queue.peek();
+      CHECK_EQUAL(6U, items.second);
+      CHECK(std::equal(data, data + 6, items.first));
+
+      queue.consume(4);
+      CHECK_EQUAL(4, queue.front());
+
+      // The free storage wraps, so is returned as two runs.
+      region = queue.reserve();
+      CHECK_EQUAL(2U, region.second);
+      memcpy(region.first, data + 6, region.second);
+      queue.commit(region.second);
+
+      region = queue.reserve();
+      CHECK_EQUAL(4U, region.second);
+      memcpy(region.first, data + 8, region.second);
+      queue.commit(region.second);
+
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.reserve().second);
+      CHECK_THROW(queue.commit(1), etl::queue_full);
+
+      // The items are returned as two runs.
+      const etl::queue<uint8_t, 8>& cqueue = queue;
+      std::pair<const uint8_t*, size_t> citems = cqueue.peek();
+      CHECK_EQUAL(4U, citems.second);
+      CHECK(std::equal(data + 4, data + 8, citems.first));
+
+      queue.consume(citems.second);
+      items = queue.peek();
+      CHECK_EQUAL(4U, items.second);
+      CHECK(std::equal(data + 8, data + 12, items.first));
+
+      CHECK_THROW(queue.consume(5), etl::queue_empty);
+
+      // Empty, so the run starts at the beginning of the storage.
+      queue.consume(4);
+      region = queue.reserve();
+      CHECK_EQUAL(8U, region.second);
+    }
+
+    //*************************************************************************
+    TEST(test_consume_non_trivial)
+    {
+      etl::queue<std::string, 4> queue;
+
+      queue.push("A");
+      queue.push("B");
+      queue.push("C");
+      queue.pop();
+      queue.push("D");
+      queue.push("E");
+
+      queue.consume(3);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL("E", queue.front());
+    }
   };
 }
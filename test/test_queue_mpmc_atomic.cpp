@@ -0,0 +1,237 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "platform.h"
+
+#if defined(ETL_ATOMIC_SUPPORTED)
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "queue_mpmc_atomic.h"
+
+namespace
+{
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK_EQUAL(4U, queue.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_to_capacity_when_constructed)
+    {
+      etl::queue_mpmc_atomic<int, 8> queue;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(queue.try_push(i));
+      }
+
+      CHECK(queue.full());
+      CHECK(!queue.try_push(8));
+
+      int value = -1;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(queue.try_pop(value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      iqueue.push(1);
+      CHECK(iqueue.try_push(2));
+      CHECK(iqueue.try_push(3));
+      CHECK(iqueue.try_push(4));
+      CHECK(iqueue.full());
+      CHECK_EQUAL(4U, iqueue.size());
+      CHECK(!iqueue.try_push(5));
+
+      int value = 0;
+
+      iqueue.pop(value);
+      CHECK_EQUAL(1, value);
+      CHECK(iqueue.try_pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      // Several laps of the buffer.
+      int next_in  = 5;
+      int next_out = 3;
+
+      for (int lap = 0; lap < 10; ++lap)
+      {
+        while (iqueue.try_push(next_in))
+        {
+          ++next_in;
+        }
+
+        CHECK(iqueue.full());
+
+        while (iqueue.try_pop(value))
+        {
+          CHECK_EQUAL(next_out, value);
+          ++next_out;
+        }
+
+        CHECK(iqueue.empty());
+      }
+
+      CHECK_EQUAL(next_in, next_out);
+      CHECK(!iqueue.try_pop(value));
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_type)
+    {
+      etl::queue_mpmc_atomic<std::string, 2> queue;
+
+      CHECK(queue.try_push(std::string("A")));
+      CHECK(queue.try_push(std::string("B")));
+      CHECK(!queue.try_push(std::string("C")));
+
+      std::string value;
+      CHECK(queue.try_pop(value));
+      CHECK_EQUAL("A", value);
+
+      CHECK(queue.try_push(std::string("C")));
+      queue.clear();
+      CHECK(queue.empty());
+
+      CHECK(queue.try_push(std::string("D")));
+      CHECK(queue.try_pop(value));
+      CHECK_EQUAL("D", value);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers_and_consumers)
+    {
+      const uint32_t PRODUCERS = 4;
+      const uint32_t CONSUMERS = 3;
+      const uint32_t COUNT     = 50000;
+
+      etl::queue_mpmc_atomic<uint32_t, 64> queue;
+
+      std::vector<std::thread> threads;
+      std::vector<uint64_t>    sums(CONSUMERS, 0);
+      std::vector<uint32_t>    counts(CONSUMERS, 0);
+      std::vector<int>         in_order(CONSUMERS, 1);
+      std::atomic<uint32_t>    remaining(PRODUCERS * COUNT);
+
+      for (uint32_t p = 0; p < PRODUCERS; ++p)
+      {
+        threads.push_back(std::thread([&queue, p, COUNT]()
+        {
+          for (uint32_t i = 0; i < COUNT; ++i)
+          {
+            while (!queue.try_push((p << 24) | i))
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      for (uint32_t c = 0; c < CONSUMERS; ++c)
+      {
+        threads.push_back(std::thread([&, c]()
+        {
+          // Each consumer sees the values from any one producer in order.
+          std::vector<int32_t> last(PRODUCERS, -1);
+          uint32_t value;
+
+          while (remaining.load() > 0)
+          {
+            if (queue.try_pop(value))
+            {
+              --remaining;
+
+              uint32_t producer = value >> 24;
+              int32_t  sequence = int32_t(value & 0xFFFFFF);
+
+              if (sequence <= last[producer])
+              {
+                in_order[c] = 0;
+              }
+
+              last[producer] = sequence;
+              sums[c] += sequence;
+              ++counts[c];
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      uint64_t total_sum   = 0;
+      uint32_t total_count = 0;
+
+      for (uint32_t c = 0; c < CONSUMERS; ++c)
+      {
+        CHECK(in_order[c] == 1);
+        total_sum   += sums[c];
+        total_count += counts[c];
+      }
+
+      CHECK_EQUAL(PRODUCERS * COUNT, total_count);
+      CHECK_EQUAL(uint64_t(PRODUCERS) * (uint64_t(COUNT) * (COUNT - 1) / 2), total_sum);
+      CHECK(queue.empty());
+    }
+  };
+}
+
+#endif
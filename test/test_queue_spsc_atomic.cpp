@@ -0,0 +1,211 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "platform.h"
+
+#if defined(ETL_ATOMIC_SUPPORTED)
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "queue_spsc_atomic.h"
+
+namespace
+{
+  SUITE(test_queue_spsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK_EQUAL(4U, queue.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+      etl::iqueue_spsc_atomic<int>& iqueue = queue;
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK(iqueue.push(3));
+      CHECK(iqueue.push(4));
+      CHECK(iqueue.full());
+      CHECK_EQUAL(4U, iqueue.size());
+      CHECK(!iqueue.push(5));
+
+      int value = 0;
+
+      CHECK(iqueue.pop(value));
+      CHECK_EQUAL(1, value);
+      CHECK(iqueue.pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK_EQUAL(2U, iqueue.available());
+
+      // Wrap around the end of the buffer.
+      CHECK(iqueue.push(5));
+      CHECK(iqueue.push(6));
+      CHECK(!iqueue.push(7));
+
+      for (int i = 3; i <= 6; ++i)
+      {
+        CHECK(iqueue.pop(value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(iqueue.empty());
+      CHECK(!iqueue.pop(value));
+      CHECK(!iqueue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      const int input[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+      int output[8] = { 0 };
+
+      CHECK_EQUAL(3U, queue.push(input, input + 3));
+      CHECK_EQUAL(2U, queue.pop(output, 2));
+      CHECK_EQUAL(0, output[0]);
+      CHECK_EQUAL(1, output[1]);
+
+      // Partially pushed, wrapping around the end of the buffer.
+      CHECK_EQUAL(4U, queue.push(input + 3, input + 8));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(input, input + 1));
+
+      // Partially popped.
+      CHECK_EQUAL(5U, queue.pop(output, 8));
+      CHECK_EQUAL(2, output[0]);
+      CHECK_EQUAL(3, output[1]);
+      CHECK_EQUAL(4, output[2]);
+      CHECK_EQUAL(5, output[3]);
+      CHECK_EQUAL(6, output[4]);
+      CHECK_EQUAL(0U, queue.pop(output, 8));
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_type)
+    {
+      etl::queue_spsc_atomic<std::string, 3> queue;
+
+      CHECK(queue.push(std::string("A")));
+      CHECK(queue.push(std::string("B")));
+
+      std::vector<std::string> values;
+      values.push_back("C");
+      values.push_back("D");
+
+      CHECK_EQUAL(1U, queue.push(values.begin(), values.end()));
+
+      std::string value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL("A", value);
+
+      std::vector<std::string> output;
+      CHECK_EQUAL(2U, queue.pop(std::back_inserter(output), 5));
+      CHECK_EQUAL("B", output[0]);
+      CHECK_EQUAL("C", output[1]);
+
+      CHECK(queue.push(std::string("E")));
+      queue.clear();
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_two_threads)
+    {
+      etl::queue_spsc_atomic<uint32_t, 64> queue;
+
+      const uint32_t COUNT = 200000;
+
+      std::thread producer([&]()
+      {
+        uint32_t next = 0;
+        uint32_t batch[8];
+
+        while (next < COUNT)
+        {
+          if ((next % 3) == 0)
+          {
+            if (queue.push(next))
+            {
+              ++next;
+            }
+          }
+          else
+          {
+            size_t n = std::min<uint32_t>(8, COUNT - next);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+              batch[i] = next + uint32_t(i);
+            }
+
+            next += uint32_t(queue.push(batch, batch + n));
+          }
+        }
+      });
+
+      uint32_t expected = 0;
+      bool     in_order = true;
+      uint32_t batch[5];
+
+      while (expected < COUNT)
+      {
+        size_t n = queue.pop(batch, 5);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          in_order = in_order && (batch[i] == expected);
+          ++expected;
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK_EQUAL(COUNT, expected);
+      CHECK(queue.empty());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,289 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <functional>
+#include <utility>
+#include <algorithm>
+
+#include "radix_heap.h"
+
+namespace
+{
+  typedef std::pair<uint32_t, int> Entry;
+
+  typedef etl::radix_heap<int, 100> Heap;
+  typedef etl::iradix_heap<int>     IHeap;
+
+  //***************************************************************************
+  // A simple linear congruential generator, for repeatable sequences.
+  //***************************************************************************
+  struct Random
+  {
+    Random(uint32_t seed_)
+      : seed(seed_)
+    {
+    }
+
+    uint32_t operator ()()
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      return seed >> 8;
+    }
+
+    uint32_t seed;
+  };
+
+  SUITE(test_radix_heap)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Heap heap;
+
+      CHECK(heap.empty());
+      CHECK(!heap.full());
+      CHECK_EQUAL(0U, heap.size());
+      CHECK_EQUAL(100U, heap.max_size());
+      CHECK_EQUAL(100U, heap.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_ordered)
+    {
+      Heap heap;
+
+      const uint32_t keys[] = { 50, 3, 1000000, 3, 17, 0, 65535, 4096, 17, 8 };
+      const size_t   count  = sizeof(keys) / sizeof(keys[0]);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        heap.push(keys[i], int(i));
+      }
+
+      CHECK_EQUAL(count, heap.size());
+
+      std::vector<uint32_t> sorted(keys, keys + count);
+      std::sort(sorted.begin(), sorted.end());
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        CHECK_EQUAL(sorted[i], heap.top_key());
+        CHECK_EQUAL(sorted[i], keys[heap.top()]);
+        heap.pop();
+      }
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_after_pop)
+    {
+      Heap heap;
+
+      heap.push(10, 1);
+      heap.push(20, 2);
+
+      CHECK_EQUAL(10U, heap.top_key());
+      heap.pop();
+
+      // Keys equal to or greater than the last removed are allowed.
+      heap.push(10, 3);
+      heap.push(15, 4);
+
+      CHECK_EQUAL(10U, heap.top_key());
+      CHECK_EQUAL(3, heap.top());
+      heap.pop();
+
+      CHECK_EQUAL(15U, heap.top_key());
+      CHECK_EQUAL(4, heap.top());
+      heap.pop();
+
+      CHECK_EQUAL(20U, heap.top_key());
+      CHECK_EQUAL(2, heap.top());
+      heap.pop();
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_smaller_than_last)
+    {
+      Heap heap;
+
+      heap.push(10, 1);
+      heap.push(20, 2);
+      heap.pop();
+
+      CHECK_EQUAL(20U, heap.top_key());
+
+      CHECK_THROW(heap.push(5, 3), etl::radix_heap_key);
+    }
+
+    //*************************************************************************
+    TEST(test_push_below_peeked_top)
+    {
+      Heap heap;
+
+      heap.push(5, 1);
+      heap.push(10, 2);
+      heap.pop();
+      heap.push(20, 3);
+      heap.push(40, 4);
+
+      CHECK_EQUAL(10U, heap.top_key());
+
+      // Not below the last key popped, so allowed.
+      heap.push(7, 5);
+      heap.push(5, 6);
+      CHECK_THROW(heap.push(4, 7), etl::radix_heap_key);
+
+      const unsigned keys[]   = { 5, 7, 10, 20, 40 };
+      const int      values[] = { 6, 5, 2, 3, 4 };
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(keys[i], heap.top_key());
+        CHECK_EQUAL(values[i], heap.top());
+        heap.pop();
+      }
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::radix_heap<int, 4> heap;
+
+      heap.push(1, 1);
+      heap.push(2, 2);
+      heap.push(3, 3);
+      heap.push(4, 4);
+
+      CHECK(heap.full());
+      CHECK_EQUAL(0U, heap.available());
+      CHECK_THROW(heap.push(5, 5), etl::radix_heap_full);
+
+      // Nodes are reused.
+      heap.pop();
+      heap.push(5, 5);
+      CHECK(heap.full());
+
+      for (int i = 2; i <= 5; ++i)
+      {
+        CHECK_EQUAL(i, heap.top());
+        heap.pop();
+      }
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::radix_heap<std::string, 10, uint16_t> heap;
+
+      heap.push(100, "a");
+      heap.push(200, "b");
+      heap.pop();
+
+      heap.clear();
+
+      CHECK(heap.empty());
+
+      // The last key is reset.
+      heap.push(1, "c");
+      CHECK_EQUAL(1U, heap.top_key());
+      CHECK_EQUAL(std::string("c"), heap.top());
+    }
+
+    //*************************************************************************
+    TEST(test_64_bit_keys)
+    {
+      etl::radix_heap<int, 10, uint64_t> heap;
+
+      heap.push(0xFFFFFFFFFFFFFFFFULL, 1);
+      heap.push(0x8000000000000000ULL, 2);
+      heap.push(0x0000000100000000ULL, 3);
+      heap.push(0, 4);
+
+      CHECK_EQUAL(4, heap.top()); heap.pop();
+      CHECK_EQUAL(3, heap.top()); heap.pop();
+      CHECK_EQUAL(2, heap.top()); heap.pop();
+      CHECK_EQUAL(1, heap.top()); heap.pop();
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_random_monotone_against_priority_queue)
+    {
+      etl::radix_heap<int, 1000> heap;
+      IHeap& iheap = heap;
+
+      std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > compare;
+
+      Random random(1);
+      uint32_t last = 0;
+      int value = 0;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        if (!iheap.full() && (iheap.empty() || ((random() % 3) != 0)))
+        {
+          // Dijkstra like: the new key is the last key plus a bounded weight.
+          uint32_t key = last + (random() % 1000);
+
+          iheap.push(key, value);
+          compare.push(Entry(key, value));
+          ++value;
+        }
+        else
+        {
+          CHECK_EQUAL(compare.top().first, iheap.top_key());
+          last = iheap.top_key();
+
+          // Values with equal keys may come out in any order.
+          while (!compare.empty() && (compare.top().first == last))
+          {
+            CHECK_EQUAL(last, iheap.top_key());
+            compare.pop();
+            iheap.pop();
+          }
+        }
+
+        CHECK_EQUAL(compare.size(), iheap.size());
+      }
+    }
+  };
+}
@@ -57,6 +57,9 @@ namespace
   typedef etl::ireference_flat_map<int, DC>       IDataDC;
   typedef etl::ireference_flat_map<int, NDC>      IDataNDC;
 
+  typedef etl::reference_flat_map<int, NDC, SIZE, std::less<int>, etl::interpolation_search_policy> DataNDCInterpolation;
+  typedef etl::reference_flat_map<int, NDC, SIZE, std::less<int>, etl::exponential_search_policy>   DataNDCExponential;
+
   typedef std::map<int, DC>  Compare_DataDC;
   typedef std::map<int, NDC> Compare_DataNDC;
 
@@ -532,6 +535,64 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merge)
+    {
+      ElementNDC initial[] = { ElementNDC(1, N1), ElementNDC(5, N5) };
+
+      ElementNDC n[] =
+      {
+        ElementNDC(7, N7), ElementNDC(2, N2), ElementNDC(9, N9), ElementNDC(2, N12), ElementNDC(0, N0),
+        ElementNDC(5, N15), ElementNDC(4, N4), ElementNDC(8, N8), ElementNDC(6, N6)
+      };
+
+      Compare_DataNDC compare_data(std::begin(initial), std::end(initial));
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(n), std::end(n));
+      compare_data.insert(std::begin(n), std::end(n));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      ElementNDC initial[] = { ElementNDC(1, N1), ElementNDC(5, N5) };
+
+      Compare_DataNDC compare_data(std::begin(initial), std::end(initial));
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      data.insert_sorted(initial_data.begin(), initial_data.end());
+      compare_data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_not_sorted)
+    {
+      ElementNDC initial[] = { ElementNDC(1, N1), ElementNDC(5, N5) };
+      ElementNDC unsorted[] = { ElementNDC(0, N0), ElementNDC(3, N3), ElementNDC(2, N2) };
+
+      DataNDC data(std::begin(initial), std::end(initial));
+
+      CHECK_THROW(data.insert_sorted(std::begin(unsorted), std::end(unsorted)), etl::flat_map_not_sorted);
+      CHECK_EQUAL(2U, data.size());
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -765,6 +826,68 @@ namespace
       CHECK_EQUAL(data.end(), i_data.second);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_interpolation_search)
+    {
+      ElementNDC skewed[] =
+      {
+        ElementNDC(0, N0), ElementNDC(1, N1), ElementNDC(2, N2), ElementNDC(3, N3), ElementNDC(50, N4),
+        ElementNDC(51, N5), ElementNDC(52, N6), ElementNDC(1000, N7), ElementNDC(1001, N8), ElementNDC(20000, N9)
+      };
+
+      Compare_DataNDC compare_data(std::begin(skewed), std::end(skewed));
+      const DataNDCInterpolation data(std::begin(skewed), std::end(skewed));
+
+      for (int key = -10; key < 20010; ++key)
+      {
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        CHECK_EQUAL(compare_data.count(key), data.count(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_exponential_search_insert_hint)
+    {
+      ElementNDC n[] =
+      {
+        ElementNDC(5, N5), ElementNDC(9, N9), ElementNDC(0, N0), ElementNDC(7, N7), ElementNDC(2, N2),
+        ElementNDC(8, N8), ElementNDC(1, N1), ElementNDC(6, N6), ElementNDC(3, N3), ElementNDC(4, N4)
+      };
+
+      Compare_DataNDC compare_data;
+      DataNDCExponential data;
+
+      // Hints at the start, end and middle, both right and wrong.
+      for (size_t i = 0; i < (sizeof(n) / sizeof(n[0])); ++i)
+      {
+        DataNDCExponential::iterator hint = data.begin();
+        std::advance(hint, data.size() / ((i % 3) + 1));
+
+        DataNDCExponential::iterator i_data = data.insert(hint, n[i]);
+        compare_data.insert(n[i]);
+
+        CHECK_EQUAL(n[i].first, i_data->first);
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+
+      for (int key = -1; key < 12; ++key)
+      {
+        std::pair<Compare_DataNDC::iterator, Compare_DataNDC::iterator> i_compare = compare_data.equal_range(key);
+        std::pair<DataNDCExponential::iterator, DataNDCExponential::iterator> i_data = data.equal_range(key);
+
+        CHECK_EQUAL(std::distance(compare_data.begin(), i_compare.first),  std::distance(data.begin(), i_data.first));
+        CHECK_EQUAL(std::distance(compare_data.begin(), i_compare.second), std::distance(data.begin(), i_data.second));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_equal)
     {
@@ -2234,6 +2234,67 @@ namespace
       CHECK_EQUAL(etl::istring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_rfind_long_haystack)
+    {
+      // Long enough to exercise the vectorised search, with near misses.
+      const value_t* the_haystack = STR("needle neede nedle eedle needl needle needleneedle nee dle needle  n ne nee need needl needle");
+
+      const value_t* needles[] = { STR("needle"), STR("needleneedle"), STR("e"), STR("le n"), STR("needl"), STR("e  n"), STR("x"), STR("needle needle needle") };
+
+      Compare_Text compare_haystack(the_haystack);
+      etl::string<200> haystack(the_haystack);
+
+      for (size_t n = 0; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+      {
+        Compare_Text compare_needle(needles[n]);
+        etl::string<200> needle(needles[n]);
+
+        for (size_t position = 0; position <= (compare_haystack.size() + 1); ++position)
+        {
+          CHECK_EQUAL(compare_haystack.find(compare_needle, position), haystack.find(needle, position));
+          CHECK_EQUAL(compare_haystack.rfind(compare_needle, position), haystack.rfind(needle, position));
+        }
+
+        CHECK_EQUAL(compare_haystack.rfind(compare_needle), haystack.rfind(needle));
+      }
+
+      // Empty needle.
+      CHECK_EQUAL(compare_haystack.find(STR(""), 3), haystack.find(STR(""), 3));
+      CHECK_EQUAL(compare_haystack.rfind(STR(""), 3), haystack.rfind(STR(""), 3));
+      CHECK_EQUAL(compare_haystack.rfind(STR("")), haystack.rfind(STR("")));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_first_of_all_characters)
+    {
+      // Characters from the whole of the byte range, including those with the top bit set.
+      Compare_Text compare_text;
+
+      for (int c = 1; c < 256; c += 3)
+      {
+        compare_text.push_back(char(c));
+      }
+
+      etl::string<200> text(compare_text.c_str());
+
+      const char set[] = { char(0x04), char(0x7F), char(0x80), char(0xA0), char(0xFD), char(0x41) };
+
+      Compare_Text compare_set(set, sizeof(set));
+
+      for (size_t position = 0; position <= compare_text.size(); ++position)
+      {
+        CHECK_EQUAL(compare_text.find_first_of(compare_set.c_str(), position, compare_set.size()),     text.find_first_of(set, position, sizeof(set)));
+        CHECK_EQUAL(compare_text.find_last_of(compare_set.c_str(), position, compare_set.size()),      text.find_last_of(set, position, sizeof(set)));
+        CHECK_EQUAL(compare_text.find_first_not_of(compare_set.c_str(), position, compare_set.size()), text.find_first_not_of(set, position, sizeof(set)));
+        CHECK_EQUAL(compare_text.find_last_not_of(compare_set.c_str(), position, compare_set.size()),  text.find_last_not_of(set, position, sizeof(set)));
+      }
+
+      // Every character is in the set.
+      CHECK_EQUAL(etl::istring::npos, text.find_first_not_of(compare_text.c_str(), 0, compare_text.size()));
+      CHECK_EQUAL(etl::istring::npos, text.find_last_not_of(compare_text.c_str(), etl::istring::npos, compare_text.size()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_substr)
     {
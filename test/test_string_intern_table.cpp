@@ -0,0 +1,197 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <stdio.h>
+#include <string>
+#include <map>
+
+#include "string_intern_table.h"
+#include "cstring.h"
+#include "string_view.h"
+
+namespace
+{
+  typedef etl::string_intern_table<16, 128> Table;
+
+  SUITE(test_string_intern_table)
+  {
+    //*************************************************************************
+    TEST(test_intern)
+    {
+      Table table;
+
+      CHECK(table.empty());
+
+      const size_t temperature = table.intern("temperature");
+      const size_t pressure    = table.intern(etl::string_view("pressure"));
+      const size_t humidity    = table.intern(etl::string<20>("humidity"));
+
+      CHECK_EQUAL(0U, temperature);
+      CHECK_EQUAL(1U, pressure);
+      CHECK_EQUAL(2U, humidity);
+      CHECK_EQUAL(3U, table.size());
+
+      // The same string gives the same ID.
+      CHECK_EQUAL(pressure, table.intern("pressure"));
+      CHECK_EQUAL(temperature, table.intern("temperature", 11));
+      CHECK_EQUAL(3U, table.size());
+
+      CHECK(etl::string_view("temperature") == table.view(temperature));
+      CHECK(etl::string_view("pressure") == table[pressure]);
+      CHECK_EQUAL(std::string("humidity"), std::string(table.c_str(humidity)));
+
+      CHECK_EQUAL(12U + 9U + 9U, table.bytes_used());
+      CHECK_EQUAL(128U - table.bytes_used(), table.bytes_available());
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      Table table;
+
+      table.intern("alpha");
+      table.intern("beta");
+
+      CHECK_EQUAL(1U, table.find("beta"));
+      CHECK_EQUAL(0U, table.find(etl::string<10>("alpha")));
+      CHECK(table.find("gamma") == Table::npos);
+      CHECK(table.find("alph") == Table::npos);
+      CHECK(table.find("alphab") == Table::npos);
+      CHECK(table.contains(etl::string_view("beta")));
+      CHECK(!table.contains(etl::string_view("gamma")));
+
+      // find does not add.
+      CHECK_EQUAL(2U, table.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty_string_and_embedded_prefixes)
+    {
+      Table table;
+
+      const size_t empty = table.intern("", 0);
+      const size_t ab    = table.intern("ab", 2);
+      const size_t a     = table.intern("ab", 1);
+
+      CHECK(empty != ab);
+      CHECK(a != ab);
+      CHECK_EQUAL(0U, table.view(empty).size());
+      CHECK(etl::string_view("a") == table.view(a));
+      CHECK_EQUAL(empty, table.find("", 0));
+    }
+
+    //*************************************************************************
+    TEST(test_many_strings)
+    {
+      etl::string_intern_table<1000, 16000> table;
+      std::map<std::string, size_t> expected;
+
+      char name[20];
+
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        for (int i = 0; i < 1000; ++i)
+        {
+          sprintf(name, "symbol_%d", (i * 7919) % 1000);
+
+          const size_t id = table.intern(name);
+
+          if (pass == 0)
+          {
+            expected.insert(std::make_pair(std::string(name), id));
+          }
+
+          CHECK_EQUAL(expected[name], id);
+        }
+      }
+
+      CHECK_EQUAL(1000U, table.size());
+      CHECK(table.full());
+
+      for (std::map<std::string, size_t>::const_iterator itr = expected.begin(); itr != expected.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, table.find(itr->first.c_str()));
+        CHECK(etl::string_view(itr->first.c_str()) == table.view(itr->second));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::string_intern_table<2, 10> table;
+
+      table.intern("abcd");
+
+      // 5 bytes used. "abcde" needs 6.
+      CHECK_THROW(table.intern("abcde"), etl::string_intern_table_full);
+      CHECK_EQUAL(1U, table.intern("abcd", 3));
+
+      // Existing strings are still found when full.
+      CHECK_EQUAL(0U, table.intern("abcd"));
+      CHECK_THROW(table.intern("x"), etl::string_intern_table_full);
+
+      CHECK_EQUAL(2U, table.size());
+    }
+
+    //*************************************************************************
+    TEST(test_out_of_bounds)
+    {
+      Table table;
+
+      table.intern("one");
+
+      CHECK_THROW(table.view(1), etl::string_intern_table_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Table table;
+
+      table.intern("one");
+      table.intern("two");
+      table.clear();
+
+      CHECK(table.empty());
+      CHECK_EQUAL(0U, table.bytes_used());
+      CHECK(table.find("one") == Table::npos);
+      CHECK_EQUAL(0U, table.intern("two"));
+    }
+
+    //*************************************************************************
+    TEST(test_id_type)
+    {
+      CHECK_EQUAL(1U, sizeof(etl::string_intern_table<200, 4000>::id_type));
+      CHECK_EQUAL(2U, sizeof(etl::string_intern_table<4000, 40000>::id_type));
+    }
+  };
+}
@@ -0,0 +1,373 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "string_searcher.h"
+#include "cstring.h"
+#include "wstring.h"
+#include "string_view.h"
+
+namespace
+{
+  typedef etl::boyer_moore_horspool_searcher<char, 16>    Searcher;
+  typedef etl::aho_corasick_searcher<char, 64>            MultiSearcher;
+
+  //***************************************************************************
+  // A pseudo random sequence.
+  //***************************************************************************
+  uint32_t next_random(uint32_t& state)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    return state;
+  }
+
+  std::string random_text(uint32_t& state, size_t length, char alphabet)
+  {
+    std::string text;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+      text += char('a' + (next_random(state) % uint32_t(alphabet)));
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  // Records each match as (end position, pattern).
+  //***************************************************************************
+  struct Recorder
+  {
+    Recorder(const char* text_, std::vector<std::pair<size_t, size_t> >& matches_)
+      : text(text_),
+        matches(matches_)
+    {
+    }
+
+    void operator ()(const MultiSearcher::match& m)
+    {
+      matches.push_back(std::make_pair(size_t(m.position - text) + m.length, m.pattern));
+    }
+
+    const char* text;
+    std::vector<std::pair<size_t, size_t> >& matches;
+  };
+
+  SUITE(test_string_searcher)
+  {
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_find)
+    {
+      etl::string<20> pattern("needle");
+      Searcher searcher(pattern);
+
+      etl::string<60> text("haystack needle haystack needle");
+      etl::string_view view(text.data(), text.size());
+
+      CHECK_EQUAL(6U, searcher.size());
+      CHECK_EQUAL(9U, searcher.find(text));
+      CHECK_EQUAL(25U, searcher.find(text, 10));
+      CHECK_EQUAL(25U, searcher.find(view, 25));
+      CHECK(searcher.find(view, 26) == Searcher::npos);
+      CHECK(searcher.find(text, 100) == Searcher::npos);
+
+      const char* p_text = text.c_str();
+      CHECK(p_text + 9 == searcher.search(p_text, p_text + text.size()));
+      CHECK(p_text + 14 == searcher.search(p_text, p_text + 14));
+
+      std::pair<const char*, const char*> range = searcher(p_text, p_text + text.size());
+      CHECK(range.first == p_text + 9);
+      CHECK(range.second == p_text + 15);
+
+      CHECK(etl::string_view("needle") == searcher.view());
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_edge_cases)
+    {
+      Searcher empty;
+      etl::string<10> text("abc");
+
+      CHECK_EQUAL(0U, empty.find(text));
+      CHECK_EQUAL(3U, empty.find(text, 3));
+
+      Searcher single("c", 1);
+      CHECK_EQUAL(2U, single.find(text));
+
+      Searcher whole("abc", 3);
+      CHECK_EQUAL(0U, whole.find(text));
+
+      Searcher longer("abcd", 4);
+      CHECK(longer.find(text) == Searcher::npos);
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_matches_std_search)
+    {
+      uint32_t state = 0x12345678;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        const std::string text    = random_text(state, 1 + (next_random(state) % 200), char(2 + (i % 4)));
+        const std::string pattern = random_text(state, 1 + (next_random(state) % 16), char(2 + (i % 4)));
+
+        Searcher searcher(pattern.data(), pattern.size());
+
+        size_t position = 0;
+
+        while (true)
+        {
+          const size_t expected = text.find(pattern, position);
+          const size_t actual   = searcher.find(etl::string_view(text.data(), text.size()), position);
+
+          CHECK_EQUAL(expected == std::string::npos, actual == Searcher::npos);
+
+          if ((expected == std::string::npos) || (actual == Searcher::npos))
+          {
+            break;
+          }
+
+          CHECK_EQUAL(expected, actual);
+          position = expected + 1;
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_wide)
+    {
+      // 0x141 and 0x241 share the low byte of 'A', so share a shift table entry.
+      const wchar_t pattern[] = { wchar_t(0x141), L'B', wchar_t(0x241), 0 };
+
+      etl::boyer_moore_horspool_searcher<wchar_t, 8> searcher(pattern, 3);
+
+      etl::wstring<20> text(L"AAAA");
+      text.append(pattern);
+      text.append(L"A");
+
+      CHECK_EQUAL(4U, searcher.find(text));
+
+      etl::wstring<20> other(L"ABAxAB");
+      CHECK(searcher.find(other) == searcher.npos);
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_pattern_too_long)
+    {
+      CHECK_THROW(Searcher("0123456789ABCDEFG", 17), etl::string_searcher_full);
+    }
+
+    //*************************************************************************
+    TEST(test_aho_corasick_search)
+    {
+      MultiSearcher searcher;
+
+      CHECK(searcher.empty());
+      CHECK_EQUAL(0U, searcher.add(etl::string<10>("he")));
+      CHECK_EQUAL(1U, searcher.add(etl::string_view("she")));
+      CHECK_EQUAL(2U, searcher.add("his", 3));
+      CHECK_EQUAL(3U, searcher.add("hers", 4));
+      CHECK_EQUAL(1U, searcher.add("she", 3));
+      CHECK_EQUAL(4U, searcher.size());
+
+      const etl::string<20> text("ushers");
+
+      // 'she' and 'he' both end at 4. The longest is returned.
+      MultiSearcher::match m = searcher.search(text);
+      CHECK(m.position == text.data() + 1);
+      CHECK_EQUAL(1U, m.pattern);
+      CHECK_EQUAL(3U, m.length);
+
+      const etl::string<20> none("xyz");
+      m = searcher.search(none);
+      CHECK(m.position == none.data() + none.size());
+      CHECK(m.pattern == MultiSearcher::npos);
+    }
+
+    //*************************************************************************
+    TEST(test_aho_corasick_for_each_match)
+    {
+      MultiSearcher searcher;
+
+      searcher.add("he", 2);
+      searcher.add("she", 3);
+      searcher.add("his", 3);
+      searcher.add("hers", 4);
+
+      const char* text = "ushers";
+      std::vector<std::pair<size_t, size_t> > matches;
+
+      CHECK_EQUAL(3U, searcher.for_each_match(text, text + strlen(text), Recorder(text, matches)));
+      CHECK_EQUAL(3U, matches.size());
+
+      std::sort(matches.begin(), matches.end());
+
+      CHECK(std::make_pair(size_t(4), size_t(0)) == matches[0]);
+      CHECK(std::make_pair(size_t(4), size_t(1)) == matches[1]);
+      CHECK(std::make_pair(size_t(6), size_t(3)) == matches[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_aho_corasick_matches_brute_force)
+    {
+      uint32_t state = 0x87654321;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        const char alphabet = char(2 + (i % 3));
+
+        MultiSearcher searcher;
+        std::vector<std::string> patterns;
+
+        for (int p = 0; p < 6; ++p)
+        {
+          const std::string pattern = random_text(state, 1 + (next_random(state) % 6), alphabet);
+          const size_t index = searcher.add(pattern.data(), pattern.size());
+
+          if (index == patterns.size())
+          {
+            patterns.push_back(pattern);
+          }
+          else
+          {
+            CHECK(patterns[index] == pattern);
+          }
+        }
+
+        const std::string text = random_text(state, next_random(state) % 100, alphabet);
+
+        std::vector<std::pair<size_t, size_t> > expected;
+
+        for (size_t p = 0; p < patterns.size(); ++p)
+        {
+          for (size_t position = text.find(patterns[p]); position != std::string::npos; position = text.find(patterns[p], position + 1))
+          {
+            expected.push_back(std::make_pair(position + patterns[p].size(), p));
+          }
+        }
+
+        std::vector<std::pair<size_t, size_t> > actual;
+        searcher.for_each_match(text.data(), text.data() + text.size(), Recorder(text.data(), actual));
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+
+        CHECK(expected == actual);
+
+        // search returns the match that ends first.
+        MultiSearcher::match first = searcher.search(text.data(), text.data() + text.size());
+
+        if (expected.empty())
+        {
+          CHECK(first.pattern == MultiSearcher::npos);
+        }
+        else
+        {
+          CHECK_EQUAL(expected[0].first, size_t(first.position - text.data()) + first.length);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_aho_corasick_add_after_search)
+    {
+      MultiSearcher searcher;
+      const MultiSearcher& const_searcher = searcher;
+
+      const etl::string<20> text("ushers");
+
+      searcher.add("hers", 4);
+      searcher.build();
+
+      MultiSearcher::match m = const_searcher.search(text);
+      CHECK_EQUAL(0U, m.pattern);
+
+      // The links are rebuilt by the next search.
+      searcher.add("she", 3);
+      searcher.add("he", 2);
+
+      m = const_searcher.search(text);
+      CHECK_EQUAL(1U, m.pattern);
+      CHECK(m.position == text.data() + 1);
+
+      std::vector<std::pair<size_t, size_t> > matches;
+      CHECK_EQUAL(3U, const_searcher.for_each_match(text.data(), text.data() + text.size(), Recorder(text.data(), matches)));
+
+      searcher.clear();
+      m = const_searcher.search(text);
+      CHECK(m.pattern == MultiSearcher::npos);
+    }
+
+    //*************************************************************************
+    TEST(test_aho_corasick_full)
+    {
+      etl::aho_corasick_searcher<char, 6> searcher;
+
+      CHECK_EQUAL(0U, searcher.add("abcde", 5));
+      CHECK_EQUAL(6U, searcher.states_size());
+
+      // Shares the prefix, so needs no new states.
+      CHECK_EQUAL(1U, searcher.add("abc", 3));
+
+      CHECK_THROW(searcher.add("x", 1), etl::string_searcher_full);
+      CHECK_THROW(searcher.add("", 0), etl::string_searcher_empty);
+      CHECK_EQUAL(2U, searcher.size());
+      CHECK_EQUAL(6U, searcher.states_size());
+
+      searcher.clear();
+      CHECK(searcher.empty());
+      CHECK_EQUAL(0U, searcher.add("x", 1));
+    }
+
+    //*************************************************************************
+    TEST(test_aho_corasick_wide)
+    {
+      etl::aho_corasick_searcher<wchar_t, 32> searcher;
+
+      searcher.add(L"error", 5);
+      searcher.add(L"warn", 4);
+
+      etl::wstring<40> text(L"[info] [warn] disk");
+      etl::aho_corasick_searcher<wchar_t, 32>::match m = searcher.search(text);
+
+      CHECK_EQUAL(1U, m.pattern);
+      CHECK_EQUAL(8, m.position - text.data());
+    }
+  };
+}
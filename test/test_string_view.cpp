@@ -0,0 +1,317 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "string_view.h"
+#include "cstring.h"
+#include "wstring.h"
+#include "u16string.h"
+#include "u32string.h"
+
+namespace
+{
+  typedef etl::string<50> Text;
+
+  SUITE(test_string_view)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::string_view view;
+
+      CHECK(view.empty());
+      CHECK_EQUAL(0U, view.size());
+      CHECK(view.begin() == view.end());
+    }
+
+    //*************************************************************************
+    TEST(test_construct_with_literal_zero_length)
+    {
+      const char* text = "Hello World";
+      char buffer[] = "Hello";
+
+      etl::string_view view1(text, 0);
+      etl::string_view view2(buffer, 0);
+      etl::string_view view3(buffer, buffer + 5);
+
+      CHECK(view1.empty());
+      CHECK(view1.data() == text);
+      CHECK(view2.empty());
+      CHECK(view2.data() == buffer);
+      CHECK_EQUAL(5U, view3.size());
+    }
+
+    //*************************************************************************
+    TEST(test_constructors)
+    {
+      const char* text = "Hello World";
+
+      etl::string_view view1(text);
+      etl::string_view view2(text, 5);
+      etl::string_view view3(text + 6, text + 11);
+
+      Text string(text);
+      etl::string_view view4(string);
+
+      CHECK_EQUAL(11U, view1.size());
+      CHECK_EQUAL(11U, view1.length());
+      CHECK(view1.data() == text);
+
+      CHECK_EQUAL(5U, view2.size());
+      CHECK(std::equal(view2.begin(), view2.end(), "Hello"));
+
+      CHECK_EQUAL(5U, view3.size());
+      CHECK(std::equal(view3.begin(), view3.end(), "World"));
+
+      // Views the string's own characters.
+      CHECK(view4.data() == string.data());
+      CHECK_EQUAL(string.size(), view4.size());
+    }
+
+    //*************************************************************************
+    TEST(test_element_access)
+    {
+      etl::string_view view("ABCDEF");
+
+      CHECK_EQUAL('A', view.front());
+      CHECK_EQUAL('F', view.back());
+      CHECK_EQUAL('C', view[2]);
+      CHECK_EQUAL('D', view.at(3));
+      CHECK_THROW(view.at(6), etl::string_view_bounds);
+
+      std::string reversed(view.rbegin(), view.rend());
+      CHECK_EQUAL(std::string("FEDCBA"), reversed);
+    }
+
+    //*************************************************************************
+    TEST(test_modifiers)
+    {
+      etl::string_view view("  value  ");
+
+      view.remove_prefix(2);
+      CHECK(view == "value  ");
+
+      view.remove_suffix(2);
+      CHECK(view == "value");
+
+      view.remove_prefix(10);
+      CHECK(view.empty());
+
+      etl::string_view view1("one");
+      etl::string_view view2("two");
+
+      etl::swap(view1, view2);
+
+      CHECK(view1 == "two");
+      CHECK(view2 == "one");
+    }
+
+    //*************************************************************************
+    TEST(test_substr_and_copy)
+    {
+      etl::string_view view("Hello World");
+
+      CHECK(view.substr(6) == "World");
+      CHECK(view.substr(0, 5) == "Hello");
+      CHECK(view.substr(6, 100) == "World");
+      CHECK(view.substr(11).empty());
+      CHECK_THROW(view.substr(12), etl::string_view_bounds);
+
+      char buffer[5];
+      size_t count = view.copy(buffer, 5, 6);
+
+      CHECK_EQUAL(5U, count);
+      CHECK(std::equal(buffer, buffer + 5, "World"));
+
+      count = view.copy(buffer, 5, 8);
+      CHECK_EQUAL(3U, count);
+      CHECK(std::equal(buffer, buffer + 3, "rld"));
+    }
+
+    //*************************************************************************
+    TEST(test_compare)
+    {
+      const char* texts[] = { "", "A", "AB", "ABC", "ABD", "B", "BA" };
+
+      const size_t SIZE = sizeof(texts) / sizeof(texts[0]);
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        for (size_t j = 0; j < SIZE; ++j)
+        {
+          std::string compare1(texts[i]);
+          std::string compare2(texts[j]);
+
+          etl::string_view view1(texts[i]);
+          etl::string_view view2(texts[j]);
+          Text             string2(texts[j]);
+
+          int expected = compare1.compare(compare2);
+          int result   = view1.compare(view2);
+
+          CHECK_EQUAL(expected < 0, result < 0);
+          CHECK_EQUAL(expected > 0, result > 0);
+
+          // View and view.
+          CHECK_EQUAL(compare1 == compare2, view1 == view2);
+          CHECK_EQUAL(compare1 != compare2, view1 != view2);
+          CHECK_EQUAL(compare1 <  compare2, view1 <  view2);
+          CHECK_EQUAL(compare1 <= compare2, view1 <= view2);
+          CHECK_EQUAL(compare1 >  compare2, view1 >  view2);
+          CHECK_EQUAL(compare1 >= compare2, view1 >= view2);
+
+          // View and string.
+          CHECK_EQUAL(compare1 == compare2, view1 == string2);
+          CHECK_EQUAL(compare1 <  compare2, view1 <  string2);
+          CHECK_EQUAL(compare2 == compare1, string2 == view1);
+          CHECK_EQUAL(compare2 <  compare1, string2 <  view1);
+
+          // View and text.
+          CHECK_EQUAL(compare1 == compare2, view1 == texts[j]);
+          CHECK_EQUAL(compare1 >  compare2, view1 >  texts[j]);
+          CHECK_EQUAL(compare2 != compare1, texts[j] != view1);
+          CHECK_EQUAL(compare2 >= compare1, texts[j] >= view1);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_starts_with_ends_with)
+    {
+      etl::string_view view("Content-Length: 1024");
+
+      CHECK(view.starts_with("Content-"));
+      CHECK(view.starts_with('C'));
+      CHECK(!view.starts_with("Content-Type"));
+      CHECK(view.ends_with("1024"));
+      CHECK(view.ends_with('4'));
+      CHECK(!view.ends_with("Content-Length: 10245"));
+      CHECK(etl::string_view().starts_with(""));
+      CHECK(!etl::string_view().ends_with('x'));
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      const char* text = "A haystack with a needle and another needle";
+
+      std::string      compare(text);
+      etl::string_view view(text);
+
+      const char* needles[] = { "needle", "e", "A", "le", "", "x", "needles" };
+
+      for (size_t n = 0; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+      {
+        for (size_t position = 0; position <= (compare.size() + 1); ++position)
+        {
+          CHECK_EQUAL(compare.find(needles[n], position),              view.find(needles[n], position));
+          CHECK_EQUAL(compare.rfind(needles[n], position),             view.rfind(needles[n], position));
+          CHECK_EQUAL(compare.find_first_of(needles[n], position),     view.find_first_of(needles[n], position));
+          CHECK_EQUAL(compare.find_last_of(needles[n], position),      view.find_last_of(needles[n], position));
+          CHECK_EQUAL(compare.find_first_not_of(needles[n], position), view.find_first_not_of(needles[n], position));
+          CHECK_EQUAL(compare.find_last_not_of(needles[n], position),  view.find_last_not_of(needles[n], position));
+        }
+      }
+
+      for (size_t position = 0; position <= (compare.size() + 1); ++position)
+      {
+        CHECK_EQUAL(compare.find('e', position),              view.find('e', position));
+        CHECK_EQUAL(compare.rfind('e', position),             view.rfind('e', position));
+        CHECK_EQUAL(compare.find_first_of('n', position),     view.find_first_of('n', position));
+        CHECK_EQUAL(compare.find_last_of('n', position),      view.find_last_of('n', position));
+        CHECK_EQUAL(compare.find_first_not_of('A', position), view.find_first_not_of('A', position));
+        CHECK_EQUAL(compare.find_last_not_of('e', position),  view.find_last_not_of('e', position));
+      }
+
+      // Search for a string's content.
+      Text needle("another");
+      CHECK_EQUAL(compare.find("another"), view.find(needle));
+    }
+
+    //*************************************************************************
+    TEST(test_parse_without_copying)
+    {
+      Text header("Content-Type: text/plain");
+
+      etl::string_view line(header);
+
+      size_t colon = line.find(':');
+      etl::string_view name  = line.substr(0, colon);
+      etl::string_view value = line.substr(colon + 1);
+
+      value.remove_prefix(value.find_first_not_of(' '));
+
+      CHECK(name == "Content-Type");
+      CHECK(value == "text/plain");
+      CHECK(value.data() == (header.data() + 14));
+    }
+
+    //*************************************************************************
+    TEST(test_hash)
+    {
+      Text             string("Hello World");
+      etl::string_view view(string);
+
+      CHECK_EQUAL(etl::hash<etl::istring>()(string), etl::hash<etl::string_view>()(view));
+      CHECK(etl::hash<etl::string_view>()(view) != etl::hash<etl::string_view>()(view.substr(1)));
+
+      etl::wstring<20> wstring(L"Hello World");
+      CHECK_EQUAL(etl::hash<etl::iwstring>()(wstring), etl::hash<etl::wstring_view>()(etl::wstring_view(wstring)));
+
+      etl::u16string<20> u16string(u"Hello World");
+      CHECK_EQUAL(etl::hash<etl::iu16string>()(u16string), etl::hash<etl::u16string_view>()(etl::u16string_view(u16string)));
+
+      etl::u32string<20> u32string(U"Hello World");
+      CHECK_EQUAL(etl::hash<etl::iu32string>()(u32string), etl::hash<etl::u32string_view>()(etl::u32string_view(u32string)));
+    }
+
+    //*************************************************************************
+    TEST(test_wide_views)
+    {
+      etl::wstring<50> wstring(L"name=value;name2=value2");
+      etl::wstring_view wview(wstring);
+
+      CHECK_EQUAL(4U, wview.find(L'='));
+      CHECK_EQUAL(11U, wview.find(L"name2"));
+      CHECK(wview.substr(5, 5) == L"value");
+
+      etl::u16string_view u16view(u"key: value");
+      CHECK_EQUAL(3U, u16view.find_first_of(u":;"));
+      CHECK(u16view.substr(5) == u"value");
+
+      etl::u32string_view u32view(U"key: value");
+      CHECK_EQUAL(9U, u32view.rfind(U'e'));
+      CHECK(u32view.substr(0, 3) == U"key");
+    }
+  };
+}
@@ -2233,6 +2233,37 @@ namespace
       CHECK_EQUAL(etl::iwstring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_rfind_long_haystack)
+    {
+      // Long enough to exercise the vectorised search, with near misses.
+      const value_t* the_haystack = STR("needle neede nedle eedle needl needle needleneedle nee dle needle  n ne nee need needl needle");
+
+      const value_t* needles[] = { STR("needle"), STR("needleneedle"), STR("e"), STR("le n"), STR("needl"), STR("e  n"), STR("x"), STR("needle needle needle") };
+
+      Compare_Text compare_haystack(the_haystack);
+      etl::wstring<200> haystack(the_haystack);
+
+      for (size_t n = 0; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+      {
+        Compare_Text compare_needle(needles[n]);
+        etl::wstring<200> needle(needles[n]);
+
+        for (size_t position = 0; position <= (compare_haystack.size() + 1); ++position)
+        {
+          CHECK_EQUAL(compare_haystack.find(compare_needle, position), haystack.find(needle, position));
+          CHECK_EQUAL(compare_haystack.rfind(compare_needle, position), haystack.rfind(needle, position));
+        }
+
+        CHECK_EQUAL(compare_haystack.rfind(compare_needle), haystack.rfind(needle));
+      }
+
+      // Empty needle.
+      CHECK_EQUAL(compare_haystack.find(STR(""), 3), haystack.find(STR(""), 3));
+      CHECK_EQUAL(compare_haystack.rfind(STR(""), 3), haystack.rfind(STR(""), 3));
+      CHECK_EQUAL(compare_haystack.rfind(STR("")), haystack.rfind(STR("")));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_substr)
     {
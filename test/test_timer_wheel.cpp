@@ -0,0 +1,312 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+
+#include "timer_wheel.h"
+
+namespace
+{
+  //***************************************************************************
+  struct Timeout : public etl::timer_wheel_timer
+  {
+    Timeout(etl::timer_wheel_callback& callback)
+      : etl::timer_wheel_timer(callback),
+        expected(0),
+        fired(0),
+        fired_at(0)
+    {
+    }
+
+    uint32_t expected;
+    int      fired;
+    uint32_t fired_at;
+  };
+
+  //***************************************************************************
+  // Records the time at which each timer fires.
+  //***************************************************************************
+  struct Recorder : public etl::timer_wheel_callback
+  {
+    Recorder()
+      : p_wheel(nullptr),
+        all_on_time(true),
+        period(0)
+    {
+    }
+
+    void operator ()(etl::timer_wheel_timer& timer)
+    {
+      Timeout& timeout = static_cast<Timeout&>(timer);
+
+      ++timeout.fired;
+      timeout.fired_at = p_wheel->time();
+      all_on_time = all_on_time && (timeout.fired_at == timeout.expected);
+
+      if (period != 0)
+      {
+        timeout.expected = p_wheel->time() + period;
+        p_wheel->schedule(timeout, period);
+      }
+    }
+
+    etl::itimer_wheel* p_wheel;
+    bool               all_on_time;
+    uint32_t           period;
+  };
+
+  SUITE(test_timer_wheel)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::timer_wheel<6, 4> wheel;
+
+      CHECK(wheel.empty());
+      CHECK_EQUAL(0U, wheel.size());
+      CHECK_EQUAL(0U, wheel.time());
+      CHECK_EQUAL((1U << 24) - 1, wheel.max_delay());
+
+      etl::timer_wheel<8, 4> wheel32;
+      CHECK_EQUAL(0xFFFFFFFFU, wheel32.max_delay());
+    }
+
+    //*************************************************************************
+    TEST(test_every_delay)
+    {
+      // 4 slots, 3 levels. Delays up to 63.
+      etl::timer_wheel<2, 3> wheel;
+      Recorder recorder;
+      recorder.p_wheel = &wheel;
+
+      for (uint32_t start = 0; start < 20; ++start)
+      {
+        for (uint32_t delay = 1; delay <= wheel.max_delay(); ++delay)
+        {
+          Timeout timeout(recorder);
+          timeout.expected = wheel.time() + delay;
+
+          wheel.schedule(timeout, delay);
+          CHECK(timeout.is_active());
+          CHECK_EQUAL(1U, wheel.size());
+
+          wheel.advance(delay - 1);
+          CHECK_EQUAL(0, timeout.fired);
+
+          wheel.advance(1);
+          CHECK_EQUAL(1, timeout.fired);
+          CHECK(!timeout.is_active());
+          CHECK(wheel.empty());
+        }
+
+        wheel.advance(start);
+      }
+
+      CHECK(recorder.all_on_time);
+    }
+
+    //*************************************************************************
+    TEST(test_zero_delay)
+    {
+      etl::timer_wheel<2, 3> wheel;
+      Recorder recorder;
+      recorder.p_wheel = &wheel;
+
+      Timeout timeout(recorder);
+      timeout.expected = 1;
+      wheel.schedule(timeout, 0);
+
+      wheel.advance(1);
+      CHECK_EQUAL(1, timeout.fired);
+      CHECK(recorder.all_on_time);
+    }
+
+    //*************************************************************************
+    TEST(test_cancel_and_reschedule)
+    {
+      etl::timer_wheel<2, 3> wheel;
+      Recorder recorder;
+      recorder.p_wheel = &wheel;
+
+      Timeout a(recorder);
+      Timeout b(recorder);
+
+      wheel.schedule(a, 10);
+      wheel.schedule(b, 20);
+      CHECK_EQUAL(2U, wheel.size());
+
+      wheel.cancel(a);
+      CHECK(!a.is_active());
+      CHECK_EQUAL(1U, wheel.size());
+
+      // Cancelling an inactive timer does nothing.
+      wheel.cancel(a);
+      CHECK_EQUAL(1U, wheel.size());
+
+      // Rescheduling an active timer moves it.
+      b.expected = 5;
+      wheel.schedule(b, 5);
+      CHECK_EQUAL(1U, wheel.size());
+
+      wheel.advance(30);
+      CHECK_EQUAL(0, a.fired);
+      CHECK_EQUAL(1, b.fired);
+      CHECK(recorder.all_on_time);
+    }
+
+    //*************************************************************************
+    TEST(test_periodic)
+    {
+      etl::timer_wheel<2, 3> wheel;
+      Recorder recorder;
+      recorder.p_wheel  = &wheel;
+      recorder.period   = 7;
+
+      Timeout timeout(recorder);
+      timeout.expected = 7;
+      wheel.schedule(timeout, 7);
+
+      wheel.advance(70);
+      CHECK_EQUAL(10, timeout.fired);
+      CHECK(timeout.is_active());
+      CHECK(recorder.all_on_time);
+
+      wheel.clear();
+      CHECK(!timeout.is_active());
+      CHECK(wheel.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_range)
+    {
+      etl::timer_wheel<2, 3> wheel;
+      Recorder recorder;
+      Timeout timeout(recorder);
+
+      CHECK_THROW(wheel.schedule(timeout, 64), etl::timer_wheel_range);
+      CHECK(!timeout.is_active());
+    }
+
+    //*************************************************************************
+    TEST(test_time_wraps)
+    {
+      etl::timer_wheel<8, 4> wheel;
+      Recorder recorder;
+      recorder.p_wheel = &wheel;
+
+      // No timers, so jumps straight there.
+      wheel.advance(0xFFFFFF00U);
+      CHECK_EQUAL(0xFFFFFF00U, wheel.time());
+
+      Timeout a(recorder);
+      Timeout b(recorder);
+      a.expected = 0xFFFFFF00U + 0x80U;
+      b.expected = 0x00000100U;
+      wheel.schedule(a, 0x80);
+      wheel.schedule(b, 0x200);
+
+      wheel.advance(0x1FF);
+      CHECK_EQUAL(1, a.fired);
+      CHECK_EQUAL(0, b.fired);
+
+      wheel.advance(1);
+      CHECK_EQUAL(1, b.fired);
+      CHECK(recorder.all_on_time);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      etl::timer_wheel<3, 3> wheel;
+      Recorder recorder;
+      recorder.p_wheel = &wheel;
+
+      std::vector<Timeout*> timeouts;
+
+      for (size_t i = 0; i < 50; ++i)
+      {
+        timeouts.push_back(new Timeout(recorder));
+      }
+
+      uint32_t seed  = 1;
+      int      fired = 0;
+      int      expected_fired = 0;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        Timeout& timeout = *timeouts[(seed >> 8) % timeouts.size()];
+
+        seed = (seed * 1103515245U) + 12345U;
+        const uint32_t op = (seed >> 8) % 8;
+
+        seed = (seed * 1103515245U) + 12345U;
+        const uint32_t delay = 1 + ((seed >> 8) % wheel.max_delay());
+
+        if (op < 4)
+        {
+          if (!timeout.is_active())
+          {
+            ++expected_fired;
+          }
+
+          timeout.expected = wheel.time() + delay;
+          wheel.schedule(timeout, delay);
+        }
+        else if (op < 5)
+        {
+          if (timeout.is_active())
+          {
+            --expected_fired;
+          }
+
+          wheel.cancel(timeout);
+        }
+        else
+        {
+          wheel.advance(delay % 40);
+        }
+      }
+
+      wheel.advance(wheel.max_delay());
+
+      for (size_t i = 0; i < timeouts.size(); ++i)
+      {
+        fired += timeouts[i]->fired;
+        CHECK(!timeouts[i]->is_active());
+        delete timeouts[i];
+      }
+
+      CHECK_EQUAL(expected_fired, fired);
+      CHECK(recorder.all_on_time);
+      CHECK(wheel.empty());
+    }
+  };
+}
@@ -0,0 +1,391 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include "transcode.h"
+#include "cstring.h"
+#include "wstring.h"
+#include "u16string.h"
+#include "u32string.h"
+#include "string_view.h"
+
+namespace
+{
+  typedef etl::string<400>    Utf8;
+  typedef etl::u16string<200> Utf16;
+  typedef etl::u32string<200> Utf32;
+
+  //***************************************************************************
+  // A pseudo random sequence.
+  //***************************************************************************
+  uint32_t next_random(uint32_t& state)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    return state;
+  }
+
+  //***************************************************************************
+  // Random code points, mostly ASCII runs, with some of each length.
+  //***************************************************************************
+  std::vector<uint32_t> random_code_points(uint32_t& state, size_t count)
+  {
+    std::vector<uint32_t> code_points;
+
+    while (code_points.size() < count)
+    {
+      switch (next_random(state) % 6)
+      {
+        case 0:
+        case 1:
+        {
+          // An ASCII run, long enough for the block copies.
+          size_t length = next_random(state) % 40;
+
+          while ((length-- != 0) && (code_points.size() < count))
+          {
+            code_points.push_back(0x20 + (next_random(state) % 0x5F));
+          }
+          break;
+        }
+
+        case 2:  code_points.push_back(0x80 + (next_random(state) % 0x780));     break;
+        case 3:  code_points.push_back(0x800 + (next_random(state) % 0xD000));   break;
+        case 4:  code_points.push_back(0xE000 + (next_random(state) % 0x2000));  break;
+        default: code_points.push_back(0x10000 + (next_random(state) % 0x100000)); break;
+      }
+    }
+
+    return code_points;
+  }
+
+  //***************************************************************************
+  // Reference encoders.
+  //***************************************************************************
+  void encode(Utf8& text, uint32_t c)
+  {
+    if (c < 0x80)
+    {
+      text.push_back(char(c));
+    }
+    else if (c < 0x800)
+    {
+      text.push_back(char(0xC0 | (c >> 6)));
+      text.push_back(char(0x80 | (c & 0x3F)));
+    }
+    else if (c < 0x10000)
+    {
+      text.push_back(char(0xE0 | (c >> 12)));
+      text.push_back(char(0x80 | ((c >> 6) & 0x3F)));
+      text.push_back(char(0x80 | (c & 0x3F)));
+    }
+    else
+    {
+      text.push_back(char(0xF0 | (c >> 18)));
+      text.push_back(char(0x80 | ((c >> 12) & 0x3F)));
+      text.push_back(char(0x80 | ((c >> 6) & 0x3F)));
+      text.push_back(char(0x80 | (c & 0x3F)));
+    }
+  }
+
+  void encode(Utf16& text, uint32_t c)
+  {
+    if (c < 0x10000)
+    {
+      text.push_back(char16_t(c));
+    }
+    else
+    {
+      text.push_back(char16_t(0xD800 + ((c - 0x10000) >> 10)));
+      text.push_back(char16_t(0xDC00 + ((c - 0x10000) & 0x3FF)));
+    }
+  }
+
+  void encode(Utf32& text, uint32_t c)
+  {
+    text.push_back(char32_t(c));
+  }
+
+  template <typename TString>
+  TString make(const std::vector<uint32_t>& code_points)
+  {
+    TString text;
+
+    for (size_t i = 0; i < code_points.size(); ++i)
+    {
+      encode(text, code_points[i]);
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  // Checks a conversion of the whole source.
+  //***************************************************************************
+  template <typename TTo, typename TFrom>
+  bool converts(const TFrom& source, const TTo& expected)
+  {
+    TTo destination;
+
+    etl::transcode_result<typename TFrom::value_type> result = etl::transcode(destination, source);
+
+    return (result.status == etl::transcode_status::ok) &&
+           (result.ptr == source.data() + source.size()) &&
+           (destination == expected);
+  }
+
+  SUITE(test_transcode)
+  {
+    //*************************************************************************
+    TEST(test_examples)
+    {
+      const Utf8  utf8("A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");  // A, e acute, euro, emoji
+      const Utf16 utf16(u"Aé€\U0001F600");
+      const Utf32 utf32(U"Aé€\U0001F600");
+
+      CHECK(converts(utf8, utf16));
+      CHECK(converts(utf8, utf32));
+      CHECK(converts(utf16, utf8));
+      CHECK(converts(utf16, utf32));
+      CHECK(converts(utf32, utf8));
+      CHECK(converts(utf32, utf16));
+      CHECK(converts(utf8, utf8));
+      CHECK(converts(utf16, utf16));
+      CHECK(converts(utf32, utf32));
+
+      CHECK_EQUAL(5U, utf16.size());
+      CHECK_EQUAL(4U, utf32.size());
+    }
+
+    //*************************************************************************
+    TEST(test_random_all_directions)
+    {
+      uint32_t state = 0x13579BDF;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        const std::vector<uint32_t> code_points = random_code_points(state, next_random(state) % 90);
+
+        const Utf8  utf8  = make<Utf8>(code_points);
+        const Utf16 utf16 = make<Utf16>(code_points);
+        const Utf32 utf32 = make<Utf32>(code_points);
+
+        CHECK(converts(utf8, utf16));
+        CHECK(converts(utf8, utf32));
+        CHECK(converts(utf16, utf8));
+        CHECK(converts(utf16, utf32));
+        CHECK(converts(utf32, utf8));
+        CHECK(converts(utf32, utf16));
+        CHECK(converts(utf8, utf8));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wstring)
+    {
+      const Utf8 utf8("caf\xC3\xA9 \xF0\x9F\x98\x80");
+
+      etl::wstring<20> wide;
+      etl::transcode(wide, utf8);
+
+      CHECK(etl::wstring<20>(L"café \U0001F600") == wide);
+
+      Utf8 narrow;
+      etl::transcode(narrow, wide);
+
+      CHECK(utf8 == narrow);
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_and_pointers)
+    {
+      const char text[] = "plain ascii text, long enough for a block copy";
+      const size_t length = sizeof(text) - 1;
+
+      Utf16 from_view;
+      etl::transcode(from_view, etl::string_view(text, length));
+
+      Utf32 from_pointers;
+      etl::transcode_result<char> result = etl::transcode(from_pointers, text, text + length);
+
+      CHECK(result.status == etl::transcode_status::ok);
+      CHECK(result.ptr == text + length);
+      CHECK_EQUAL(length, from_view.size());
+      CHECK_EQUAL(length, from_pointers.size());
+
+      for (size_t i = 0; i < length; ++i)
+      {
+        CHECK_EQUAL(uint32_t(text[i]), uint32_t(from_view[i]));
+        CHECK_EQUAL(uint32_t(text[i]), uint32_t(from_pointers[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_appends)
+    {
+      Utf16 text(u"x=");
+
+      etl::transcode(text, Utf8("\xC3\xA9"));
+
+      CHECK(Utf16(u"x=é") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf8)
+    {
+      const char* const invalid[] =
+      {
+        "ab\x80zz",                 // Lone continuation byte.
+        "ab\xC0\x80zz",             // Overlong NUL.
+        "ab\xE0\x80\x80zz",         // Overlong.
+        "ab\xF0\x80\x80\x80zz",     // Overlong.
+        "ab\xED\xA0\x80zz",         // Surrogate.
+        "ab\xF4\x90\x80\x80zz",     // Above U+10FFFF.
+        "ab\xF8\x88\x80\x80\x80zz", // Five bytes.
+        "ab\xC3zz",                 // Missing continuation.
+        "ab\xE2\x82"                // Ends mid sequence.
+      };
+
+      for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+      {
+        const Utf8 source(invalid[i]);
+
+        Utf32 destination;
+        etl::transcode_result<char> result = etl::transcode(destination, source);
+
+        CHECK(result.status == etl::transcode_status::invalid_sequence);
+        CHECK(result.ptr == source.data() + 2);
+        CHECK(Utf32(U"ab") == destination);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf16_and_utf32)
+    {
+      const char16_t lone_high[] = { u'a', 0xD800, u'b' };
+      const char16_t lone_low[]  = { u'a', 0xDC00, u'b' };
+      const char16_t at_end[]    = { u'a', 0xD83D };
+
+      Utf8 destination;
+
+      CHECK(etl::transcode(destination, lone_high, lone_high + 3).ptr == lone_high + 1);
+      CHECK(etl::transcode(destination, lone_low, lone_low + 3).ptr == lone_low + 1);
+
+      etl::transcode_result<char16_t> result = etl::transcode(destination, at_end, at_end + 2);
+      CHECK(result.status == etl::transcode_status::invalid_sequence);
+      CHECK(result.ptr == at_end + 1);
+
+      const char32_t out_of_range[] = { U'a', 0x110000 };
+      const char32_t surrogate[]    = { U'a', 0xDFFF };
+
+      CHECK(etl::transcode(destination, out_of_range, out_of_range + 2).status == etl::transcode_status::invalid_sequence);
+      CHECK(etl::transcode(destination, surrogate, surrogate + 2).status == etl::transcode_status::invalid_sequence);
+
+      CHECK(Utf8("aaaaa") == destination);
+    }
+
+    //*************************************************************************
+    TEST(test_truncation_does_not_split_code_points)
+    {
+      // 'a', then a four byte emoji.
+      const Utf32 source(U"a\U0001F600b");
+
+      etl::string<4> utf8;
+      etl::transcode_result<char32_t> result = etl::transcode(utf8, source);
+
+      CHECK(result.status == etl::transcode_status::truncated);
+      CHECK(result.ptr == source.data() + 1);
+      CHECK(etl::string<4>("a") == utf8);
+
+      etl::u16string<2> utf16;
+      result = etl::transcode(utf16, source);
+
+      CHECK(result.status == etl::transcode_status::truncated);
+      CHECK(result.ptr == source.data() + 1);
+      CHECK_EQUAL(1U, utf16.size());
+
+      // Exactly fits.
+      etl::u16string<3> exact;
+      CHECK(etl::transcode(exact, Utf32(U"a\U0001F600")).status == etl::transcode_status::ok);
+      CHECK_EQUAL(3U, exact.size());
+    }
+
+    //*************************************************************************
+    TEST(test_truncation_in_ascii_runs)
+    {
+      uint32_t state = 0x2468ACE0;
+
+      for (size_t capacity = 0; capacity < 150; ++capacity)
+      {
+        const std::vector<uint32_t> code_points = random_code_points(state, 120);
+        const Utf8 source = make<Utf8>(code_points);
+
+        etl::u16string<150> destination;
+        const size_t free = capacity;
+
+        // Fill all but 'free' characters.
+        destination.assign(150 - free, u'.');
+
+        etl::transcode_result<char> result = etl::transcode(destination, source);
+
+        // The result is the longest prefix of whole code points that fits.
+        Utf16  expected;
+        size_t used = 0;
+        size_t i    = 0;
+
+        while (i < code_points.size())
+        {
+          const size_t length = (code_points[i] < 0x10000) ? 1 : 2;
+
+          if ((used + length) > free)
+          {
+            break;
+          }
+
+          encode(expected, code_points[i]);
+          used += length;
+          ++i;
+        }
+
+        const bool complete = (i == code_points.size());
+
+        CHECK(result.status == (complete ? etl::transcode_status::ok : etl::transcode_status::truncated));
+        CHECK(etl::u16string<150>(expected.begin(), expected.end()) == etl::u16string<150>(destination.begin() + (150 - free), destination.end()));
+        CHECK(result.ptr == source.data() + make<Utf8>(std::vector<uint32_t>(code_points.begin(), code_points.begin() + i)).size());
+      }
+    }
+  };
+}
@@ -40,6 +40,9 @@ namespace std
 
 #include "type_traits.h"
 #include <type_traits>
+#include <string>
+
+#include "data.h"
 
 // A class to test non-fundamental types.
 struct Test
@@ -501,6 +504,22 @@ namespace
       CHECK(etl::rank<int[10][10]>::value == std::rank<int[10][10]>::value);
     }
 
+    //*************************************************************************
+    TEST(test_is_trivially_relocatable)
+    {
+      struct Pod
+      {
+        int   a;
+        char  b;
+      };
+
+      CHECK(etl::is_trivially_relocatable<int>::value);
+      CHECK(etl::is_trivially_relocatable<int*>::value);
+      CHECK(etl::is_trivially_relocatable<Pod>::value);
+      CHECK(!etl::is_trivially_relocatable<std::string>::value);
+      CHECK(etl::is_trivially_relocatable<TestDataRelocatable>::value);
+    }
+
     //*************************************************************************
     TEST(test_alignment_of)
     {
@@ -0,0 +1,593 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2017 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "unrolled_list.h"
+
+#include "data.h"
+
+#include <algorithm>
+#include <list>
+#include <vector>
+#include <random>
+#include <string>
+
+namespace
+{
+  SUITE(test_unrolled_list)
+  {
+    typedef TestDataDC<std::string>  ItemDC;
+    typedef TestDataNDC<std::string> ItemNDC;
+
+    const size_t SIZE = 10;
+
+    typedef etl::unrolled_list<ItemDC, SIZE, 4>  DataDC;
+    typedef etl::unrolled_list<ItemNDC, SIZE, 4> DataNDC;
+    typedef etl::unrolled_list<ItemNDC, SIZE, 3> DataNDC3;
+    typedef etl::iunrolled_list<ItemNDC>         IDataNDC;
+
+    typedef std::list<ItemNDC>   CompareData;
+    typedef std::vector<ItemNDC> InitialData;
+
+    InitialData stable_sort_data;
+    InitialData unsorted_data;
+    InitialData sorted_data;
+    InitialData non_unique_data;
+    InitialData small_data;
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        stable_sort_data = { ItemNDC("1", 1), ItemNDC("2", 2), ItemNDC("3", 3), ItemNDC("2", 4), ItemNDC("0", 5), ItemNDC("2", 6), ItemNDC("7", 7), ItemNDC("4", 8), ItemNDC("4", 9), ItemNDC("8", 10) };
+        unsorted_data    = { ItemNDC("1"), ItemNDC("0"), ItemNDC("3"), ItemNDC("2"), ItemNDC("5"), ItemNDC("4"), ItemNDC("7"), ItemNDC("6"), ItemNDC("9"), ItemNDC("8") };
+        sorted_data      = { ItemNDC("0"), ItemNDC("1"), ItemNDC("2"), ItemNDC("3"), ItemNDC("4"), ItemNDC("5"), ItemNDC("6"), ItemNDC("7"), ItemNDC("8"), ItemNDC("9") };
+        non_unique_data  = { ItemNDC("0"), ItemNDC("0"), ItemNDC("1"), ItemNDC("1"), ItemNDC("2"), ItemNDC("3"), ItemNDC("3"), ItemNDC("3"), ItemNDC("4"), ItemNDC("5") };
+        small_data       = { ItemNDC("0"), ItemNDC("1"), ItemNDC("2"), ItemNDC("3"), ItemNDC("4"), ItemNDC("5") };
+      }
+    };
+
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool is_equal(const T1& lhs, const T2& rhs)
+    {
+      return (lhs.size() == size_t(std::distance(rhs.begin(), rhs.end()))) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(data.size(), size_t(0));
+      CHECK(data.empty());
+      CHECK_EQUAL(data.max_size(), SIZE);
+      CHECK_EQUAL(data.node_size(), 4U);
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_size)
+    {
+      const size_t INITIAL_SIZE = 4;
+      DataDC data(INITIAL_SIZE);
+
+      CHECK(data.size() == INITIAL_SIZE);
+      CHECK(!data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_size_excess)
+    {
+      CHECK_THROW(DataDC data(SIZE + 1), etl::unrolled_list_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_size_value)
+    {
+      const size_t INITIAL_SIZE = 5;
+      const ItemNDC INITIAL_VALUE("1");
+
+      DataNDC data(INITIAL_SIZE, INITIAL_VALUE);
+
+      CHECK_EQUAL(INITIAL_SIZE, data.size());
+      CHECK(std::count(data.begin(), data.end(), INITIAL_VALUE) == INITIAL_SIZE);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(sorted_data.begin(), sorted_data.end());
+
+      CHECK(is_equal(data, sorted_data));
+      CHECK(data.full());
+
+      // Filled from the back, so every node is full but the last.
+      CHECK_EQUAL(3U, data.node_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data(sorted_data.begin(), sorted_data.end());
+      DataNDC other(data);
+
+      CHECK(data == other);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data(sorted_data.begin(), sorted_data.end());
+      DataNDC other;
+
+      other = data;
+      CHECK(data == other);
+
+      IDataNDC& idata  = data;
+      IDataNDC& iother = other;
+      iother.clear();
+      iother = idata;
+      CHECK(data == other);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterators)
+    {
+      DataNDC data(sorted_data.begin(), sorted_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK(std::equal(sorted_data.begin(), sorted_data.end(), cdata.begin()));
+      CHECK(std::equal(sorted_data.rbegin(), sorted_data.rend(), data.rbegin()));
+      CHECK(std::equal(sorted_data.rbegin(), sorted_data.rend(), cdata.crbegin()));
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.begin(), data.end())));
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.rbegin(), data.rend())));
+
+      DataNDC::iterator itr = data.end();
+      --itr;
+      CHECK_EQUAL(sorted_data.back(), *itr);
+
+      CHECK_EQUAL(sorted_data.front(), data.front());
+      CHECK_EQUAL(sorted_data.back(),  data.back());
+      CHECK_EQUAL(sorted_data.front(), cdata.front());
+      CHECK_EQUAL(sorted_data.back(),  cdata.back());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_push_pop)
+    {
+      CompareData compare_data;
+      DataNDC data;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        if ((i % 2) == 0)
+        {
+          compare_data.push_back(sorted_data[i]);
+          data.push_back(sorted_data[i]);
+        }
+        else
+        {
+          compare_data.push_front(sorted_data[i]);
+          data.push_front(sorted_data[i]);
+        }
+      }
+
+      CHECK(is_equal(data, compare_data));
+      CHECK_THROW(data.push_back(sorted_data[0]), etl::unrolled_list_full);
+      CHECK_THROW(data.push_front(sorted_data[0]), etl::unrolled_list_full);
+
+      while (!data.empty())
+      {
+        data.pop_front();
+        compare_data.pop_front();
+        CHECK(is_equal(data, compare_data));
+
+        if (!data.empty())
+        {
+          data.pop_back();
+          compare_data.pop_back();
+          CHECK(is_equal(data, compare_data));
+        }
+      }
+
+      CHECK_EQUAL(0U, data.node_count());
+      CHECK_THROW(data.pop_back(), etl::unrolled_list_empty);
+      CHECK_THROW(data.pop_front(), etl::unrolled_list_empty);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_position_value)
+    {
+      for (size_t offset = 0; offset <= small_data.size(); ++offset)
+      {
+        CompareData compare_data(small_data.begin(), small_data.end());
+        DataNDC3    data(small_data.begin(), small_data.end());
+
+        DataNDC3::iterator    position = data.begin();
+        CompareData::iterator compare_position = compare_data.begin();
+        std::advance(position, offset);
+        std::advance(compare_position, offset);
+
+        DataNDC3::iterator result = data.insert(position, ItemNDC("X"));
+        compare_data.insert(compare_position, ItemNDC("X"));
+
+        CHECK_EQUAL(ItemNDC("X"), *result);
+        CHECK_EQUAL(offset, size_t(std::distance(data.begin(), result)));
+        CHECK(is_equal(data, compare_data));
+      }
+    }
+
+    //*************************************************************************
+    // Builds a list of strings from 'first', then erases the elements at 'erase_at'.
+    // Nodes hold 4 elements.
+    //*************************************************************************
+    typedef etl::unrolled_list<std::string, 16, 4> StringList;
+
+    void setup_strings(StringList& data, std::list<std::string>& compare, const char* text, int erase_at)
+    {
+      for (const char* p = text; *p != 0; ++p)
+      {
+        data.push_back(std::string(1, *p));
+        compare.push_back(std::string(1, *p));
+      }
+
+      if (erase_at >= 0)
+      {
+        data.erase(std::next(data.begin(), erase_at));
+        compare.erase(std::next(compare.begin(), erase_at));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_from_the_same_list)
+    {
+      struct Case
+      {
+        const char* text;     // The initial elements.
+        int         erase_at; // The element to erase first, or -1.
+        int         position; // Where to insert.
+        int         from;     // The element to insert a reference to.
+      };
+
+      const Case cases[] =
+      {
+        { "abc",      -1, 0, 1 }, // Node not full.
+        { "abcd",     -1, 1, 3 }, // Full node is split.
+        { "abcd",     -1, 3, 1 }, // Full node is split.
+        { "abcdefgh",  0, 4, 6 }, // Full node moves an element to the previous node.
+        { "abcdefgh",  7, 1, 3 }, // Full node moves an element to the next node.
+      };
+
+      for (size_t c = 0; c < (sizeof(cases) / sizeof(cases[0])); ++c)
+      {
+        StringList data;
+        std::list<std::string> compare;
+        setup_strings(data, compare, cases[c].text, cases[c].erase_at);
+
+        data.insert(std::next(data.begin(), cases[c].position), *std::next(data.begin(), cases[c].from));
+        compare.insert(std::next(compare.begin(), cases[c].position), *std::next(compare.begin(), cases[c].from));
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+      }
+
+      // Several copies, and pushes, of an element of the same list.
+      StringList data;
+      std::list<std::string> compare;
+      setup_strings(data, compare, "abcd", -1);
+
+      data.insert(std::next(data.begin()), 3, *std::next(data.begin(), 3));
+      compare.insert(std::next(compare.begin()), 3, *std::next(compare.begin(), 3));
+      data.push_front(data.back());
+      compare.push_front(compare.back());
+      data.push_back(data.front());
+      compare.push_back(compare.front());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_position_n_value)
+    {
+      CompareData compare_data(small_data.begin(), small_data.end());
+      DataNDC data(small_data.begin(), small_data.end());
+
+      DataNDC::iterator position = data.begin();
+      CompareData::iterator compare_position = compare_data.begin();
+      std::advance(position, 2);
+      std::advance(compare_position, 2);
+
+      data.insert(position, 3, ItemNDC("X"));
+      compare_data.insert(compare_position, 3, ItemNDC("X"));
+
+      CHECK(is_equal(data, compare_data));
+      CHECK_THROW(data.insert(data.begin(), 2, ItemNDC("Y")), etl::unrolled_list_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_position_range)
+    {
+      CompareData compare_data(small_data.begin(), small_data.begin() + 3);
+      DataNDC data(small_data.begin(), small_data.begin() + 3);
+
+      DataNDC::iterator position = data.begin();
+      CompareData::iterator compare_position = compare_data.begin();
+      ++position;
+      ++compare_position;
+
+      data.insert(position, unsorted_data.begin(), unsorted_data.begin() + 5);
+      compare_data.insert(compare_position, unsorted_data.begin(), unsorted_data.begin() + 5);
+
+      CHECK(is_equal(data, compare_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase)
+    {
+      for (size_t offset = 0; offset < SIZE; ++offset)
+      {
+        CompareData compare_data(sorted_data.begin(), sorted_data.end());
+        DataNDC3    data(sorted_data.begin(), sorted_data.end());
+
+        DataNDC3::iterator    position = data.begin();
+        CompareData::iterator compare_position = compare_data.begin();
+        std::advance(position, offset);
+        std::advance(compare_position, offset);
+
+        DataNDC3::iterator result = data.erase(position);
+        compare_position = compare_data.erase(compare_position);
+
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_position), std::distance(data.begin(), result));
+        CHECK(is_equal(data, compare_data));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      CompareData compare_data(sorted_data.begin(), sorted_data.end());
+      DataNDC data(sorted_data.begin(), sorted_data.end());
+
+      DataNDC::iterator first = data.begin();
+      DataNDC::iterator last  = data.begin();
+      std::advance(first, 2);
+      std::advance(last, 7);
+
+      CompareData::iterator compare_first = compare_data.begin();
+      CompareData::iterator compare_last  = compare_data.begin();
+      std::advance(compare_first, 2);
+      std::advance(compare_last, 7);
+
+      DataNDC::iterator result = data.erase(first, last);
+      compare_data.erase(compare_first, compare_last);
+
+      CHECK_EQUAL(sorted_data[7], *result);
+      CHECK(is_equal(data, compare_data));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.node_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_resize)
+    {
+      DataNDC data(small_data.begin(), small_data.end());
+
+      data.resize(8, ItemNDC("X"));
+      CHECK_EQUAL(8U, data.size());
+      CHECK_EQUAL(ItemNDC("X"), data.back());
+
+      data.resize(2, ItemNDC("X"));
+      CHECK(is_equal(data, InitialData(small_data.begin(), small_data.begin() + 2)));
+
+      CHECK_THROW(data.resize(SIZE + 1, ItemNDC("X")), etl::unrolled_list_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_remove_unique_reverse)
+    {
+      DataNDC data(non_unique_data.begin(), non_unique_data.end());
+      CompareData compare_data(non_unique_data.begin(), non_unique_data.end());
+
+      data.unique();
+      compare_data.unique();
+      CHECK(is_equal(data, compare_data));
+
+      data.remove(ItemNDC("3"));
+      compare_data.remove(ItemNDC("3"));
+      CHECK(is_equal(data, compare_data));
+
+      data.remove_if(std::bind2nd(std::less<ItemNDC>(), ItemNDC("2")));
+      compare_data.remove_if(std::bind2nd(std::less<ItemNDC>(), ItemNDC("2")));
+      CHECK(is_equal(data, compare_data));
+
+      data.reverse();
+      compare_data.reverse();
+      CHECK(is_equal(data, compare_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sort)
+    {
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+
+      data.sort();
+      CHECK(is_equal(data, sorted_data));
+
+      data.sort(std::greater<ItemNDC>());
+      CHECK(is_equal(data, InitialData(sorted_data.rbegin(), sorted_data.rend())));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sort_is_stable)
+    {
+      DataNDC3 data(stable_sort_data.begin(), stable_sort_data.end());
+      CompareData compare_data(stable_sort_data.begin(), stable_sort_data.end());
+
+      data.sort();
+      compare_data.sort();
+
+      DataNDC3::iterator    itr = data.begin();
+      CompareData::iterator compare_itr = compare_data.begin();
+
+      while (itr != data.end())
+      {
+        CHECK_EQUAL(compare_itr->value, itr->value);
+        CHECK_EQUAL(compare_itr->index, itr->index);
+        ++itr;
+        ++compare_itr;
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_merge)
+    {
+      DataNDC data(sorted_data.begin(), sorted_data.begin() + 5);
+      DataNDC other(unsorted_data.begin() + 5, unsorted_data.end());
+      other.sort();
+
+      CompareData compare_data(sorted_data.begin(), sorted_data.begin() + 5);
+      CompareData compare_other(other.begin(), other.end());
+
+      data.merge(other);
+      compare_data.merge(compare_other);
+
+      CHECK(is_equal(data, compare_data));
+      CHECK(other.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_splice)
+    {
+      CompareData compare_data(sorted_data.begin(), sorted_data.end());
+      DataNDC data(sorted_data.begin(), sorted_data.end());
+
+      // Move a range forwards within the list.
+      DataNDC::iterator first = data.begin();
+      DataNDC::iterator last  = data.begin();
+      DataNDC::iterator to    = data.begin();
+      std::advance(first, 1);
+      std::advance(last, 4);
+      std::advance(to, 8);
+
+      CompareData::iterator compare_first = compare_data.begin();
+      CompareData::iterator compare_last  = compare_data.begin();
+      CompareData::iterator compare_to    = compare_data.begin();
+      std::advance(compare_first, 1);
+      std::advance(compare_last, 4);
+      std::advance(compare_to, 8);
+
+      data.splice(to, data, first, last);
+      compare_data.splice(compare_to, compare_data, compare_first, compare_last);
+      CHECK(is_equal(data, compare_data));
+
+      // Move an element backwards within the list.
+      DataNDC::iterator from = data.end();
+      --from;
+      data.splice(data.begin(), data, from);
+      compare_data.splice(compare_data.begin(), compare_data, --compare_data.end());
+      CHECK(is_equal(data, compare_data));
+
+      // Move everything to another list.
+      DataNDC other;
+      other.splice(other.end(), data);
+      CHECK(is_equal(other, compare_data));
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_comparisons)
+    {
+      DataNDC data1(sorted_data.begin(), sorted_data.end());
+      DataNDC data2(sorted_data.begin(), sorted_data.end());
+      DataNDC data3(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+      CHECK(data1 < data3);
+      CHECK(data3 > data1);
+      CHECK(data1 <= data2);
+      CHECK(data1 >= data2);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      const size_t MAX = 200;
+
+      etl::unrolled_list<int, MAX, 8> data;
+      std::list<int> compare_data;
+
+      std::mt19937 generator(1);
+
+      for (size_t i = 0; i < 20000; ++i)
+      {
+        size_t offset = std::uniform_int_distribution<size_t>(0, compare_data.size())(generator);
+
+        etl::unrolled_list<int, MAX, 8>::iterator position = data.begin();
+        std::list<int>::iterator compare_position = compare_data.begin();
+        std::advance(position, offset);
+        std::advance(compare_position, offset);
+
+        // Favour insertion, until full.
+        bool insert = !data.full() && (data.empty() || (std::uniform_int_distribution<int>(0, 2)(generator) != 0));
+
+        if (insert)
+        {
+          int value = int(i);
+          data.insert(position, value);
+          compare_data.insert(compare_position, value);
+        }
+        else if (offset < compare_data.size())
+        {
+          data.erase(position);
+          compare_data.erase(compare_position);
+        }
+
+        // Empty periodically.
+        if ((i % 5000) == 4999)
+        {
+          while (!data.empty())
+          {
+            data.erase(data.begin());
+            compare_data.erase(compare_data.begin());
+          }
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+      }
+
+      CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+    }
+  };
+}
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <cstring>
 
 #include "vector.h"
+#include "pool.h"
 
 namespace
 {
@@ -1022,5 +1023,82 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_vector_ext_constructors)
+    {
+      typedef etl::aligned_storage<sizeof(int) * SIZE, etl::alignment_of<int>::value>::type Buffer;
+      Buffer buffer1;
+      Buffer buffer2;
+      Buffer buffer3;
+      Buffer buffer4;
+
+      etl::vector_ext<int> data1(&buffer1, SIZE);
+      CHECK(data1.empty());
+      CHECK_EQUAL(SIZE, data1.max_size());
+      CHECK_EQUAL(SIZE, data1.capacity());
+
+      etl::vector_ext<int> data2(size_t(5), 3, &buffer2, SIZE);
+      CHECK_EQUAL(5U, data2.size());
+      CHECK(std::count(data2.begin(), data2.end(), 3) == 5);
+
+      etl::vector_ext<int> data3(initial_data.begin(), initial_data.end(), &buffer3, SIZE);
+      CHECK(data3.full());
+      CHECK(std::equal(initial_data.begin(), initial_data.end(), data3.begin()));
+
+      etl::vector_ext<int> data4(data3, &buffer4, SIZE);
+      CHECK(data4 == data3);
+      CHECK(data4.data() == reinterpret_cast<int*>(&buffer4));
+
+      data1 = data3;
+      CHECK(data1 == data3);
+      CHECK(data1.data() == reinterpret_cast<int*>(&buffer1));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_vector_ext_runtime_capacity)
+    {
+      int buffer[SIZE];
+
+      // Only use part of the buffer.
+      etl::vector_ext<int> data(buffer, 4);
+      IData& idata = data;
+
+      CHECK_EQUAL(4U, idata.max_size());
+
+      idata.push_back(0);
+      idata.push_back(1);
+      idata.insert(idata.begin(), size_t(2), 9);
+      CHECK(idata.full());
+      CHECK_EQUAL(9, buffer[0]);
+      CHECK_EQUAL(1, buffer[3]);
+
+      CHECK_THROW(idata.push_back(2), etl::vector_full);
+      CHECK_THROW(idata.resize(5), etl::vector_full);
+
+      // An etl::vector and an etl::vector_ext compare through the common interface.
+      Data other(idata.begin(), idata.end());
+      CHECK(other == idata);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_vector_ext_pool_slot)
+    {
+      typedef etl::aligned_storage<sizeof(int) * SIZE, etl::alignment_of<int>::value>::type Slot;
+      etl::pool<Slot, 2> pool;
+
+      Slot* p_slot = pool.allocate<Slot>();
+
+      {
+        etl::vector_ext<int> data(initial_data.begin(), initial_data.end(), p_slot, SIZE);
+        data.repair();
+
+        CHECK(std::equal(initial_data.begin(), initial_data.end(), data.begin()));
+        CHECK(data.data() == reinterpret_cast<int*>(p_slot));
+      }
+
+      pool.release(p_slot);
+      CHECK_EQUAL(0U, pool.size());
+    }
   };
 }
@@ -647,6 +647,34 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_position_n_value_shift)
+    {
+      // Fewer inserted than shifted, so the shifted ranges overlap.
+      const size_t INITIAL_SIZE = 7;
+      const size_t INSERT_SIZE  = 2;
+      const NDC INITIAL_VALUE("1");
+
+      for (size_t offset = 0; offset <= INITIAL_SIZE; ++offset)
+      {
+        CompareDataNDC compare_data;
+        DataNDC data;
+
+        data.assign(initial_data.begin(), initial_data.begin() + INITIAL_SIZE);
+        compare_data.assign(initial_data.begin(), initial_data.begin() + INITIAL_SIZE);
+        data.insert(data.begin() + offset, INSERT_SIZE, INITIAL_VALUE);
+        compare_data.insert(compare_data.begin() + offset, INSERT_SIZE, INITIAL_VALUE);
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+
+        bool is_equal = std::equal(data.begin(),
+                                   data.end(),
+                                   compare_data.begin());
+
+        CHECK(is_equal);
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_position_n_value_excess)
     {
@@ -701,6 +729,32 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_position_range_shift)
+    {
+      // Fewer inserted than shifted, so the shifted ranges overlap.
+      const size_t INITIAL_SIZE = 7;
+
+      for (size_t offset = 0; offset <= INITIAL_SIZE; ++offset)
+      {
+        CompareDataNDC compare_data;
+        DataNDC data;
+
+        data.assign(initial_data.begin(), initial_data.begin() + INITIAL_SIZE);
+        compare_data.assign(initial_data.begin(), initial_data.begin() + INITIAL_SIZE);
+        data.insert(data.begin() + offset, insert_data.begin(), insert_data.begin() + 2);
+        compare_data.insert(compare_data.begin() + offset, insert_data.begin(), insert_data.begin() + 2);
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+
+        bool is_equal = std::equal(data.begin(),
+                                   data.end(),
+                                   compare_data.begin());
+
+        CHECK(is_equal);
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_position_range_excess)
     {
@@ -764,6 +818,46 @@ namespace
       CHECK(is_equal);
     }
     
+    //*************************************************************************
+    TEST(test_relocatable_insert_erase)
+    {
+      typedef etl::vector<TestDataRelocatable, SIZE> DataRelocatable;
+
+      const int compare_initial[] = { 0, 1, 2, 3, 4 };
+      const TestDataRelocatable initial[] = { 0, 1, 2, 3, 4 };
+      const TestDataRelocatable insert[] = { 10, 11, 12 };
+
+      for (size_t offset = 0; offset <= 5; ++offset)
+      {
+        std::vector<int> compare_data(std::begin(compare_initial), std::end(compare_initial));
+        DataRelocatable data(std::begin(initial), std::end(initial));
+
+        data.insert(data.begin() + offset, TestDataRelocatable(9));
+        compare_data.insert(compare_data.begin() + offset, 9);
+
+        data.insert(data.begin() + offset, 2, TestDataRelocatable(8));
+        compare_data.insert(compare_data.begin() + offset, 2, 8);
+
+        data.erase(data.begin() + offset);
+        compare_data.erase(compare_data.begin() + offset);
+
+        data.insert(data.begin() + offset, std::begin(insert), std::end(insert));
+        compare_data.insert(compare_data.begin() + offset, 10);
+        compare_data.insert(compare_data.begin() + offset + 1, 11);
+        compare_data.insert(compare_data.begin() + offset + 2, 12);
+
+        data.erase(data.begin() + (offset / 2), data.begin() + offset + 1);
+        compare_data.erase(compare_data.begin() + (offset / 2), compare_data.begin() + offset + 1);
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          CHECK_EQUAL(compare_data[i], *data[i].p_value);
+        }
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_clear)
     {
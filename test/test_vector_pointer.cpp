@@ -967,5 +967,27 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_vector_ext)
+    {
+      int* buffer[SIZE];
+
+      etl::vector_ext<int*> data(initial_data.begin(), initial_data.begin() + 4, buffer, 4);
+      IData& idata = data;
+
+      CHECK(idata.full());
+      CHECK_EQUAL(4U, idata.max_size());
+      CHECK(std::equal(initial_data.begin(), initial_data.begin() + 4, buffer));
+      CHECK_THROW(idata.push_back(initial_data[4]), etl::vector_full);
+
+      idata.erase(idata.begin());
+      CHECK(buffer[0] == initial_data[1]);
+
+      int* buffer2[SIZE];
+      etl::vector_ext<int*> data2(data, buffer2, SIZE);
+      CHECK(data2 == data);
+      CHECK_EQUAL(SIZE, data2.max_size());
+    }
   };
 }